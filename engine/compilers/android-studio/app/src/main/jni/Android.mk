@@ -209,6 +209,7 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
 					../../../../../../source/2d/controllers/BuoyancyController.cc \
 					../../../../../../source/2d/controllers/core/GroupedSceneController.cc \
 					../../../../../../source/2d/controllers/core/PickingSceneController.cc \
+					../../../../../../source/2d/controllers/core/SceneControllerSet.cc \
 					../../../../../../source/2d/controllers/PointForceController.cc \
 					../../../../../../source/2d/core/BatchRender.cc \
 					../../../../../../source/2d/core/CoreMath.cc \
@@ -244,6 +245,7 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
 					../../../../../../source/2d/scene/SceneRenderFactories.cpp \
 					../../../../../../source/2d/scene/SceneRenderQueue.cpp \
 					../../../../../../source/2d/scene/WorldQuery.cc \
+					../../../../../../source/2d/scene/SceneAnimationClock.cc \
 					../../../../../../source/algorithm/crc.cc \
 					../../../../../../source/algorithm/hashFunction.cc \
 					../../../../../../source/assets/assetBase.cc \
@@ -499,9 +501,11 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
 					../../../../../../source/platform/platformNet_ScriptBinding.cc \
 					../../../../../../source/platform/platformString.cc \
 					../../../../../../source/platform/platformVideo.cc \
+					../../../../../../source/platform/platformGLNull.cc \
 					../../../../../../source/platform/menus/popupMenu.cc \
 					../../../../../../source/platform/nativeDialogs/msgBox.cpp \
 					../../../../../../source/platform/Tickable.cc \
+					../../../../../../source/platform/threads/jobScheduler.cc \
 					../../../../../../source/platformAndroid/android_native_app_glue.c \
 					../../../../../../source/platformAndroid/AndroidAlerts.cpp \
 					../../../../../../source/platformAndroid/AndroidAudio.cpp \
@@ -605,6 +609,10 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
 					../../../../../../source/gui/editor/guiSeparatorCtrl.cc 
 #					../../../../../../source/testing/tests/platformFileIoTests.cc \
 #					../../../../../../source/testing/tests/platformMemoryTests.cc \
+#					../../../../../../source/testing/tests/particleIntegrationTests.cc \
+#					../../../../../../source/testing/tests/physicsParallelTests.cc \
+#					../../../../../../source/testing/tests/sceneAnimationClockTests.cc \
+#					../../../../../../source/testing/tests/batchRenderTests.cc \
 #					../../../../../../source/testing/tests/platformStringTests.cc \
 #					../../../../../../source/testing/unitTesting.cc
  
@@ -162,6 +162,7 @@ const char* ImageAsset::getFilterModeDescription( ImageAsset::TextureFilterMode
 ImageAsset::ImageAsset() :  mImageFile(StringTable->EmptyString),
                             mForce16Bit(false),
                             mLocalFilterMode(FILTER_INVALID),
+                            mAtlas(false),
                             mExplicitMode(false),
                             mCellRowOrder(true),
                             mCellOffsetX(0),
@@ -173,7 +174,9 @@ ImageAsset::ImageAsset() :  mImageFile(StringTable->EmptyString),
                             mCellWidth(0),
                             mCellHeight(0),
 
-                            mImageTextureHandle(NULL)
+                            mImageTextureHandle(NULL),
+                            mImageAtlasArea(0, 0, 0, 0),
+                            mImageAtlased(false)
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mFrames );
@@ -197,6 +200,7 @@ void ImageAsset::initPersistFields()
     addProtectedField("ImageFile", TypeAssetLooseFilePath, Offset(mImageFile, ImageAsset), &setImageFile, &getImageFile, &defaultProtectedWriteFn, "");
     addProtectedField("Force16bit", TypeBool, Offset(mForce16Bit, ImageAsset), &setForce16Bit, &defaultProtectedGetFn, &writeForce16Bit, "");
     addProtectedField("FilterMode", TypeEnum, Offset(mLocalFilterMode, ImageAsset), &setFilterMode, &defaultProtectedGetFn, &writeFilterMode, 1, &textureFilterTable);   
+    addProtectedField("Atlas", TypeBool, Offset(mAtlas, ImageAsset), &setAtlas, &defaultProtectedGetFn, &writeAtlas, "");
     addProtectedField("ExplicitMode", TypeBool, Offset(mExplicitMode, ImageAsset), &setExplicitMode, &defaultProtectedGetFn, &writeExplicitMode, "");
 
     addProtectedField("CellRowOrder", TypeBool, Offset(mCellRowOrder, ImageAsset), &setCellRowOrder, &defaultProtectedGetFn, &writeCellRowOrder, "");
@@ -267,6 +271,7 @@ void ImageAsset::copyTo(SimObject* object)
     pAsset->setImageFile( getImageFile() );
     pAsset->setForce16Bit( getForce16Bit() );
     pAsset->setFilterMode( getFilterMode() );
+    pAsset->setAtlas( getAtlas() );
     pAsset->setExplicitMode( getExplicitMode() );
     pAsset->setCellRowOrder( getCellRowOrder() );
     pAsset->setCellOffsetX( getCellCountX() );
@@ -341,6 +346,21 @@ void ImageAsset::setFilterMode( const ImageAsset::TextureFilterMode filterMode )
 
 //------------------------------------------------------------------------------
 
+void ImageAsset::setAtlas( const bool atlas )
+{
+    // Ignore no change,
+    if ( atlas == mAtlas )
+        return;
+
+    // Update.
+    mAtlas = atlas;
+
+    // Refresh the asset.
+    refreshAsset();
+}
+
+//------------------------------------------------------------------------------
+
 void ImageAsset::setExplicitMode( const bool explicitMode )
 {
     // Ignore no change,
@@ -1025,12 +1045,35 @@ ImageAsset::FrameArea& ImageAsset::getCellByName( const char* cellName)
 
 //------------------------------------------------------------------------------
 
-void ImageAsset::setTextureFilter( const TextureFilterMode filterMode )
+ImageAsset::TextureFilterMode ImageAsset::getTextureFilterMode( void ) const
 {
-    // Finish if no texture.
-    if ( mImageTextureHandle.IsNull() )
-        return;
+    // Is the local filter mode specified?
+    if ( mLocalFilterMode != FILTER_INVALID )
+    {
+        // Yes, so use it.
+        return mLocalFilterMode;
+    }
+
+    TextureFilterMode filterMode = FILTER_NEAREST;
+
+    // No, so fetch the global filter.
+    const char* pGlobalFilter = Con::getVariable( "$pref::T2D::imageAssetGlobalFilterMode" );
+
+    // Fetch the global filter mode.
+    if ( pGlobalFilter != NULL && dStrlen(pGlobalFilter) > 0 )
+        filterMode = getFilterModeEnum( pGlobalFilter );
+
+    // If global filter mode is invalid then use local filter mode.
+    if ( filterMode == FILTER_INVALID )
+        filterMode = FILTER_NEAREST;
+
+    return filterMode;
+}
 
+//------------------------------------------------------------------------------
+
+GLint ImageAsset::getGLFilterMode( const TextureFilterMode filterMode )
+{
     // Select Hardware Filter Mode.
     GLint glFilterMode;
 
@@ -1056,8 +1099,19 @@ void ImageAsset::setTextureFilter( const TextureFilterMode filterMode )
             glFilterMode = GL_LINEAR;
     };
 
+    return glFilterMode;
+}
+
+//------------------------------------------------------------------------------
+
+void ImageAsset::setTextureFilter( const TextureFilterMode filterMode )
+{
+    // Finish if no texture.
+    if ( mImageTextureHandle.IsNull() )
+        return;
+
     // Set the texture objects filter mode.
-    mImageTextureHandle.setFilter( glFilterMode );
+    mImageTextureHandle.setFilter( getGLFilterMode( filterMode ) );
 }
 
 //------------------------------------------------------------------------------
@@ -1121,13 +1175,41 @@ void ImageAsset::calculateImage( void )
     // Clear frames.
     mFrames.clear();
 
-    // If we have an existing texture and we're setting to the same bitmap then force the texture manager
-    // to refresh the texture itself.
-    if ( !mImageTextureHandle.IsNull() && dStricmp(mImageTextureHandle.getTextureKey(), mImageFile) == 0 )
-        TextureManager::refresh( mImageFile );
+    // Fetch the texture filter mode.
+    const TextureFilterMode filterMode = getTextureFilterMode();
+
+    // Reset the atlas area.
+    mImageAtlased = false;
+    mImageAtlasArea.set( 0, 0, 0, 0 );
+
+    // Should the image be packed into a shared texture atlas page?
+    // NOTE: Atlas pages are 32-bit so forcing 16-bit textures excludes the image.
+    if ( mAtlas && !getForce16Bit() )
+    {
+        // Yes, so allocate an atlas area.  Images the atlas cannot take fall back to their own texture.
+        TextureHandle atlasTexture;
+        if ( TextureManager::allocateAtlasArea( mImageFile, getGLFilterMode( filterMode ), atlasTexture, mImageAtlasArea ) )
+        {
+            mImageTextureHandle = atlasTexture;
+            mImageAtlased = true;
+        }
+        else
+        {
+            mImageAtlasArea.set( 0, 0, 0, 0 );
+        }
+    }
+
+    // Use the image texture if not atlased.
+    if ( !mImageAtlased )
+    {
+        // If we have an existing texture and we're setting to the same bitmap then force the texture manager
+        // to refresh the texture itself.
+        if ( !mImageTextureHandle.IsNull() && dStricmp(mImageTextureHandle.getTextureKey(), mImageFile) == 0 )
+            TextureManager::refresh( mImageFile );
 
-    // Get image texture.
-    mImageTextureHandle.set( mImageFile, TextureHandle::BitmapTexture, true, getForce16Bit() );
+        // Get image texture.
+        mImageTextureHandle.set( mImageFile, TextureHandle::BitmapTexture, true, getForce16Bit() );
+    }
 
     // Is the texture valid?
     if ( mImageTextureHandle.IsNull() )
@@ -1137,30 +1219,8 @@ void ImageAsset::calculateImage( void )
         return;
     }
 
-    // Is the local filter mode specified?
-    if ( mLocalFilterMode != FILTER_INVALID )
-    {
-        // Yes, so set filter mode.
-        setTextureFilter( mLocalFilterMode );
-    }
-    else
-    {
-        TextureFilterMode filterMode = FILTER_NEAREST;
-
-        // No, so fetch the global filter.
-        const char* pGlobalFilter = Con::getVariable( "$pref::T2D::imageAssetGlobalFilterMode" );
-
-        // Fetch the global filter mode.
-        if ( pGlobalFilter != NULL && dStrlen(pGlobalFilter) > 0 )
-            filterMode = getFilterModeEnum( pGlobalFilter );
-
-        // If global filter mode is invalid then use local filter mode.
-        if ( filterMode == FILTER_INVALID )
-            filterMode = FILTER_NEAREST;
-
-        // Set filter mode.
-        setTextureFilter( filterMode );
-    }
+    // Set filter mode.
+    setTextureFilter( filterMode );
 
     // Calculate according to mode.
     if ( mExplicitMode )
@@ -1171,6 +1231,23 @@ void ImageAsset::calculateImage( void )
     {
         calculateImplicitMode();
     }
+
+    // Finish if not atlased.
+    if ( !mImageAtlased )
+        return;
+
+    // Fetch the atlas page texture object.
+    TextureObject* pTextureObject = ((TextureObject*)mImageTextureHandle);
+
+    // Calculate the atlas texel offset.
+    const F32 texelOffsetX = (F32)mImageAtlasArea.point.x / (F32)pTextureObject->getTextureWidth();
+    const F32 texelOffsetY = (F32)mImageAtlasArea.point.y / (F32)pTextureObject->getTextureHeight();
+
+    // Offset the frame texels into the atlas page.
+    for( typeFrameAreaVector::iterator frameItr = mFrames.begin(); frameItr != mFrames.end(); ++frameItr )
+    {
+        frameItr->mTexelArea.setOffset( texelOffsetX, texelOffsetY );
+    }
 }
 
 //------------------------------------------------------------------------------
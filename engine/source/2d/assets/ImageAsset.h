@@ -116,6 +116,12 @@ public:
                 mTexelUpper.Set( mTexelLower.x + mTexelWidth, mTexelLower.y + mTexelHeight );
             }
 
+            void setOffset( const F32 texelOffsetX, const F32 texelOffsetY )
+            {
+                mTexelLower.add( Vector2( texelOffsetX, texelOffsetY ) );
+                mTexelUpper.add( Vector2( texelOffsetX, texelOffsetY ) );
+            }
+
             void setFlip( const bool flipX, const bool flipY )
             {
                 if ( flipX ) mSwap( mTexelLower.x, mTexelUpper.x );
@@ -165,6 +171,7 @@ private:
     StringTableEntry            mImageFile;
     bool                        mForce16Bit;
     TextureFilterMode           mLocalFilterMode;
+    bool                        mAtlas;
     bool                        mExplicitMode;
     bool                        mCellRowOrder;
     S32                         mCellOffsetX;
@@ -180,6 +187,8 @@ private:
     typeFrameAreaVector         mFrames;
     typeExplicitFrameAreaVector mExplicitFrames;
     TextureHandle               mImageTextureHandle;
+    RectI                       mImageAtlasArea;
+    bool                        mImageAtlased;
 
 public:
     ImageAsset();
@@ -200,6 +209,9 @@ public:
     void                    setFilterMode( const TextureFilterMode filterMode );
     TextureFilterMode       getFilterMode( void ) const                     { return mLocalFilterMode; }
 
+    void                    setAtlas( const bool atlas );
+    inline bool             getAtlas( void ) const                          { return mAtlas; }
+
     void                    setExplicitMode( const bool explicitMode );
     bool                    getExplicitMode( void ) const                   { return mExplicitMode; }
 
@@ -239,8 +251,10 @@ public:
     bool                    containsNamedRegion(const char* regionName);
 
     inline TextureHandle&   getImageTexture( void )                         { return mImageTextureHandle; }
-    inline S32              getImageWidth( void ) const                     { return mImageTextureHandle.getWidth(); }
-    inline S32              getImageHeight( void ) const                    { return mImageTextureHandle.getHeight(); }
+    inline S32              getImageWidth( void ) const                     { return mImageAtlased ? mImageAtlasArea.extent.x : mImageTextureHandle.getWidth(); }
+    inline S32              getImageHeight( void ) const                    { return mImageAtlased ? mImageAtlasArea.extent.y : mImageTextureHandle.getHeight(); }
+    inline const Point2I&   getImageAtlasOffset( void ) const               { return mImageAtlasArea.point; }
+    inline bool             getImageAtlased( void ) const                   { return mImageAtlased; }
     inline U32              getFrameCount( void ) const                     { return (U32)mFrames.size(); };
     inline bool             containsFrame( const char* namedFrame )         { return containsNamedRegion(namedFrame); };
     
@@ -274,6 +288,8 @@ private:
     void calculateImage( void );
     void calculateImplicitMode( void );
     void calculateExplicitMode( void );
+    TextureFilterMode getTextureFilterMode( void ) const;
+    static GLint getGLFilterMode( const TextureFilterMode filterMode );
     void setTextureFilter( const TextureFilterMode filterMode );
 
 protected:
@@ -300,6 +316,9 @@ protected:
     static bool setFilterMode( void* obj, const char* data );
     static bool writeFilterMode( void* obj, StringTableEntry pFieldName )   { return static_cast<ImageAsset*>(obj)->getFilterMode() != FILTER_BILINEAR; }
 
+    static bool setAtlas( void* obj, const char* data )                     { static_cast<ImageAsset*>(obj)->setAtlas(dAtob(data)); return false; }
+    static bool writeAtlas( void* obj, StringTableEntry pFieldName )        { return static_cast<ImageAsset*>(obj)->getAtlas() == true; }
+
     static bool setExplicitMode( void* obj, const char* data )              { static_cast<ImageAsset*>(obj)->setExplicitMode(dAtob(data)); return false; }
     static bool writeExplicitMode(void* obj, StringTableEntry pFieldName) { ImageAsset* pImageAsset = static_cast<ImageAsset*>(obj); return pImageAsset->getExplicitMode(); }
 
@@ -95,6 +95,37 @@ ConsoleMethodWithDocs(ImageAsset, getForce16Bit, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether the image is packed into a shared texture atlas page or not.
+    Atlased images from different assets can be rendered in a single batch.  Images that are too large or cannot be atlased use their own texture.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(ImageAsset, setAtlas, ConsoleVoid, 3, 3, (atlas?))
+{
+    object->setAtlas( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the image is packed into a shared texture atlas page or not.
+    @return Whether the image is packed into a shared texture atlas page or not.
+*/
+ConsoleMethodWithDocs(ImageAsset, getAtlas, ConsoleBool, 2, 2, ())
+{
+    return object->getAtlas();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the image is currently packed into a shared texture atlas page or not.
+    @return Whether the image is currently packed into a shared texture atlas page or not.
+*/
+ConsoleMethodWithDocs(ImageAsset, getIsAtlased, ConsoleBool, 2, 2, ())
+{
+    return object->getImageAtlased();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether CELL row order should be used or not.
     @return No return value.
 */
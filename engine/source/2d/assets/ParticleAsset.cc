@@ -279,7 +279,36 @@ void ParticleAsset::initializeAsset( void )
     // Call parent.
     Parent::initializeAsset();
 
-    // Currently there is no specific initialization required.
+    // Bake the fields.
+    bakeFields();
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleAsset::onAssetRefresh( void )
+{
+    // Call parent.
+    Parent::onAssetRefresh();
+
+    // Bake any fields that have changed.
+    bakeFields();
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleAsset::bakeFields( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ParticleAsset_BakeFields);
+
+    // Bake the asset fields.
+    mParticleFields.bakeFields();
+
+    // Bake the emitter fields.
+    for( typeEmitterVector::iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
+    {
+        (*emitterItr)->getParticleFields().bakeFields();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -160,6 +160,9 @@ public:
 
 protected:
     virtual void initializeAsset( void );
+    virtual void onAssetRefresh( void );
+
+    void bakeFields( void );
 
     void onTamlCustomWrite( TamlCustomNodes& customNodes );
     void onTamlCustomRead( const TamlCustomNodes& customNodes );
@@ -148,6 +148,7 @@ ParticleAssetEmitter::ParticleAssetEmitter() :
                             mAttachPositionToEmitter( false ),
                             mAttachRotationToEmitter( false ),
                             mOldestInFront( false ),
+                            mPriority( 1.0f ),
                             mStaticMode( true ),
                             mImageAsset( NULL ),
                             mImageFrame( 0 ),
@@ -241,6 +242,7 @@ void ParticleAssetEmitter::initPersistFields()
     addProtectedField("AttachPositionToEmitter", TypeBool, Offset(mAttachPositionToEmitter, ParticleAssetEmitter), &setAttachPositionToEmitter, &defaultProtectedGetFn, &writeAttachPositionToEmitter, "");
     addProtectedField("AttachRotationToEmitter", TypeBool, Offset(mAttachRotationToEmitter, ParticleAssetEmitter), &setAttachRotationToEmitter, &defaultProtectedGetFn, &writeAttachRotationToEmitter, "");
     addProtectedField("OldestInFront", TypeBool, Offset(mOldestInFront, ParticleAssetEmitter), &setOldestInFront, &defaultProtectedGetFn, &writeOldestInFront, "");
+    addProtectedField("Priority", TypeF32, Offset(mPriority, ParticleAssetEmitter), &setPriority, &defaultProtectedGetFn, &writePriority, "");
 
     addProtectedField("BlendMode", TypeBool, Offset(mBlendMode, ParticleAssetEmitter), &setBlendMode, &defaultProtectedGetFn, &writeBlendMode, "");
     addProtectedField("SrcBlendFactor", TypeEnum, Offset(mSrcBlendFactor, ParticleAssetEmitter), &setSrcBlendFactor, &defaultProtectedGetFn, &writeSrcBlendFactor, 1, &srcBlendFactorTable, "");
@@ -288,6 +290,7 @@ void ParticleAssetEmitter::copyTo(SimObject* object)
    pParticleAssetEmitter->setAttachPositionToEmitter( getAttachPositionToEmitter() );
    pParticleAssetEmitter->setAttachRotationToEmitter( getAttachRotationToEmitter() );
    pParticleAssetEmitter->setOldestInFront( getOldestInFront() );
+   pParticleAssetEmitter->setPriority( getPriority() );
 
    pParticleAssetEmitter->setBlendMode( getBlendMode() );
    pParticleAssetEmitter->setSrcBlendFactor( getSrcBlendFactor() );
@@ -98,6 +98,7 @@ private:
     bool                                    mAttachPositionToEmitter;
     bool                                    mAttachRotationToEmitter;
     bool                                    mOldestInFront;
+    F32                                     mPriority;
 
     bool                                    mBlendMode;
     S32                                     mSrcBlendFactor;
@@ -182,6 +183,8 @@ public:
     inline bool getAttachRotationToEmitter( void ) const { return mAttachRotationToEmitter; }
     inline void setOldestInFront( const bool oldestInFront ) { mOldestInFront = oldestInFront; refreshAsset();  }
     inline bool getOldestInFront( void ) const { return mOldestInFront; }
+    inline void setPriority( const F32 priority ) { mPriority = mClampF( priority, 0.0f, 1.0f ); }
+    inline F32 getPriority( void ) const { return mPriority; }
    
     inline bool isStaticFrameProvider( void ) const { return mStaticMode; }
     inline bool isUsingNamedImageFrame( void ) const { return mUsingNamedFrame; }
@@ -304,6 +307,8 @@ protected:
     static bool     writeAttachRotationToEmitter( void* obj, StringTableEntry pFieldName ) { return static_cast<ParticleAssetEmitter*>(obj)->getAttachRotationToEmitter() == true; }
     static bool     setOldestInFront(void* obj, const char* data)                       { static_cast<ParticleAssetEmitter*>(obj)->setOldestInFront(dAtob(data)); return false; }
     static bool     writeOldestInFront( void* obj, StringTableEntry pFieldName )        { return static_cast<ParticleAssetEmitter*>(obj)->getOldestInFront() == true; }
+    static bool     setPriority(void* obj, const char* data)                            { static_cast<ParticleAssetEmitter*>(obj)->setPriority(dAtof(data)); return false; }
+    static bool     writePriority( void* obj, StringTableEntry pFieldName )             { return mNotEqual(static_cast<ParticleAssetEmitter*>(obj)->getPriority(), 1.0f ); }
 
     static bool     setImage(void* obj, const char* data)                               { static_cast<ParticleAssetEmitter*>(obj)->setImage(data); return false; };
     static const char* getImage(void* obj, const char* data)                            { return static_cast<ParticleAssetEmitter*>(obj)->getImage(); }
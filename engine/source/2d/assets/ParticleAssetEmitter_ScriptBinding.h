@@ -510,6 +510,28 @@ ConsoleMethodWithDocs(ParticleAssetEmitter, getOldestInFront, ConsoleBool, 2, 2,
 
 //------------------------------------------------------------------------------
 
+/*! Sets the emitter priority used when the global particle budget is under pressure.
+    Low priority emitters are throttled first whereas emitters with a priority of one are only throttled when the budget is exhausted.
+    @param priority The emitter priority in the range [0,1].  The default is one.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(ParticleAssetEmitter, setPriority, ConsoleVoid, 3, 3, (priority))
+{
+    object->setPriority( dAtof(argv[2]) );
+}
+
+//------------------------------------------------------------------------------
+
+/*! Gets the emitter priority used when the global particle budget is under pressure.
+    @return The emitter priority in the range [0,1].
+*/
+ConsoleMethodWithDocs(ParticleAssetEmitter, getPriority, ConsoleFloat, 2, 2, ())
+{
+    return object->getPriority();
+}
+
+//------------------------------------------------------------------------------
+
 /*! Sets the emitter to use the specified image asset Id and optional frame.
     @param imageAssetId The image asset Id to use.
     @param frame The frame of the image asset Id to use.  Optional.
@@ -1070,4 +1092,25 @@ ConsoleMethodWithDocs(ParticleAssetEmitter, getValueScale, ConsoleFloat, 2, 2, (
    return object->getParticleFields().getValueScale();
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Sets the number of samples the field is baked into for fast evaluation.  Zero uses the "$pref::T2D::ParticleAssetFieldBakeResolution" preference which, by default, disables baking so the field is evaluated from its data-keys.
+    @param bakeResolution The number of samples to bake the field into.
+    @return Whether the operation was successful or not.
+*/
+ConsoleMethodWithDocs(ParticleAssetEmitter, setBakeResolution, ConsoleBool, 3, 3, (bakeResolution))
+{
+   return object->getParticleFields().setBakeResolution( dAtoi(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of samples the field is baked into for fast evaluation.
+    @return The number of samples the field is baked into or zero if the field uses the bake resolution preference.
+*/
+ConsoleMethodWithDocs(ParticleAssetEmitter, getBakeResolution, ConsoleInt, 2, 2, ())
+{
+   return object->getParticleFields().getBakeResolution();
+}
+
 ConsoleMethodGroupEndWithDocs(ParticleAssetEmitter)
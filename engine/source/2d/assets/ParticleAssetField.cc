@@ -46,6 +46,7 @@ static StringTableEntry particleAssetFieldMinValueName     = StringTable->insert
 static StringTableEntry particleAssetFieldMaxValueName     = StringTable->insert( "MaxValue" );
 static StringTableEntry particleAssetFieldDefaultValueName = StringTable->insert( "DefaultValue" );
 static StringTableEntry particleAssetFieldValueScaleName   = StringTable->insert( "ValueScale" );
+static StringTableEntry particleAssetFieldBakeResolutionName = StringTable->insert( "BakeResolution" );
 static StringTableEntry particleAssetFieldDataKeysName     = StringTable->insert( "Keys" );
 
 static StringTableEntry particleAssetFieldDataKeyName      = StringTable->insert( "Key" );
@@ -64,10 +65,14 @@ ParticleAssetField::ParticleAssetField() :
                         mMaxValue( 0.0f ),
                         mDefaultValue( 1.0f ),
                         mValueScale( 1.0f ),
-                        mValueBoundsDirty( true )
+                        mValueBoundsDirty( true ),
+                        mBakeResolution( PARTICLE_ASSET_FIELD_DEFAULT_BAKE_RESOLUTION ),
+                        mBakeDirty( true ),
+                        mBakeTimeScale( 0.0f )
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mDataKeys );
+    VECTOR_SET_ASSOCIATION( mBakedValues );
 }
 
 //-----------------------------------------------------------------------------
@@ -88,6 +93,7 @@ void ParticleAssetField::copyTo( ParticleAssetField& field )
     field.mMaxValue = mMaxValue;
     field.mDefaultValue = mDefaultValue;
     field.mValueScale = mValueScale;
+    field.mBakeResolution = mBakeResolution;
 
     // Copy data keys.    
     field.clearDataKeys();
@@ -170,6 +176,9 @@ void ParticleAssetField::setValueBounds( F32 maxTime, F32 minValue, F32 maxValue
 
     // Flag the value bounds as dirty.
     mValueBoundsDirty = true;
+
+    // Invalidate the bake.
+    invalidateBake();
 }
 
 //-----------------------------------------------------------------------------
@@ -202,6 +211,9 @@ bool ParticleAssetField::setRepeatTime( const F32 repeatTime )
     // Set repeat time.
     mRepeatTime = repeatTime;
 
+    // Invalidate the bake.
+    invalidateBake();
+
     // Return Okay.
     return true;
 }
@@ -223,17 +235,83 @@ bool ParticleAssetField::setValueScale( const F32 valueScale )
     // Set Value Scale/
     mValueScale = valueScale;
 
+    // Invalidate the bake.
+    invalidateBake();
+
+    // Return Okay.
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ParticleAssetField::setBakeResolution( const U32 bakeResolution )
+{
+    // Check Bake Resolution.
+    if ( bakeResolution > PARTICLE_ASSET_FIELD_MAXIMUM_BAKE_RESOLUTION )
+    {
+        // Warn.
+        Con::warnf("ParticleAssetField::setBakeResolution() - Invalid Bake Resolution! (%d of %d)", bakeResolution, PARTICLE_ASSET_FIELD_MAXIMUM_BAKE_RESOLUTION );
+
+        // Return Error.
+        return false;
+    }
+
+    // Set Bake Resolution.
+    mBakeResolution = bakeResolution;
+
+    // Invalidate the bake.
+    invalidateBake();
+
     // Return Okay.
     return true;
 }
 
 //-----------------------------------------------------------------------------
 
+void ParticleAssetField::bakeField( void )
+{
+    // Finish if the bake is current.
+    if ( !mBakeDirty )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(ParticleAssetField_BakeField);
+
+    // Flag the bake as current.
+    mBakeDirty = false;
+
+    // Clear the baked values.
+    mBakedValues.clear();
+
+    // Fetch the bake resolution, falling back to the preference if the field has none.
+    const U32 bakeResolution = mBakeResolution > 0 ? mBakeResolution : (U32)mClamp( Con::getIntVariable( PARTICLE_ASSET_FIELD_BAKE_RESOLUTION, 0 ), 0, PARTICLE_ASSET_FIELD_MAXIMUM_BAKE_RESOLUTION );
+
+    // Finish if baking is disabled or the field is constant.
+    // NOTE: A constant field is already an early-out in "getFieldValue()".
+    if ( bakeResolution == 0 || getDataKeyCount() < 2 )
+        return;
+
+    // Sample the data-keys uniformly over the field time.
+    mBakedValues.setSize( bakeResolution + 1 );
+    for ( U32 index = 0; index <= bakeResolution; ++index )
+    {
+        mBakedValues[index] = evaluateDataKeys( (mMaxTime * index) / bakeResolution ) * mValueScale;
+    }
+
+    // Calculate the time to table scale.
+    mBakeTimeScale = bakeResolution / mMaxTime;
+}
+
+//-----------------------------------------------------------------------------
+
 void ParticleAssetField::resetDataKeys(void)
 {
     // Clear Data Keys.
     mDataKeys.clear();
 
+    // Invalidate the bake.
+    invalidateBake();
+
     // Add default value Data-Key.
     addDataKey( 0.0f, mDefaultValue );
 }
@@ -245,6 +323,9 @@ S32 ParticleAssetField::setSingleDataKey( const F32 value )
     // Clear Data Keys.
     mDataKeys.clear();
 
+    // Invalidate the bake.
+    invalidateBake();
+
     // Add a single key with the specified value.
     return addDataKey( 0.0f, value );
 }
@@ -273,6 +354,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
             // Yes, so set time.
             mDataKeys[index].mValue = value;
 
+            // Invalidate the bake.
+            invalidateBake();
+
             // Return Index.
             return index;
         }
@@ -282,6 +366,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
             break;
     }
 
+    // Invalidate the bake.
+    invalidateBake();
+
     // Insert Data-Key.
     mDataKeys.insert( index );
 
@@ -316,6 +403,9 @@ bool ParticleAssetField::removeDataKey( const U32 index )
     // Remove Index.
     mDataKeys.erase(index);
 
+    // Invalidate the bake.
+    invalidateBake();
+
     // Return Okay.
     return true;
 }
@@ -343,6 +433,9 @@ bool ParticleAssetField::setDataKeyValue( const U32 index, const F32 value )
     // Set Data Key Value.
     mDataKeys[index].mValue = value;
 
+    // Invalidate the bake.
+    invalidateBake();
+
     // Return Okay.
     return true;
 }
@@ -407,14 +500,40 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
     time = getMin(getMax( 0.0f, time ), mMaxTime);
 
     // Repeat Time.
-    time = mFmod( time * mRepeatTime, mMaxTime + FLT_EPSILON );
+    if ( mRepeatTime != 1.0f )
+        time = mFmod( time * mRepeatTime, mMaxTime + FLT_EPSILON );
 
+    // Is the field baked?
+    if ( getIsBaked() )
+    {
+        // Yes, so fetch the lookup position.
+        const F32 position = time * mBakeTimeScale;
+        const U32 index = (U32)position;
+        const U32 lastIndex = (U32)mBakedValues.size() - 1;
+
+        // Return Last Value if we're on/past the last sample.
+        if ( index >= lastIndex )
+            return mBakedValues[lastIndex];
+
+        // Return lerped Value.
+        const F32 dTime = position - index;
+        return (mBakedValues[index] * (1.0f-dTime)) + (mBakedValues[index+1] * dTime);
+    }
+
+    // Return evaluated Value.
+    return evaluateDataKeys( time ) * mValueScale;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 ParticleAssetField::evaluateDataKeys( const F32 time ) const
+{
     // Fetch Max Key Index.
     const U32 maxKeyIndex = getDataKeyCount()-1;
 
     // Return Last Value if we're on/past the last time.
     if ( time >= mDataKeys[maxKeyIndex].mTime )
-        return mDataKeys[maxKeyIndex].mValue * mValueScale;
+        return mDataKeys[maxKeyIndex].mValue;
 
     // Find Data-Key Indexes.
     U32 index1;
@@ -425,7 +544,7 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
 
     // If we're exactly on a Data-Key then return that key.
     if ( mIsEqual( mDataKeys[index1].mTime, time) )
-        return mDataKeys[index1].mValue * mValueScale;
+        return mDataKeys[index1].mValue;
 
     // Set Adjacent Indexes.
     index2 = index1--;
@@ -437,12 +556,12 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
     const F32 dTime = (time-time1)/(time2-time1);
 
     // Return lerped Value.
-    return ((mDataKeys[index1].mValue * (1.0f-dTime)) + (mDataKeys[index2].mValue * dTime)) * mValueScale;
+    return ((mDataKeys[index1].mValue * (1.0f-dTime)) + (mDataKeys[index2].mValue * dTime));
 }
 
 //-----------------------------------------------------------------------------
 
-F32 ParticleAssetField::calculateFieldBV( const ParticleAssetField& base, const ParticleAssetField& variation, const F32 effectAge, const bool modulate, const F32 modulo )
+F32 ParticleAssetField::calculateFieldBV( RandomGeneratorBase& random, const ParticleAssetField& base, const ParticleAssetField& variation, const F32 effectAge, const bool modulate, const F32 modulo )
 {
     // Fetch Graph Components.
     const F32 baseValue   = base.getFieldValue( effectAge );
@@ -451,15 +570,15 @@ F32 ParticleAssetField::calculateFieldBV( const ParticleAssetField& base, const
     // Modulate?
     if ( modulate )
         // Return Modulo Calculation.
-        return mFmod( baseValue + CoreMath::mGetRandomF(-varValue, varValue), modulo );
+        return mFmod( baseValue + random.randRangeF(-varValue, varValue), modulo );
     else
         // Return Clamped Calculation.
-        return mClampF( baseValue + CoreMath::mGetRandomF(-varValue, varValue), base.getMinValue(), base.getMaxValue() );
+        return mClampF( baseValue + random.randRangeF(-varValue, varValue), base.getMinValue(), base.getMaxValue() );
 }
 
 //-----------------------------------------------------------------------------
 
-F32 ParticleAssetField::calculateFieldBVE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& effect, const F32 effectAge, const bool modulate, const F32 modulo )
+F32 ParticleAssetField::calculateFieldBVE( RandomGeneratorBase& random, const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& effect, const F32 effectAge, const bool modulate, const F32 modulo )
 {
     // Fetch Graph Components.
     const F32 baseValue   = base.getFieldValue( effectAge );
@@ -469,15 +588,15 @@ F32 ParticleAssetField::calculateFieldBVE( const ParticleAssetField& base, const
     // Modulate?
     if ( modulate )
         // Return Modulo Calculation.
-        return mFmod( (baseValue + CoreMath::mGetRandomF(-varValue, varValue)) * effectValue, modulo );
+        return mFmod( (baseValue + random.randRangeF(-varValue, varValue)) * effectValue, modulo );
     else
         // Return Clamped Calculation.
-        return mClampF( (baseValue + CoreMath::mGetRandomF(-varValue, varValue)) * effectValue, base.getMinValue(), base.getMaxValue() );
+        return mClampF( (baseValue + random.randRangeF(-varValue, varValue)) * effectValue, base.getMinValue(), base.getMaxValue() );
 }
 
 //-----------------------------------------------------------------------------
 
-F32 ParticleAssetField::calculateFieldBVLE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& overlife, const ParticleAssetField& effect, const F32 effectAge, const F32 particleAge, const bool modulate, const F32 modulo )
+F32 ParticleAssetField::calculateFieldBVLE( RandomGeneratorBase& random, const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& overlife, const ParticleAssetField& effect, const F32 effectAge, const F32 particleAge, const bool modulate, const F32 modulo )
 {
     // Fetch Graph Components.
     const F32 baseValue   = base.getFieldValue( effectAge );
@@ -488,10 +607,10 @@ F32 ParticleAssetField::calculateFieldBVLE( const ParticleAssetField& base, cons
     // Modulate?
     if ( modulate )
         // Return Modulo Calculation.
-        return mFmod( (baseValue + CoreMath::mGetRandomF(-varValue, varValue)) * effectValue * lifeValue, modulo );
+        return mFmod( (baseValue + random.randRangeF(-varValue, varValue)) * effectValue * lifeValue, modulo );
     else
         // Return Clamped Calculation.
-        return mClampF( (baseValue + CoreMath::mGetRandomF(-varValue, varValue)) * effectValue * lifeValue, base.getMinValue(), base.getMaxValue() );
+        return mClampF( (baseValue + random.randRangeF(-varValue, varValue)) * effectValue * lifeValue, base.getMinValue(), base.getMaxValue() );
 }
 
 //------------------------------------------------------------------------------
@@ -525,6 +644,9 @@ void ParticleAssetField::onTamlCustomWrite( TamlCustomNode* pCustomNode )
     if ( mNotEqual( getRepeatTime(), 1.0f ) )
         pAssetField->addField( particleAssetFieldRepeatTimeName, getRepeatTime() );
 
+    if ( getBakeResolution() != PARTICLE_ASSET_FIELD_DEFAULT_BAKE_RESOLUTION )
+        pAssetField->addField( particleAssetFieldBakeResolutionName, getBakeResolution() );
+
     // Fetch key count.
     const U32 keyCount = getDataKeyCount();
 
@@ -565,6 +687,7 @@ void ParticleAssetField::onTamlCustomRead( const TamlCustomNode* pCustomNode )
     F32 maxValue = getMaxValue();
     F32 defaultValue = getDefaultValue();
     F32 valueScale = getValueScale();
+    U32 bakeResolution = getBakeResolution();
 
     // Set-up a temporary set of keys.
     Vector<DataKey> keys;
@@ -612,6 +735,10 @@ void ParticleAssetField::onTamlCustomRead( const TamlCustomNode* pCustomNode )
         {
             pField->getFieldValue( valueScale );
         }
+        else if ( fieldName == particleAssetFieldBakeResolutionName )
+        {
+            pField->getFieldValue( bakeResolution );
+        }
         else if ( fieldName == particleAssetFieldDataKeysName )
         {
             const char* pDataKeys = pField->getFieldValue();
@@ -692,8 +819,14 @@ void ParticleAssetField::onTamlCustomRead( const TamlCustomNode* pCustomNode )
     // Set the repeat time.
     setRepeatTime( repeatTime );
 
+    // Set the bake resolution.
+    setBakeResolution( bakeResolution );
+
     // Set the data keys.
     mDataKeys = keys;
+
+    // Invalidate the bake.
+    invalidateBake();
 }
 
 //-----------------------------------------------------------------------------
@@ -786,4 +919,10 @@ void ParticleAssetField::WriteCustomTamlSchema( const AbstractClassRep* pClassRe
     pFieldRepeatTime->SetAttribute( "name", particleAssetFieldRepeatTimeName );
     pFieldRepeatTime->SetAttribute( "type", "xs:float" );
     pFieldComplexTypeElement->LinkEndChild( pFieldRepeatTime );
+
+    // Create "Bake Resolution" attribute.
+    TiXmlElement* pFieldBakeResolution = new TiXmlElement( "xs:attribute" );
+    pFieldBakeResolution->SetAttribute( "name", particleAssetFieldBakeResolutionName );
+    pFieldBakeResolution->SetAttribute( "type", "xs:nonNegativeInteger" );
+    pFieldComplexTypeElement->LinkEndChild( pFieldBakeResolution );
 }
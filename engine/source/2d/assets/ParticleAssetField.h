@@ -31,6 +31,17 @@
 #include "persistence/taml/tamlCustom.h"
 #endif
 
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
+///-----------------------------------------------------------------------------
+
+#define PARTICLE_ASSET_FIELD_BAKE_RESOLUTION             "$pref::T2D::ParticleAssetFieldBakeResolution"
+
+#define PARTICLE_ASSET_FIELD_DEFAULT_BAKE_RESOLUTION     0
+#define PARTICLE_ASSET_FIELD_MAXIMUM_BAKE_RESOLUTION     4096
+
 ///-----------------------------------------------------------------------------
 
 class ParticleAssetField
@@ -71,6 +82,16 @@ private:
 
     Vector<DataKey> mDataKeys;
 
+    /// Baked lookup-table.
+    /// A zero resolution uses the bake resolution preference which is zero (no baking) by default.
+    U32 mBakeResolution;
+    bool mBakeDirty;
+    F32 mBakeTimeScale;
+    Vector<F32> mBakedValues;
+
+    F32 evaluateDataKeys( const F32 time ) const;
+    inline void invalidateBake( void ) { mBakeDirty = true; }
+
 public:
     ParticleAssetField();
     virtual ~ParticleAssetField();
@@ -92,6 +113,10 @@ public:
     inline F32 getMaxTime( void ) const { return mMaxTime; };
     inline F32 getValueScale( void ) const { return mValueScale; };
     inline F32 getDefaultValue( void ) const { return mDefaultValue; }
+    bool setBakeResolution( const U32 bakeResolution );
+    inline U32 getBakeResolution( void ) const { return mBakeResolution; }
+    inline bool getIsBaked( void ) const { return !mBakeDirty && mBakedValues.size() > 0; }
+    void bakeField( void );
 
     void resetDataKeys( void );
     S32 setSingleDataKey( const F32 value );
@@ -105,9 +130,9 @@ public:
     const DataKey& getDataKey( const U32 index ) const;
     F32 getFieldValue( F32 time ) const;
 
-    static F32 calculateFieldBV( const ParticleAssetField& base, const ParticleAssetField& variation, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
-    static F32 calculateFieldBVE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& effect, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
-    static F32 calculateFieldBVLE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& overlife, const ParticleAssetField& effect, const F32 effectTime, const F32 particleAge, const bool modulate = false, const F32 modulo = 0.0f );
+    static F32 calculateFieldBV( RandomGeneratorBase& random, const ParticleAssetField& base, const ParticleAssetField& variation, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
+    static F32 calculateFieldBVE( RandomGeneratorBase& random, const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& effect, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
+    static F32 calculateFieldBVLE( RandomGeneratorBase& random, const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& overlife, const ParticleAssetField& effect, const F32 effectTime, const F32 particleAge, const bool modulate = false, const F32 modulo = 0.0f );
 
     void onTamlCustomWrite( TamlCustomNode* pCustomNode  );
     void onTamlCustomRead( const TamlCustomNode* pCustomNode );
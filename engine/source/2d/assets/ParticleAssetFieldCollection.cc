@@ -141,7 +141,12 @@ S32 ParticleAssetFieldCollection::setSingleDataKey( F32 value )
     }
 
     // Set single data key.
-    return mpSelectedField->setSingleDataKey( value );
+    const S32 index = mpSelectedField->setSingleDataKey( value );
+
+    // Bake the field.
+    mpSelectedField->bakeField();
+
+    return index;
 }
 
 //-----------------------------------------------------------------------------
@@ -157,7 +162,12 @@ S32 ParticleAssetFieldCollection::addDataKey( F32 time, F32 value )
     }
 
     // Add Data Key.
-    return mpSelectedField->addDataKey( time, value );
+    const S32 index = mpSelectedField->addDataKey( time, value );
+
+    // Bake the field.
+    mpSelectedField->bakeField();
+
+    return index;
 }
 
 //-----------------------------------------------------------------------------
@@ -173,7 +183,12 @@ bool ParticleAssetFieldCollection::removeDataKey( S32 index )
     }
 
     // Remove Data Key.
-    return mpSelectedField->removeDataKey( index );
+    const bool status = mpSelectedField->removeDataKey( index );
+
+    // Bake the field.
+    mpSelectedField->bakeField();
+
+    return status;
 }
 
 //-----------------------------------------------------------------------------
@@ -191,6 +206,9 @@ bool ParticleAssetFieldCollection::clearDataKeys( void )
     // Clear Data Keys
     mpSelectedField->clearDataKeys();
 
+    // Bake the field.
+    mpSelectedField->bakeField();
+
     // Return Okay.
     return true;
 }
@@ -208,7 +226,12 @@ bool ParticleAssetFieldCollection::setDataKey( S32 index, F32 value )
     }
 
     // Set the data-key value.
-    return mpSelectedField->setDataKeyValue( index, value );
+    const bool status = mpSelectedField->setDataKeyValue( index, value );
+
+    // Bake the field.
+    mpSelectedField->bakeField();
+
+    return status;
 }
 
 //-----------------------------------------------------------------------------
@@ -368,7 +391,12 @@ bool ParticleAssetFieldCollection::setRepeatTime( const F32 repeatTime )
     }
 
     // Set repeat time.
-    return mpSelectedField->setRepeatTime( repeatTime );
+    const bool status = mpSelectedField->setRepeatTime( repeatTime );
+
+    // Bake the field.
+    mpSelectedField->bakeField();
+
+    return status;
 }
 
 //-----------------------------------------------------------------------------
@@ -400,7 +428,12 @@ bool ParticleAssetFieldCollection::setValueScale( const F32 valueScale )
     }
 
     // Set Value Scale.
-    return mpSelectedField->setValueScale( valueScale );
+    const bool status = mpSelectedField->setValueScale( valueScale );
+
+    // Bake the field.
+    mpSelectedField->bakeField();
+
+    return status;
 }
 
 //-----------------------------------------------------------------------------
@@ -419,6 +452,55 @@ F32 ParticleAssetFieldCollection::getValueScale( void ) const
     return mpSelectedField->getValueScale();
 }
 
+//-----------------------------------------------------------------------------
+
+bool ParticleAssetFieldCollection::setBakeResolution( const U32 bakeResolution )
+{
+    // Have we got a valid field selected?
+    if ( !mpSelectedField )
+    {
+        // No, so warn.
+        Con::warnf( "ParticleAssetFieldCollection::setBakeResolution() - No field selected." );
+        return false;
+    }
+
+    // Set Bake Resolution.
+    const bool status = mpSelectedField->setBakeResolution( bakeResolution );
+
+    // Bake the field.
+    mpSelectedField->bakeField();
+
+    return status;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ParticleAssetFieldCollection::getBakeResolution( void ) const
+{
+    // Have we got a valid field selected?
+    if ( !mpSelectedField )
+    {
+        // No, so warn.
+        Con::warnf( "ParticleAssetFieldCollection::getBakeResolution() - No field selected." );
+        return 0;
+    }
+
+    // Get Bake Resolution.
+    return mpSelectedField->getBakeResolution();
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleAssetFieldCollection::bakeFields( void )
+{
+    // Iterate the fields.
+    for( typeFieldHash::iterator fieldItr = mFields.begin(); fieldItr != mFields.end(); ++fieldItr )
+    {
+        // Bake the field.
+        fieldItr->value->bakeField();
+    }
+}
+
 //------------------------------------------------------------------------------
 
 void ParticleAssetFieldCollection::onTamlCustomWrite( TamlCustomNodes& customNodes )
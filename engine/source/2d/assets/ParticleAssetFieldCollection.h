@@ -80,6 +80,10 @@ public:
     F32 getRepeatTime( void ) const;
     bool setValueScale( const F32 valueScale );
     F32 getValueScale( void ) const;    
+    bool setBakeResolution( const U32 bakeResolution );
+    U32 getBakeResolution( void ) const;
+
+    void bakeFields( void );
 
     void onTamlCustomWrite( TamlCustomNodes& customNodes );
     void onTamlCustomRead( const TamlCustomNodes& customNodes );
@@ -339,6 +339,27 @@ ConsoleMethodWithDocs(ParticleAsset, getValueScale, ConsoleFloat, 2, 2, ())
    return object->getParticleFields().getValueScale();
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Sets the number of samples the field is baked into for fast evaluation.  Zero uses the "$pref::T2D::ParticleAssetFieldBakeResolution" preference which, by default, disables baking so the field is evaluated from its data-keys.
+    @param bakeResolution The number of samples to bake the field into.
+    @return Whether the operation was successful or not.
+*/
+ConsoleMethodWithDocs(ParticleAsset, setBakeResolution, ConsoleBool, 3, 3, (bakeResolution))
+{
+   return object->getParticleFields().setBakeResolution( dAtoi(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of samples the field is baked into for fast evaluation.
+    @return The number of samples the field is baked into or zero if the field uses the bake resolution preference.
+*/
+ConsoleMethodWithDocs(ParticleAsset, getBakeResolution, ConsoleInt, 2, 2, ())
+{
+   return object->getParticleFields().getBakeResolution();
+}
+
 //-----------------------------------------------------------------------------
 /// Emitter asset methods.
 //-----------------------------------------------------------------------------
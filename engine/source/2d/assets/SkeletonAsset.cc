@@ -44,6 +44,8 @@
 #include "2d/assets/SkeletonAsset.h"
 #endif
 
+#include "spine/extension.h"
+
 // Script bindings.
 #include "SkeletonAsset_ScriptBinding.h"
 
@@ -97,9 +99,11 @@ ConsoleSetType( TypeSkeletonAssetPtr )
 
 //------------------------------------------------------------------------------
 
-SkeletonAsset::SkeletonAsset() :    mSkeletonFile(StringTable->EmptyString),
+SkeletonAsset::SkeletonAsset() :    mAtlasDirty(true),
+                                    mPoseSampleRate(SKELETON_ASSET_DEFAULT_POSE_SAMPLE_RATE),
+                                    mpPoseSkeleton(NULL),
+                                    mSkeletonFile(StringTable->EmptyString),
                                     mAtlasFile(StringTable->EmptyString),
-                                    mAtlasDirty(true),
                                     mAtlas(NULL),
                                     mSkeletonData(NULL),
                                     mStateData(NULL)
@@ -110,6 +114,8 @@ SkeletonAsset::SkeletonAsset() :    mSkeletonFile(StringTable->EmptyString),
 
 SkeletonAsset::~SkeletonAsset()
 {
+    clearPoses();
+
     spAnimationStateData_dispose(mStateData);
     spSkeletonData_dispose(mSkeletonData);
     spAtlas_dispose(mAtlas);
@@ -125,6 +131,7 @@ void SkeletonAsset::initPersistFields()
     // Fields.
     addProtectedField("AtlasFile", TypeAssetLooseFilePath, Offset(mAtlasFile, SkeletonAsset), &setAtlasFile, &defaultProtectedGetFn, &writeAtlasFile, "The loose file pointing to the .atlas file used for skinning");
     addProtectedField("SkeletonFile", TypeAssetLooseFilePath, Offset(mSkeletonFile, SkeletonAsset), &setSkeletonFile, &defaultProtectedGetFn, &writeSkeletonFile, "The loose file produced by the editor, which is fed into this asset");
+    addProtectedField("PoseSampleRate", TypeF32, Offset(mPoseSampleRate, SkeletonAsset), &setPoseSampleRate, &defaultProtectedGetFn, &writePoseSampleRate, "The rate, in samples per second, that shared skeleton poses are evaluated at");
 }
 
 //------------------------------------------------------------------------------
@@ -205,6 +212,7 @@ void SkeletonAsset::copyTo(SimObject* object)
     // Copy state.
     pAsset->setAtlasFile( getAtlasFile() );
     pAsset->setSkeletonFile( getSkeletonFile() );
+    pAsset->setPoseSampleRate( getPoseSampleRate() );
 }
 
 //------------------------------------------------------------------------------
@@ -303,6 +311,9 @@ void SkeletonAsset::buildSkeletonData( void )
     // Atlas load failure
     AssertFatal(mAtlas != NULL, "SkeletonAsset::buildSkeletonData() - Atlas was not loaded.");
     
+    // Clear the shared poses as they reference the skeleton data.
+    clearPoses();
+    
     // Clear state data
     if (mStateData)
         spAnimationStateData_dispose(mStateData);
@@ -337,6 +348,226 @@ bool SkeletonAsset::isAssetValid( void ) const
 
 //-----------------------------------------------------------------------------
 
+void SkeletonAsset::setPoseSampleRate( const F32 sampleRate )
+{
+    // Ignore no change.
+    const F32 poseSampleRate = mClampF( sampleRate, 1.0f, SKELETON_ASSET_MAXIMUM_POSE_SAMPLE_RATE );
+    if ( mIsEqual( poseSampleRate, mPoseSampleRate ) )
+        return;
+
+    mPoseSampleRate = poseSampleRate;
+
+    // Clear the shared poses as they were sampled at the previous rate.
+    clearPoses();
+}
+
+//-----------------------------------------------------------------------------
+
+bool SkeletonAsset::applyPose( spSkeleton* pSkeleton, const spAnimation* pAnimation, const F32 time, const bool loop )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SkeletonAsset_ApplyPose);
+
+    // Sanity!
+    AssertFatal( pSkeleton != NULL, "SkeletonAsset::applyPose() - Cannot apply a pose to a NULL skeleton." );
+
+    // Finish if the skeleton isn't built from this asset.
+    if ( pAnimation == NULL || pSkeleton->data != mSkeletonData )
+        return false;
+
+    // Find the animation poses.
+    AnimationPoses* pAnimationPoses = findAnimationPoses( pAnimation, pSkeleton->skin, pSkeleton->flipX != 0, pSkeleton->flipY != 0 );
+
+    // Quantize the time to a sampled frame.
+    F32 animationTime = time;
+    if ( loop && pAnimation->duration > 0.0f )
+        animationTime = mFmod( animationTime, pAnimation->duration );
+    const U32 lastFrame = (U32)pAnimationPoses->mFrameEvaluated.size() - 1;
+    const U32 frame = getMin( (U32)( getMax( animationTime, 0.0f ) * mPoseSampleRate ), lastFrame );
+
+    // Evaluate the pose if it's not been sampled yet.
+    if ( !pAnimationPoses->mFrameEvaluated[frame] )
+        evaluatePose( pAnimationPoses, frame );
+
+    // Apply the bone poses.
+    const BonePose* pBonePose = pAnimationPoses->mBonePoses.address() + ( frame * pSkeleton->boneCount );
+    for ( S32 i = 0; i < pSkeleton->boneCount; ++i, ++pBonePose )
+    {
+        spBone* pBone = pSkeleton->bones[i];
+        CONST_CAST(float, pBone->m00) = pBonePose->mM00;
+        CONST_CAST(float, pBone->m01) = pBonePose->mM01;
+        CONST_CAST(float, pBone->worldX) = pBonePose->mWorldX;
+        CONST_CAST(float, pBone->m10) = pBonePose->mM10;
+        CONST_CAST(float, pBone->m11) = pBonePose->mM11;
+        CONST_CAST(float, pBone->worldY) = pBonePose->mWorldY;
+        CONST_CAST(float, pBone->worldRotation) = pBonePose->mWorldRotation;
+        CONST_CAST(float, pBone->worldScaleX) = pBonePose->mWorldScaleX;
+        CONST_CAST(float, pBone->worldScaleY) = pBonePose->mWorldScaleY;
+    }
+
+    // Apply the slot poses.
+    const SlotPose* pSlotPose = pAnimationPoses->mSlotPoses.address() + ( frame * pSkeleton->slotCount );
+    for ( S32 i = 0; i < pSkeleton->slotCount; ++i, ++pSlotPose )
+    {
+        spSlot* pSlot = pSkeleton->slots[i];
+        if ( pSlot->attachment != pSlotPose->mpAttachment )
+            spSlot_setAttachment( pSlot, pSlotPose->mpAttachment );
+        pSlot->r = pSlotPose->mRed;
+        pSlot->g = pSlotPose->mGreen;
+        pSlot->b = pSlotPose->mBlue;
+        pSlot->a = pSlotPose->mAlpha;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool SkeletonAsset::bakePoses( const char* pAnimationName, const char* pSkinName )
+{
+    // Finish if no skeleton data.
+    if ( mSkeletonData == NULL )
+    {
+        Con::warnf( "SkeletonAsset::bakePoses() - Cannot bake poses as the skeleton data was not loaded." );
+        return false;
+    }
+
+    // Find the animation.
+    spAnimation* pAnimation = spSkeletonData_findAnimation( mSkeletonData, pAnimationName );
+    if ( pAnimation == NULL )
+    {
+        Con::warnf( "SkeletonAsset::bakePoses() - Animation '%s' does not exist.", pAnimationName );
+        return false;
+    }
+
+    // Find the skin.
+    spSkin* pSkin = NULL;
+    if ( pSkinName != NULL && *pSkinName != 0 )
+    {
+        pSkin = spSkeletonData_findSkin( mSkeletonData, pSkinName );
+        if ( pSkin == NULL )
+        {
+            Con::warnf( "SkeletonAsset::bakePoses() - Skin '%s' does not exist.", pSkinName );
+            return false;
+        }
+    }
+
+    // Evaluate all the unflipped frames.
+    AnimationPoses* pAnimationPoses = findAnimationPoses( pAnimation, pSkin, false, false );
+    const U32 frameCount = (U32)pAnimationPoses->mFrameEvaluated.size();
+    for ( U32 frame = 0; frame < frameCount; ++frame )
+    {
+        if ( !pAnimationPoses->mFrameEvaluated[frame] )
+            evaluatePose( pAnimationPoses, frame );
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonAsset::clearPoses( void )
+{
+    // Delete the animation poses.
+    for ( typeAnimationPosesVector::iterator itr = mAnimationPoses.begin(); itr != mAnimationPoses.end(); ++itr )
+        delete *itr;
+    mAnimationPoses.clear();
+
+    // Dispose of the pose skeleton.
+    if ( mpPoseSkeleton != NULL )
+    {
+        spSkeleton_dispose( mpPoseSkeleton );
+        mpPoseSkeleton = NULL;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+SkeletonAsset::AnimationPoses* SkeletonAsset::findAnimationPoses( const spAnimation* pAnimation, const spSkin* pSkin, const bool flipX, const bool flipY )
+{
+    // Find existing animation poses.
+    for ( typeAnimationPosesVector::iterator itr = mAnimationPoses.begin(); itr != mAnimationPoses.end(); ++itr )
+    {
+        AnimationPoses* pAnimationPoses = *itr;
+        if ( pAnimationPoses->mpAnimation == pAnimation &&
+             pAnimationPoses->mpSkin == pSkin &&
+             pAnimationPoses->mFlipX == flipX &&
+             pAnimationPoses->mFlipY == flipY )
+            return pAnimationPoses;
+    }
+
+    // Create the animation poses.
+    // NOTE:-   Frames are sampled from the start up to and including the end of the animation.
+    const U32 frameCount = (U32)mFloor( getMax( pAnimation->duration, 0.0f ) * mPoseSampleRate ) + 1;
+    AnimationPoses* pAnimationPoses = new AnimationPoses();
+    pAnimationPoses->mpAnimation = const_cast<spAnimation*>( pAnimation );
+    pAnimationPoses->mpSkin = const_cast<spSkin*>( pSkin );
+    pAnimationPoses->mFlipX = flipX;
+    pAnimationPoses->mFlipY = flipY;
+    pAnimationPoses->mFrameEvaluated.setSize( frameCount );
+    for ( U32 frame = 0; frame < frameCount; ++frame )
+        pAnimationPoses->mFrameEvaluated[frame] = false;
+    pAnimationPoses->mBonePoses.setSize( frameCount * mSkeletonData->boneCount );
+    pAnimationPoses->mSlotPoses.setSize( frameCount * mSkeletonData->slotCount );
+    mAnimationPoses.push_back( pAnimationPoses );
+
+    return pAnimationPoses;
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonAsset::evaluatePose( AnimationPoses* pAnimationPoses, const U32 frame )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SkeletonAsset_EvaluatePose);
+
+    // Create the pose skeleton if required.
+    if ( mpPoseSkeleton == NULL )
+        mpPoseSkeleton = spSkeleton_create( mSkeletonData );
+
+    // Pose the skeleton at the sampled time.
+    const F32 time = getMin( (F32)frame / mPoseSampleRate, pAnimationPoses->mpAnimation->duration );
+    mpPoseSkeleton->flipX = pAnimationPoses->mFlipX;
+    mpPoseSkeleton->flipY = pAnimationPoses->mFlipY;
+    spSkeleton_setSkin( mpPoseSkeleton, pAnimationPoses->mpSkin );
+    spSkeleton_setToSetupPose( mpPoseSkeleton );
+    spAnimation_apply( pAnimationPoses->mpAnimation, mpPoseSkeleton, time, time, false, NULL, NULL );
+    spSkeleton_updateWorldTransform( mpPoseSkeleton );
+
+    // Store the bone poses.
+    BonePose* pBonePose = pAnimationPoses->mBonePoses.address() + ( frame * mpPoseSkeleton->boneCount );
+    for ( S32 i = 0; i < mpPoseSkeleton->boneCount; ++i, ++pBonePose )
+    {
+        const spBone* pBone = mpPoseSkeleton->bones[i];
+        pBonePose->mM00 = pBone->m00;
+        pBonePose->mM01 = pBone->m01;
+        pBonePose->mWorldX = pBone->worldX;
+        pBonePose->mM10 = pBone->m10;
+        pBonePose->mM11 = pBone->m11;
+        pBonePose->mWorldY = pBone->worldY;
+        pBonePose->mWorldRotation = pBone->worldRotation;
+        pBonePose->mWorldScaleX = pBone->worldScaleX;
+        pBonePose->mWorldScaleY = pBone->worldScaleY;
+    }
+
+    // Store the slot poses.
+    SlotPose* pSlotPose = pAnimationPoses->mSlotPoses.address() + ( frame * mpPoseSkeleton->slotCount );
+    for ( S32 i = 0; i < mpPoseSkeleton->slotCount; ++i, ++pSlotPose )
+    {
+        const spSlot* pSlot = mpPoseSkeleton->slots[i];
+        pSlotPose->mpAttachment = pSlot->attachment;
+        pSlotPose->mRed = pSlot->r;
+        pSlotPose->mGreen = pSlot->g;
+        pSlotPose->mBlue = pSlot->b;
+        pSlotPose->mAlpha = pSlot->a;
+    }
+
+    // Flag the frame as evaluated.
+    pAnimationPoses->mFrameEvaluated[frame] = true;
+}
+
+//-----------------------------------------------------------------------------
+
 void SkeletonAsset::onTamlPreWrite( void )
 {
     // Call parent.
@@ -41,12 +41,51 @@ DefineConsoleType( TypeSkeletonAssetPtr )
 
 //-----------------------------------------------------------------------------
 
+#define SKELETON_ASSET_DEFAULT_POSE_SAMPLE_RATE     30.0f
+#define SKELETON_ASSET_MAXIMUM_POSE_SAMPLE_RATE     240.0f
+
+//-----------------------------------------------------------------------------
+
 class SkeletonAsset : public AssetBase
 {
 private:
     typedef AssetBase Parent;
     bool                            mAtlasDirty;
 
+    /// Shared pose cache.
+    /// Evaluated skeleton poses are sampled at a fixed rate and shared by every skeleton playing the same
+    /// animation, skin and flipping so that crowds only evaluate each sampled pose once.
+    struct BonePose
+    {
+        F32                         mM00, mM01, mWorldX;
+        F32                         mM10, mM11, mWorldY;
+        F32                         mWorldRotation;
+        F32                         mWorldScaleX, mWorldScaleY;
+    };
+
+    struct SlotPose
+    {
+        spAttachment*               mpAttachment;
+        F32                         mRed, mGreen, mBlue, mAlpha;
+    };
+
+    struct AnimationPoses
+    {
+        spAnimation*                mpAnimation;
+        spSkin*                     mpSkin;
+        bool                        mFlipX;
+        bool                        mFlipY;
+        Vector<bool>                mFrameEvaluated;
+        Vector<BonePose>            mBonePoses;
+        Vector<SlotPose>            mSlotPoses;
+    };
+
+    typedef Vector<AnimationPoses*> typeAnimationPosesVector;
+
+    F32                             mPoseSampleRate;
+    spSkeleton*                     mpPoseSkeleton;
+    typeAnimationPosesVector        mAnimationPoses;
+
 public:
     StringTableEntry                mSkeletonFile;
     StringTableEntry                mAtlasFile;
@@ -73,6 +112,13 @@ public:
     
     virtual bool            isAssetValid( void ) const;
 
+    /// Shared pose cache.
+    void                    setPoseSampleRate( const F32 sampleRate );
+    inline F32              getPoseSampleRate( void ) const                 { return mPoseSampleRate; }
+    bool                    applyPose( spSkeleton* pSkeleton, const spAnimation* pAnimation, const F32 time, const bool loop );
+    bool                    bakePoses( const char* pAnimationName, const char* pSkinName );
+    void                    clearPoses( void );
+
     /// Declare Console Object.
     DECLARE_CONOBJECT(SkeletonAsset);
 
@@ -80,6 +126,9 @@ private:
     void buildAtlasData( void );
     void buildSkeletonData( void );
 
+    AnimationPoses* findAnimationPoses( const spAnimation* pAnimation, const spSkin* pSkin, const bool flipX, const bool flipY );
+    void evaluatePose( AnimationPoses* pAnimationPoses, const U32 frame );
+
 protected:
     virtual void initializeAsset( void );
     virtual void onAssetRefresh( void );
@@ -96,6 +145,8 @@ protected:
     static bool writeSkeletonFile( void* obj, StringTableEntry pFieldName ) { return static_cast<SkeletonAsset*>(obj)->getSkeletonFile() != StringTable->EmptyString; }
     static bool setAtlasFile( void* obj, const char* data )                 { static_cast<SkeletonAsset*>(obj)->setAtlasFile(data); return false; }
     static bool writeAtlasFile( void* obj, StringTableEntry pFieldName )    { return static_cast<SkeletonAsset*>(obj)->getAtlasFile() != StringTable->EmptyString; }
+    static bool setPoseSampleRate( void* obj, const char* data )            { static_cast<SkeletonAsset*>(obj)->setPoseSampleRate(dAtof(data)); return false; }
+    static bool writePoseSampleRate( void* obj, StringTableEntry pFieldName ) { return mNotEqual(static_cast<SkeletonAsset*>(obj)->getPoseSampleRate(), SKELETON_ASSET_DEFAULT_POSE_SAMPLE_RATE); }
 };
 
 #endif // _SKELETON_ASSET_H_
@@ -62,4 +62,47 @@ ConsoleMethodWithDocs(SkeletonAsset, getSkeletonFile, ConsoleString, 2, 2, ())
 
 //------------------------------------------------------------------------------
 
+/*! Sets the rate that shared skeleton poses are sampled at.
+    @param sampleRate The number of poses sampled per second.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SkeletonAsset, setPoseSampleRate, ConsoleVoid, 3, 3, (sampleRate))
+{
+    object->setPoseSampleRate( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the rate that shared skeleton poses are sampled at.
+    @return The number of poses sampled per second.
+*/
+ConsoleMethodWithDocs(SkeletonAsset, getPoseSampleRate, ConsoleFloat, 2, 2, ())
+{
+    return object->getPoseSampleRate();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Pre-bakes all the shared poses for the specified animation and optional skin.
+    @param animationName The animation to bake.
+    @param skinName The skin to bake.  Optional.
+    @return Whether the poses were baked or not.
+*/
+ConsoleMethodWithDocs(SkeletonAsset, bakePoses, ConsoleBool, 3, 4, (animationName, [skinName]))
+{
+    return object->bakePoses( argv[2], argc > 3 ? argv[3] : NULL );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Clears all the shared poses.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SkeletonAsset, clearPoses, ConsoleVoid, 2, 2, ())
+{
+    object->clearPoses();
+}
+
+//------------------------------------------------------------------------------
+
 ConsoleMethodGroupEndWithDocs(SkeletonAsset)
@@ -102,22 +102,24 @@ void BuoyancyController::copyTo(SimObject* object)
 */
 //------------------------------------------------------------------------------
 
-void BuoyancyController::integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
+bool BuoyancyController::getRegion( b2AABB& region, WorldQueryFilter& queryFilter )
 {
-    // Prepare query filter.
-    WorldQuery* pWorldQuery = prepareQueryFilter( pScene );
+    // Set the fluid area and query filter.
+    region = mFluidArea;
+    queryFilter = getQueryFilter();
 
-    // Query for candidate objects.
-    pWorldQuery->anyQueryAABB( mFluidArea ); 
+    return true;
+}
 
-    // Fetch results.
-    typeWorldQueryResultVector& queryResults = pWorldQuery->getQueryResults();
+//------------------------------------------------------------------------------
 
-    // Iterate the results.
-    for ( U32 n = 0; n < (U32)queryResults.size(); n++ )
+void BuoyancyController::integrateRegion( Scene* pScene, const F32 totalTime, const F32 elapsedTime, const typeWorldQueryResultVector& candidates, DebugStats* pDebugStats )
+{
+    // Iterate the candidates.
+    for ( U32 n = 0; n < (U32)candidates.size(); n++ )
     {
         // Fetch the scene object.
-        SceneObject* pSceneObject = queryResults[n].mpSceneObject;
+        SceneObject* pSceneObject = candidates[n].mpSceneObject;
 
         // Skip if asleep.
         if ( !pSceneObject->getAwake() )
@@ -73,8 +73,9 @@ public:
     static void initPersistFields();
     virtual void copyTo(SimObject* object);
 
-    /// Integration.
-    virtual void integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    /// Region integration.
+    virtual bool getRegion( b2AABB& region, WorldQueryFilter& queryFilter );
+    virtual void integrateRegion( Scene* pScene, const F32 totalTime, const F32 elapsedTime, const typeWorldQueryResultVector& candidates, DebugStats* pDebugStats );
 
     // Scene render.
     virtual void renderOverlay( Scene* pScene, const SceneRenderState* pSceneRenderState, BatchRender* pBatchRenderer );
@@ -94,31 +94,34 @@ void PointForceController::setTrackedObject( SceneObject* pSceneObject )
 
 //------------------------------------------------------------------------------
 
-void PointForceController::integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
+bool PointForceController::getRegion( b2AABB& region, WorldQueryFilter& queryFilter )
 {
     // Finish if the attractor would have no effect.
     if ( mIsZero( mForce ) || mIsZero( mRadius ) )
-        return;
-
-    // Prepare query filter.
-    WorldQuery* pWorldQuery = prepareQueryFilter( pScene );
+        return false;
 
     // Fetch the current position.
     const Vector2 currentPosition = getCurrentPosition();
 
     // Calculate the AABB of the attractor.
-    b2AABB aabb;
-    aabb.lowerBound.Set( currentPosition.x - mRadius, currentPosition.y - mRadius );
-    aabb.upperBound.Set( currentPosition.x + mRadius, currentPosition.y + mRadius );
+    region.lowerBound.Set( currentPosition.x - mRadius, currentPosition.y - mRadius );
+    region.upperBound.Set( currentPosition.x + mRadius, currentPosition.y + mRadius );
 
-    // Query for candidate objects.
-    pWorldQuery->anyQueryAABB( aabb ); 
+    // Set the query filter.
+    queryFilter = getQueryFilter();
 
-    // Fetch results.
-    typeWorldQueryResultVector& queryResults = pWorldQuery->getQueryResults();
+    return true;
+}
+
+//------------------------------------------------------------------------------
+
+void PointForceController::integrateRegion( Scene* pScene, const F32 totalTime, const F32 elapsedTime, const typeWorldQueryResultVector& candidates, DebugStats* pDebugStats )
+{
+    // Fetch the current position.
+    const Vector2 currentPosition = getCurrentPosition();
 
     // Fetch result count.
-    const U32 resultCount = (U32)queryResults.size();
+    const U32 resultCount = (U32)candidates.size();
 
     // Finish if nothing to process.
     if ( resultCount == 0 )
@@ -141,7 +144,7 @@ void PointForceController::integrate( Scene* pScene, const F32 totalTime, const
     for ( U32 n = 0; n < resultCount; n++ )
     {
         // Fetch the scene object.
-        SceneObject* pSceneObject = queryResults[n].mpSceneObject;
+        SceneObject* pSceneObject = candidates[n].mpSceneObject;
 
         // Ignore if it's the tracked object.
         if ( pSceneObject == pTrackedObject )
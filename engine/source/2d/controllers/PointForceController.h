@@ -89,8 +89,9 @@ public:
         return pSceneObject == NULL ? mPosition : b2Mul( pSceneObject->getTransform(), mPosition);
     }
 
-    /// Integration.
-    virtual void integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    /// Region integration.
+    virtual bool getRegion( b2AABB& region, WorldQueryFilter& queryFilter );
+    virtual void integrateRegion( Scene* pScene, const F32 totalTime, const F32 elapsedTime, const typeWorldQueryResultVector& candidates, DebugStats* pDebugStats );
 
     // Scene render.
     virtual void renderOverlay( Scene* pScene, const SceneRenderState* pSceneRenderState, BatchRender* pBatchRenderer );
@@ -65,14 +65,35 @@ void PickingSceneController::copyTo(SimObject* object)
 
 //------------------------------------------------------------------------------
 
+void PickingSceneController::integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
+{
+    // Fetch the controller region.
+    // NOTE:    The scene normally gathers the region candidates itself so this is only used when integrating directly.
+    b2AABB region;
+    WorldQueryFilter queryFilter;
+    if ( !getRegion( region, queryFilter ) )
+        return;
+
+    // Fetch world query and clear results.
+    WorldQuery* pWorldQuery = pScene->getWorldQuery( true );
+
+    // Query for candidate objects.
+    pWorldQuery->setQueryFilter( queryFilter );
+    pWorldQuery->anyQueryAABB( region );
+
+    // Integrate the candidates.
+    integrateRegion( pScene, totalTime, elapsedTime, pWorldQuery->getQueryResults(), pDebugStats );
+}
+
+//------------------------------------------------------------------------------
+
 WorldQuery* PickingSceneController::prepareQueryFilter( Scene* pScene, const bool clearQuery )
 {
     // Fetch world query and clear results.
     WorldQuery* pWorldQuery = pScene->getWorldQuery( clearQuery );
 
     // Set filter.
-    WorldQueryFilter queryFilter( mControlLayerMask, mControlGroupMask, true, false, true, true );
-    pWorldQuery->setQueryFilter( queryFilter );
+    pWorldQuery->setQueryFilter( getQueryFilter() );
 
     return pWorldQuery;
 }
@@ -59,9 +59,10 @@ public:
     inline U32 getControlGroupMask( void ) const { return mControlGroupMask; }
     inline void setControlLayerMask( const U32 layerMask ) { mControlLayerMask = layerMask; }
     inline U32 getControlLayerMask( void ) const { return mControlLayerMask; }
+    inline WorldQueryFilter getQueryFilter( void ) const { return WorldQueryFilter( mControlLayerMask, mControlGroupMask, true, false, true, true ); }
 
     /// Integration.
-    virtual void integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats ) {}
+    virtual void integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
 
     // Scene render.
     virtual void renderOverlay( Scene* pScene, const SceneRenderState* pSceneRenderState, BatchRender* pBatchRenderer ) {}
@@ -23,6 +23,14 @@
 #ifndef _SCENE_CONTROLLER_H_
 #define _SCENE_CONTROLLER_H_
 
+#ifndef _WORLD_QUERY_FILTER_H_
+#include "2d/scene/WorldQueryFilter.h"
+#endif
+
+#ifndef _WORLD_QUERY_RESULT_H_
+#include "2d/scene/WorldQueryResult.h"
+#endif
+
 //------------------------------------------------------------------------------
 
 class Scene;
@@ -41,6 +49,14 @@ public:
     /// Integration.
     virtual void integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats ) = 0;
 
+    /// Region.
+    /// NOTE:   A controller that returns a region is not integrated directly.  Instead the scene gathers the candidates
+    ///         for all controller regions in a single query and integrates the controller with its candidates.
+    virtual bool getRegion( b2AABB& region, WorldQueryFilter& queryFilter ) { return false; }
+
+    /// Region integration.
+    virtual void integrateRegion( Scene* pScene, const F32 totalTime, const F32 elapsedTime, const typeWorldQueryResultVector& candidates, DebugStats* pDebugStats ) {}
+
     // Scene render.
     virtual void renderOverlay( Scene* pScene, const SceneRenderState* pSceneRenderState, BatchRender* pBatchRenderer ) = 0;
 };
@@ -0,0 +1,211 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_CONTROLLER_SET_H_
+#include "2d/controllers/core/SceneControllerSet.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//------------------------------------------------------------------------------
+
+IMPLEMENT_CONOBJECT(SceneControllerSet);
+
+//------------------------------------------------------------------------------
+
+SceneControllerSet::SceneControllerSet()
+{
+    // Set Vector Associations.
+    VECTOR_SET_ASSOCIATION( mSceneControllers );
+    VECTOR_SET_ASSOCIATION( mControllerRegions );
+    VECTOR_SET_ASSOCIATION( mRegions );
+    VECTOR_SET_ASSOCIATION( mRegionQueryFilters );
+    VECTOR_SET_ASSOCIATION( mRegionCandidates );
+}
+
+//------------------------------------------------------------------------------
+
+void SceneControllerSet::onRemove( void )
+{
+    // Call parent.
+    Parent::onRemove();
+
+    // Clear the scene controllers.
+    mSceneControllers.clear();
+}
+
+//------------------------------------------------------------------------------
+
+void SceneControllerSet::addObject( SimObject* pObject )
+{
+    // Call parent.
+    Parent::addObject( pObject );
+
+    // Refresh the scene controllers.
+    refreshSceneControllers();
+}
+
+//------------------------------------------------------------------------------
+
+void SceneControllerSet::removeObject( SimObject* pObject )
+{
+    // Call parent.
+    Parent::removeObject( pObject );
+
+    // Refresh the scene controllers.
+    refreshSceneControllers();
+}
+
+//------------------------------------------------------------------------------
+
+void SceneControllerSet::pushObject( SimObject* pObject )
+{
+    // Call parent.
+    Parent::pushObject( pObject );
+
+    // Refresh the scene controllers.
+    refreshSceneControllers();
+}
+
+//------------------------------------------------------------------------------
+
+void SceneControllerSet::popObject( void )
+{
+    // Call parent.
+    Parent::popObject();
+
+    // Refresh the scene controllers.
+    refreshSceneControllers();
+}
+
+//------------------------------------------------------------------------------
+
+bool SceneControllerSet::reOrder( SimObject* pObject, SimObject* pTarget )
+{
+    // Call parent.
+    const bool reordered = Parent::reOrder( pObject, pTarget );
+
+    // Refresh the scene controllers.
+    refreshSceneControllers();
+
+    return reordered;
+}
+
+//------------------------------------------------------------------------------
+
+void SceneControllerSet::refreshSceneControllers( void )
+{
+    // Clear the scene controllers.
+    mSceneControllers.clear();
+
+    // Fetch the set size.
+    const U32 setSize = (U32)size();
+
+    // Add the scene controllers in set order.
+    for ( U32 index = 0; index < setSize; ++index )
+    {
+        // Fetch the scene controller.
+        SceneController* pController = dynamic_cast<SceneController*>( at(index) );
+
+        // Skip if not a controller.
+        if ( pController == NULL )
+            continue;
+
+        mSceneControllers.push_back( pController );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void SceneControllerSet::integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneControllerSet_Integrate);
+
+    // Fetch the scene controller count.
+    const U32 controllerCount = (U32)mSceneControllers.size();
+
+    // Finish if no scene controllers.
+    if ( controllerCount == 0 )
+        return;
+
+    // Reset the controller regions.
+    mControllerRegions.setSize( controllerCount );
+    mRegions.clear();
+    mRegionQueryFilters.clear();
+
+    // Gather the controller regions.
+    for ( U32 index = 0; index < controllerCount; ++index )
+    {
+        b2AABB region;
+        WorldQueryFilter queryFilter;
+
+        // Does the controller have a region?
+        if ( !mSceneControllers[index]->getRegion( region, queryFilter ) )
+        {
+            // No, so flag it as being integrated directly.
+            mControllerRegions[index] = -1;
+            continue;
+        }
+
+        // Add the region.
+        mControllerRegions[index] = mRegions.size();
+        mRegions.push_back( region );
+        mRegionQueryFilters.push_back( queryFilter );
+    }
+
+    // Query the candidates for all the regions.
+    if ( mRegions.size() > 0 )
+        pScene->getWorldQuery()->anyQueryRegions( mRegions, mRegionQueryFilters, mRegionCandidates );
+
+    // Integrate the scene controllers in set order.
+    for ( U32 index = 0; index < controllerCount; ++index )
+    {
+        // Fetch the scene controller.
+        SceneController* pController = mSceneControllers[index];
+
+        // Fetch the controller region.
+        const S32 regionIndex = mControllerRegions[index];
+
+        // Integrate.
+        if ( regionIndex == -1 )
+            pController->integrate( pScene, totalTime, elapsedTime, pDebugStats );
+        else
+            pController->integrateRegion( pScene, totalTime, elapsedTime, mRegionCandidates[regionIndex], pDebugStats );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void SceneControllerSet::renderOverlay( Scene* pScene, const SceneRenderState* pSceneRenderState, BatchRender* pBatchRenderer )
+{
+    // Render the scene controller overlays.
+    for ( U32 index = 0; index < (U32)mSceneControllers.size(); ++index )
+    {
+        mSceneControllers[index]->renderOverlay( pScene, pSceneRenderState, pBatchRenderer );
+    }
+}
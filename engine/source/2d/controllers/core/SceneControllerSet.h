@@ -0,0 +1,79 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_CONTROLLER_SET_H_
+#define _SCENE_CONTROLLER_SET_H_
+
+#ifndef _SIMSET_H_
+#include "sim/simSet.h"
+#endif
+
+#ifndef _SCENE_CONTROLLER_H_
+#include "2d/controllers/core/SceneController.h"
+#endif
+
+//------------------------------------------------------------------------------
+
+class SceneControllerSet : public SimSet
+{
+    typedef SimSet Parent;
+
+private:
+    typedef Vector<SceneController*> typeSceneControllerVector;
+
+    /// Scene controllers in set order.
+    typeSceneControllerVector mSceneControllers;
+
+    /// Controller regions.
+    Vector<S32> mControllerRegions;
+    Vector<b2AABB> mRegions;
+    Vector<WorldQueryFilter> mRegionQueryFilters;
+    Vector<typeWorldQueryResultVector> mRegionCandidates;
+
+    void refreshSceneControllers( void );
+
+public:
+    SceneControllerSet();
+    virtual ~SceneControllerSet() {}
+
+    virtual void onRemove( void );
+
+    virtual void addObject( SimObject* pObject );
+    virtual void removeObject( SimObject* pObject );
+    virtual void pushObject( SimObject* pObject );
+    virtual void popObject( void );
+    virtual bool reOrder( SimObject* pObject, SimObject* pTarget = 0 );
+
+    inline U32 getSceneControllerCount( void ) const { return (U32)mSceneControllers.size(); }
+    inline SceneController* getSceneController( const U32 index ) const { return mSceneControllers[index]; }
+
+    /// Integration.
+    void integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+
+    // Scene render.
+    void renderOverlay( Scene* pScene, const SceneRenderState* pSceneRenderState, BatchRender* pBatchRenderer );
+
+    /// Declare Console Object.
+    DECLARE_CONOBJECT( SceneControllerSet );
+};
+
+#endif // _SCENE_CONTROLLER_SET_H_
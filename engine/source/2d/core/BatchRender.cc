@@ -26,12 +26,34 @@
 #include "2d/sceneobject/SceneObject.h"
 #endif
 
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+// Script bindings.
+#include "BatchRender_ScriptBinding.h"
+
+// SIMD quad transforms.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BATCHRENDER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define BATCHRENDER_NEON
+#include <arm_neon.h>
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
 //-----------------------------------------------------------------------------
 
 BatchRender::BatchRender() :
+    mpVertexBuffer( NULL ),
+    mpTextureBuffer( NULL ),
+    mpIndexBuffer( NULL ),
+    mpColorBuffer( NULL ),
+    mBufferSize( BATCHRENDER_BUFFERSIZE ),
+    mMaxTriangles( BATCHRENDER_BUFFERSIZE/3 ),
     mTriangleCount( 0 ),
     mVertexCount( 0 ),
     mTextureCoordCount( 0 ),
@@ -46,8 +68,16 @@ BatchRender::BatchRender() :
     mBlendColor( ColorF(1.0f,1.0f,1.0f,1.0f) ),
     mAlphaTestMode( -1.0f ),
     mWireframeMode( false ),
-    mBatchEnabled( true )
+    mBatchEnabled( true ),
+    mRetainedMode( false ),
+    mpRetainedVertexBuffer( NULL ),
+    mVertexBufferObject( 0 ),
+    mIndexBufferObject( 0 ),
+    mRenderStateValid( false )
 {
+    // Set the configured buffer size.
+    // NOTE: The buffers are only allocated when first used.
+    setBufferSize( (U32)getMax( Con::getIntVariable( "$pref::T2D::batchRenderBufferSize", BATCHRENDER_BUFFERSIZE ), 0 ) );
 }
 
 //-----------------------------------------------------------------------------
@@ -67,6 +97,77 @@ BatchRender::~BatchRender()
         delete (*itr);
     }
     mIndexVectorPool.clear();
+
+#ifdef BATCHRENDER_RETAINED
+    // Destroy the retained buffers.
+    if ( mVertexBufferObject != 0 )
+    {
+        glDeleteBuffersARB( 1, &mVertexBufferObject );
+        glDeleteBuffersARB( 1, &mIndexBufferObject );
+    }
+#endif
+
+    // Destroy the buffers.
+    freeBuffers();
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::setBufferSize( const U32 bufferSize )
+{
+    // Clamp the buffer size.
+    const U32 clampedBufferSize = mClamp( bufferSize, BATCHRENDER_BUFFERSIZE, BATCHRENDER_MAXBUFFERSIZE );
+
+    // Warn if the buffer size was clamped.
+    if ( clampedBufferSize != bufferSize )
+    {
+        Con::warnf( "BatchRender::setBufferSize() - Buffer size of %d is invalid; using %d.  The range is %d to %d.",
+            bufferSize, clampedBufferSize, BATCHRENDER_BUFFERSIZE, BATCHRENDER_MAXBUFFERSIZE );
+    }
+
+    // Ignore no change.
+    if ( clampedBufferSize == mBufferSize )
+        return;
+
+    // Flush.
+    flushInternal();
+
+    // Free the buffers.
+    // NOTE: They will be allocated at the new size when next used.
+    freeBuffers();
+
+    mBufferSize = clampedBufferSize;
+    mMaxTriangles = mBufferSize / 3;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::allocateBuffers( void )
+{
+    // Sanity!
+    AssertFatal( mpVertexBuffer == NULL, "BatchRender::allocateBuffers() - Buffers are already allocated." );
+
+    mpVertexBuffer = new Vector2[mBufferSize];
+    mpTextureBuffer = new Vector2[mBufferSize];
+    mpIndexBuffer = new batchIndexType[mBufferSize];
+    mpColorBuffer = new ColorF[mBufferSize];
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::freeBuffers( void )
+{
+    delete [] mpVertexBuffer;
+    delete [] mpTextureBuffer;
+    delete [] mpIndexBuffer;
+    delete [] mpColorBuffer;
+    delete [] mpRetainedVertexBuffer;
+
+    mpVertexBuffer = NULL;
+    mpTextureBuffer = NULL;
+    mpIndexBuffer = NULL;
+    mpColorBuffer = NULL;
+    mpRetainedVertexBuffer = NULL;
 }
 
 //-----------------------------------------------------------------------------
@@ -112,13 +213,17 @@ void BatchRender::SubmitTriangles(
     // Sanity!
     AssertFatal( mpDebugStats != NULL, "Debug stats have not been configured." );
     AssertFatal( vertexCount % 3 == 0, "BatchRender::SubmitTriangles() - Invalid vertex count, cannot represent whole triangles." );
-    AssertFatal( vertexCount <= BATCHRENDER_BUFFERSIZE, "BatchRender::SubmitTriangles() - Invalid vertex count." );
+    AssertFatal( vertexCount <= mBufferSize, "BatchRender::SubmitTriangles() - Invalid vertex count." );
+
+    // Allocate the buffers if required.
+    if ( mpVertexBuffer == NULL )
+        allocateBuffers();
 
     // Calculate triangle count.
     const U32 triangleCount = vertexCount / 3;
 
     // Would we exceed the triangle buffer size?
-    if ( (mTriangleCount + triangleCount) > BATCHRENDER_MAXTRIANGLES )
+    if ( (mTriangleCount + triangleCount) > mMaxTriangles )
     {
         // Yes, so flush.
         flush( mpDebugStats->batchBufferFullFlush );
@@ -152,14 +257,14 @@ void BatchRender::SubmitTriangles(
         }
 
         // Fetch vertex index.
-        U16 vertexIndex = (U16)mVertexCount;
+        batchIndexType vertexIndex = (batchIndexType)mVertexCount;
 
         // Add new indices.
         for( U32 n = 0; n < triangleCount; ++n )
         {
-            mIndexBuffer[mIndexCount++] = vertexIndex++;
-            mIndexBuffer[mIndexCount++] = vertexIndex++;
-            mIndexBuffer[mIndexCount++] = vertexIndex++;
+            mpIndexBuffer[mIndexCount++] = vertexIndex++;
+            mpIndexBuffer[mIndexCount++] = vertexIndex++;
+            mpIndexBuffer[mIndexCount++] = vertexIndex++;
         }
 
         // Set strict order mode texture handle.
@@ -177,21 +282,21 @@ void BatchRender::SubmitTriangles(
         // Yes, so add colors.
         for( U32 n = 0; n < triangleCount; ++n )
         {
-            mColorBuffer[mColorCount++] = color;
-            mColorBuffer[mColorCount++] = color;
-            mColorBuffer[mColorCount++] = color;
+            mpColorBuffer[mColorCount++] = color;
+            mpColorBuffer[mColorCount++] = color;
+            mpColorBuffer[mColorCount++] = color;
         }
     }
 
     // Add textured vertices.
     for( U32 n = 0; n < triangleCount; ++n )
     {
-        mVertexBuffer[mVertexCount++]   = *(pVertexArray++);
-        mVertexBuffer[mVertexCount++]   = *(pVertexArray++);
-        mVertexBuffer[mVertexCount++]   = *(pVertexArray++);
-        mTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
-        mTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
-        mTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
+        mpVertexBuffer[mVertexCount++]   = *(pVertexArray++);
+        mpVertexBuffer[mVertexCount++]   = *(pVertexArray++);
+        mpVertexBuffer[mVertexCount++]   = *(pVertexArray++);
+        mpTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
+        mpTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
+        mpTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
     }
 
     // Stats.
@@ -201,7 +306,7 @@ void BatchRender::SubmitTriangles(
     mTriangleCount += triangleCount;
 
     // Have we reached the buffer limit?
-    if ( mTriangleCount == BATCHRENDER_MAXTRIANGLES )
+    if ( mTriangleCount == mMaxTriangles )
     {
         // Yes, so flush.
         flush( mpDebugStats->batchBufferFullFlush );
@@ -236,8 +341,12 @@ void BatchRender::SubmitQuad(
     // Debug Profiling.
     PROFILE_SCOPE(BatchRender_SubmitQuad);
 
+    // Allocate the buffers if required.
+    if ( mpVertexBuffer == NULL )
+        allocateBuffers();
+
     // Would we exceed the triangle buffer size?
-    if ( (mTriangleCount + 2) > BATCHRENDER_MAXTRIANGLES )
+    if ( (mTriangleCount + 2) > mMaxTriangles )
     {
         // Yes, so flush.
         flush( mpDebugStats->batchBufferFullFlush );
@@ -271,12 +380,12 @@ void BatchRender::SubmitQuad(
         }
 
         // Add new indices.
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount++;
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount++;
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount++;
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount--;
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount--;
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount--;
+        mpIndexBuffer[mIndexCount++] = (batchIndexType)mVertexCount++;
+        mpIndexBuffer[mIndexCount++] = (batchIndexType)mVertexCount++;
+        mpIndexBuffer[mIndexCount++] = (batchIndexType)mVertexCount++;
+        mpIndexBuffer[mIndexCount++] = (batchIndexType)mVertexCount--;
+        mpIndexBuffer[mIndexCount++] = (batchIndexType)mVertexCount--;
+        mpIndexBuffer[mIndexCount++] = (batchIndexType)mVertexCount--;
 
         // Set strict order mode texture handle.
         mStrictOrderTextureHandle = texture;
@@ -291,22 +400,22 @@ void BatchRender::SubmitQuad(
     if ( color != NoColor )
     {
         // Yes, so add colors.
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
+        mpColorBuffer[mColorCount++] = color;
+        mpColorBuffer[mColorCount++] = color;
+        mpColorBuffer[mColorCount++] = color;
+        mpColorBuffer[mColorCount++] = color;
     }
 
     // Add textured vertices.
     // NOTE: We swap #2/#3 here.
-    mVertexBuffer[mVertexCount++]   = vertexPos0;
-    mVertexBuffer[mVertexCount++]   = vertexPos1;
-    mVertexBuffer[mVertexCount++]   = vertexPos3;
-    mVertexBuffer[mVertexCount++]   = vertexPos2;
-    mTextureBuffer[mTextureCoordCount++] = texturePos0;
-    mTextureBuffer[mTextureCoordCount++] = texturePos1;
-    mTextureBuffer[mTextureCoordCount++] = texturePos3;
-    mTextureBuffer[mTextureCoordCount++] = texturePos2;
+    mpVertexBuffer[mVertexCount++]   = vertexPos0;
+    mpVertexBuffer[mVertexCount++]   = vertexPos1;
+    mpVertexBuffer[mVertexCount++]   = vertexPos3;
+    mpVertexBuffer[mVertexCount++]   = vertexPos2;
+    mpTextureBuffer[mTextureCoordCount++] = texturePos0;
+    mpTextureBuffer[mTextureCoordCount++] = texturePos1;
+    mpTextureBuffer[mTextureCoordCount++] = texturePos3;
+    mpTextureBuffer[mTextureCoordCount++] = texturePos2;
 
     // Stats.
     mpDebugStats->batchTrianglesSubmitted+=2;
@@ -315,7 +424,7 @@ void BatchRender::SubmitQuad(
     mTriangleCount += 2;
 
     // Have we reached the buffer limit?
-    if ( mTriangleCount == BATCHRENDER_MAXTRIANGLES )
+    if ( mTriangleCount == mMaxTriangles )
     {
         // Yes, so flush.
         flush( mpDebugStats->batchBufferFullFlush );
@@ -332,136 +441,427 @@ void BatchRender::SubmitQuad(
 
 //-----------------------------------------------------------------------------
 
-void BatchRender::flush( U32& reasonMetric )
+void BatchRender::SubmitQuads(
+        const U32 quadCount,
+        const BatchQuad* pQuads,
+        const Vector2* pLocalQuad,
+        TextureHandle& texture,
+        const bool useColor )
 {
-    // Finish if no triangles to flush.
-    if ( mTriangleCount == 0 )
+    // Sanity!
+    AssertFatal( mpDebugStats != NULL, "Debug stats have not been configured." );
+    AssertFatal( pQuads != NULL && pLocalQuad != NULL, "BatchRender::SubmitQuads() - Invalid quads." );
+
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchRender_SubmitQuads);
+
+    // Finish if no quads.
+    if ( quadCount == 0 )
         return;
 
-    // Increase reason metric.
-    reasonMetric++;
+    // Prepare the quads.
+    prepareQuads( useColor, texture );
 
-    // Flush.
-    flushInternal();
+    // Submit the quads in runs that fit into the buffer.
+    U32 quadIndex = 0;
+    while( quadIndex < quadCount )
+    {
+        // Fetch the quads available in the buffer.
+        const U32 runCount = allocateQuadRun( quadCount - quadIndex );
+
+        // Add the quad run.
+        addQuadRun( runCount, texture );
+
+        // Write the quads.
+        writeQuads( runCount, pQuads + quadIndex, pLocalQuad, useColor );
+
+        quadIndex += runCount;
+    }
+
+    // Finish the quads.
+    finishQuads();
 }
 
 //-----------------------------------------------------------------------------
 
-void BatchRender::flush( void )
+void BatchRender::SubmitQuads(
+        const U32 quadCount,
+        const Vector2* pVertexArray,
+        const Vector2* pTextureArray,
+        const ColorF* pColorArray,
+        TextureHandle& texture )
 {
-    // Finish if no triangles to flush.
-    if ( mTriangleCount == 0 )
+    // Sanity!
+    AssertFatal( mpDebugStats != NULL, "Debug stats have not been configured." );
+    AssertFatal( pVertexArray != NULL && pTextureArray != NULL, "BatchRender::SubmitQuads() - Invalid quads." );
+
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchRender_SubmitTransformedQuads);
+
+    // Finish if no quads.
+    if ( quadCount == 0 )
         return;
 
-    // Increase reason metric.
-    mpDebugStats->batchAnonymousFlush++;
+    // Prepare the quads.
+    prepareQuads( pColorArray != NULL, texture );
 
-    // Flush.
-    flushInternal();
+    // Submit the quads in runs that fit into the buffer.
+    U32 quadIndex = 0;
+    while( quadIndex < quadCount )
+    {
+        // Fetch the quads available in the buffer.
+        const U32 runCount = allocateQuadRun( quadCount - quadIndex );
+
+        // Add the quad run.
+        addQuadRun( runCount, texture );
+
+        // Write the quads.
+        const U32 vertexIndex = quadIndex * 4;
+        writeQuads( runCount, pVertexArray + vertexIndex, pTextureArray + vertexIndex, pColorArray == NULL ? NULL : pColorArray + vertexIndex );
+
+        quadIndex += runCount;
+    }
+
+    // Finish the quads.
+    finishQuads();
 }
 
 //-----------------------------------------------------------------------------
 
-void BatchRender::flushInternal( void )
+void BatchRender::prepareQuads( const bool useColor, TextureHandle& texture )
 {
-    // Debug Profiling.
-    PROFILE_SCOPE(T2D_BatchRender_flush);
+    // Allocate the buffers if required.
+    if ( mpVertexBuffer == NULL )
+        allocateBuffers();
 
-    // Finish if no triangles to flush.
-    if ( mTriangleCount == 0 )
-        return;
+    // Do we have anything batched?
+    if ( mTriangleCount > 0 )
+    {
+        // Yes, so do we have any existing colors?
+        if ( mColorCount == 0 )
+        {
+            // No, so flush if color is specified.
+            if ( useColor )
+                flush( mpDebugStats->batchColorStateFlush );
+        }
+        else
+        {
+            // Yes, so flush if color is not specified.
+            if ( !useColor )
+                flush( mpDebugStats->batchColorStateFlush );
+        }
+    }
 
-    // Stats.
-    mpDebugStats->batchFlushes++;
+    // Is there a texture change in strict order mode?
+    if ( mStrictOrderMode && texture != mStrictOrderTextureHandle && mTriangleCount > 0 )
+    {
+        // Yes, so flush.
+        flush( mpDebugStats->batchTextureChangeFlush );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 BatchRender::allocateQuadRun( const U32 quadCount )
+{
+    // Fetch the quads available in the buffer.
+    U32 runCount = (mMaxTriangles - mTriangleCount) / 2;
+
+    // Flush if the buffer is full.
+    if ( runCount == 0 )
+    {
+        flush( mpDebugStats->batchBufferFullFlush );
+        runCount = mMaxTriangles / 2;
+    }
+
+    // Clamp the run to the quads requested.
+    return getMin( runCount, quadCount );
+}
+
+//-----------------------------------------------------------------------------
 
-    if ( mWireframeMode )
+void BatchRender::addQuadRun( const U32 quadCount, TextureHandle& texture )
+{
+    // Strict order mode?
+    if ( mStrictOrderMode )
     {
-        // Disable texturing.    
-        glDisable( GL_TEXTURE_2D );
+        // Yes, so fetch vertex index.
+        batchIndexType vertexIndex = (batchIndexType)mVertexCount;
 
-        // Set the polygon mode to line.
-        glPolygonMode( GL_FRONT_AND_BACK, GL_LINE );
+        // Add new indices.
+        batchIndexType* pIndex = mpIndexBuffer + mIndexCount;
+        for( U32 n = 0; n < quadCount; ++n, vertexIndex += 4, pIndex += 6 )
+        {
+            pIndex[0] = vertexIndex;
+            pIndex[1] = vertexIndex+1;
+            pIndex[2] = vertexIndex+2;
+            pIndex[3] = vertexIndex+3;
+            pIndex[4] = vertexIndex+2;
+            pIndex[5] = vertexIndex+1;
+        }
+        mIndexCount += quadCount * 6;
+
+        // Set strict order mode texture handle.
+        mStrictOrderTextureHandle = texture;
     }
     else
     {
-        // Enable texturing.    
-        glEnable( GL_TEXTURE_2D );
-        glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE );
-
-        // Set the polygon mode to fill.
-        glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
+        // No, so add triangle run.
+        findTextureBatch( texture )->push_back( TriangleRun( TriangleRun::QUAD, quadCount, mVertexCount ) );
     }
 
-    // Set blend mode.
-    if ( mBlendMode )
+    // Stats.
+    mpDebugStats->batchTrianglesSubmitted += quadCount * 2;
+
+    // Increase triangle count.
+    mTriangleCount += quadCount * 2;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::finishQuads( void )
+{
+    // Have we reached the buffer limit?
+    if ( mTriangleCount == mMaxTriangles )
     {
-        glEnable( GL_BLEND );
-        glBlendFunc( mSrcBlendFactor, mDstBlendFactor );
-        glColor4f(mBlendColor.red, mBlendColor.green, mBlendColor.blue, mBlendColor.alpha );
+        // Yes, so flush.
+        flush( mpDebugStats->batchBufferFullFlush );
     }
-    else
+    // Is batching enabled?
+    else if ( !mBatchEnabled )
     {
-        glDisable( GL_BLEND );
-        glColor4f( 1.0f, 1.0f, 1.0f, 1.0f );
+        // No, so flush immediately.
+        flushInternal();
     }
+}
 
-    // Set alpha-blend mode.
-    if ( mAlphaTestMode >= 0.0f )
+//-----------------------------------------------------------------------------
+
+void BatchRender::writeQuads( const U32 quadCount, const BatchQuad* pQuads, const Vector2* pLocalQuad, const bool useColor )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchRender_WriteQuads);
+
+    // Fetch the buffer positions.
+    Vector2* pVertex = mpVertexBuffer + mVertexCount;
+    Vector2* pTexture = mpTextureBuffer + mTextureCoordCount;
+
+    // NOTE: We swap #2/#3 here as "SubmitQuad" does.
+
+#if defined(BATCHRENDER_SSE2)
+    // Fetch the local quad.
+    const __m128 localX = _mm_setr_ps( pLocalQuad[0].x, pLocalQuad[1].x, pLocalQuad[3].x, pLocalQuad[2].x );
+    const __m128 localY = _mm_setr_ps( pLocalQuad[0].y, pLocalQuad[1].y, pLocalQuad[3].y, pLocalQuad[2].y );
+
+    for( U32 n = 0; n < quadCount; ++n, pVertex += 4, pTexture += 4 )
     {
-        glEnable( GL_ALPHA_TEST );
-        glAlphaFunc( GL_GREATER, mAlphaTestMode );
+        const BatchQuad& quad = pQuads[n];
+
+        // Scale the local quad.
+        const __m128 scaledX = _mm_mul_ps( localX, _mm_set1_ps( quad.mScale.x ) );
+        const __m128 scaledY = _mm_mul_ps( localY, _mm_set1_ps( quad.mScale.y ) );
+
+        // Rotate and translate.
+        const __m128 rotationCos = _mm_set1_ps( quad.mRotation.c );
+        const __m128 rotationSin = _mm_set1_ps( quad.mRotation.s );
+        const __m128 worldX = _mm_add_ps( _mm_set1_ps( quad.mPosition.x ), _mm_sub_ps( _mm_mul_ps( rotationCos, scaledX ), _mm_mul_ps( rotationSin, scaledY ) ) );
+        const __m128 worldY = _mm_add_ps( _mm_set1_ps( quad.mPosition.y ), _mm_add_ps( _mm_mul_ps( rotationSin, scaledX ), _mm_mul_ps( rotationCos, scaledY ) ) );
+
+        // Interleave the vertices.
+        _mm_storeu_ps( &pVertex[0].x, _mm_unpacklo_ps( worldX, worldY ) );
+        _mm_storeu_ps( &pVertex[2].x, _mm_unpackhi_ps( worldX, worldY ) );
+
+        // Expand the texel area of (lower-x, lower-y, upper-x, upper-y).
+        const __m128 texelArea = _mm_setr_ps( quad.mTexelLower.x, quad.mTexelLower.y, quad.mTexelUpper.x, quad.mTexelUpper.y );
+        _mm_storeu_ps( &pTexture[0].x, _mm_shuffle_ps( texelArea, texelArea, _MM_SHUFFLE(3,2,3,0) ) );
+        _mm_storeu_ps( &pTexture[2].x, _mm_shuffle_ps( texelArea, texelArea, _MM_SHUFFLE(1,2,1,0) ) );
     }
-    else
+#elif defined(BATCHRENDER_NEON)
+    // Fetch the local quad.
+    const F32 localQuadX[4] = { pLocalQuad[0].x, pLocalQuad[1].x, pLocalQuad[3].x, pLocalQuad[2].x };
+    const F32 localQuadY[4] = { pLocalQuad[0].y, pLocalQuad[1].y, pLocalQuad[3].y, pLocalQuad[2].y };
+    const float32x4_t localX = vld1q_f32( localQuadX );
+    const float32x4_t localY = vld1q_f32( localQuadY );
+
+    for( U32 n = 0; n < quadCount; ++n, pVertex += 4, pTexture += 4 )
+    {
+        const BatchQuad& quad = pQuads[n];
+
+        // Scale the local quad.
+        const float32x4_t scaledX = vmulq_n_f32( localX, quad.mScale.x );
+        const float32x4_t scaledY = vmulq_n_f32( localY, quad.mScale.y );
+
+        // Rotate and translate.
+        const float32x4_t worldX = vaddq_f32( vdupq_n_f32( quad.mPosition.x ), vsubq_f32( vmulq_n_f32( scaledX, quad.mRotation.c ), vmulq_n_f32( scaledY, quad.mRotation.s ) ) );
+        const float32x4_t worldY = vaddq_f32( vdupq_n_f32( quad.mPosition.y ), vaddq_f32( vmulq_n_f32( scaledX, quad.mRotation.s ), vmulq_n_f32( scaledY, quad.mRotation.c ) ) );
+
+        // Interleave the vertices.
+        const float32x4x2_t worldXY = vzipq_f32( worldX, worldY );
+        vst1q_f32( &pVertex[0].x, worldXY.val[0] );
+        vst1q_f32( &pVertex[2].x, worldXY.val[1] );
+
+        // Expand the texel area.
+        pTexture[0].Set( quad.mTexelLower.x, quad.mTexelUpper.y );
+        pTexture[1].Set( quad.mTexelUpper.x, quad.mTexelUpper.y );
+        pTexture[2].Set( quad.mTexelLower.x, quad.mTexelLower.y );
+        pTexture[3].Set( quad.mTexelUpper.x, quad.mTexelLower.y );
+    }
+#else
+    // Fetch the local quad.
+    const Vector2& local0 = pLocalQuad[0];
+    const Vector2& local1 = pLocalQuad[1];
+    const Vector2& local2 = pLocalQuad[2];
+    const Vector2& local3 = pLocalQuad[3];
+
+    for( U32 n = 0; n < quadCount; ++n, pVertex += 4, pTexture += 4 )
+    {
+        const BatchQuad& quad = pQuads[n];
+
+        // Scale the local quad.
+        const Vector2 scaled0 = local0 * quad.mScale;
+        const Vector2 scaled1 = local1 * quad.mScale;
+        const Vector2 scaled2 = local2 * quad.mScale;
+        const Vector2 scaled3 = local3 * quad.mScale;
+
+        // Rotate and translate.
+        const F32 c = quad.mRotation.c;
+        const F32 s = quad.mRotation.s;
+        pVertex[0].Set( quad.mPosition.x + (c * scaled0.x) - (s * scaled0.y), quad.mPosition.y + (s * scaled0.x) + (c * scaled0.y) );
+        pVertex[1].Set( quad.mPosition.x + (c * scaled1.x) - (s * scaled1.y), quad.mPosition.y + (s * scaled1.x) + (c * scaled1.y) );
+        pVertex[2].Set( quad.mPosition.x + (c * scaled3.x) - (s * scaled3.y), quad.mPosition.y + (s * scaled3.x) + (c * scaled3.y) );
+        pVertex[3].Set( quad.mPosition.x + (c * scaled2.x) - (s * scaled2.y), quad.mPosition.y + (s * scaled2.x) + (c * scaled2.y) );
+
+        // Expand the texel area.
+        pTexture[0].Set( quad.mTexelLower.x, quad.mTexelUpper.y );
+        pTexture[1].Set( quad.mTexelUpper.x, quad.mTexelUpper.y );
+        pTexture[2].Set( quad.mTexelLower.x, quad.mTexelLower.y );
+        pTexture[3].Set( quad.mTexelUpper.x, quad.mTexelLower.y );
+    }
+#endif
+
+    // Add colors if specified.
+    if ( useColor )
     {
-        glDisable( GL_ALPHA_TEST );
+        ColorF* pColor = mpColorBuffer + mColorCount;
+        for( U32 n = 0; n < quadCount; ++n, pColor += 4 )
+        {
+            const ColorF& color = pQuads[n].mColor;
+            pColor[0] = color;
+            pColor[1] = color;
+            pColor[2] = color;
+            pColor[3] = color;
+        }
+        mColorCount += quadCount * 4;
     }
 
-    // Enable vertex and texture arrays.
-    glEnableClientState( GL_VERTEX_ARRAY );
-    glVertexPointer( 2, GL_FLOAT, 0, mVertexBuffer );
-    glTexCoordPointer( 2, GL_FLOAT, 0, mTextureBuffer );
+    // Increase the vertex counts.
+    mVertexCount += quadCount * 4;
+    mTextureCoordCount += quadCount * 4;
+}
 
-    // Use the texture coordinates if not in wireframe mode.
-    if ( !mWireframeMode )
-        glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+//-----------------------------------------------------------------------------
 
-    // Do we have any colors?
-    if ( mColorCount > 0 )
+void BatchRender::writeQuads( const U32 quadCount, const Vector2* pVertexArray, const Vector2* pTextureArray, const ColorF* pColorArray )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchRender_WriteTransformedQuads);
+
+    // Fetch the buffer positions.
+    Vector2* pVertex = mpVertexBuffer + mVertexCount;
+    Vector2* pTexture = mpTextureBuffer + mTextureCoordCount;
+
+    // NOTE: We swap #2/#3 here as "SubmitQuad" does.
+    for( U32 n = 0; n < quadCount; ++n, pVertex += 4, pTexture += 4, pVertexArray += 4, pTextureArray += 4 )
     {
-        // Yes, so enable color array.
-        glEnableClientState( GL_COLOR_ARRAY );
-        glColorPointer( 4, GL_FLOAT, 0, mColorBuffer );
+        pVertex[0] = pVertexArray[0];
+        pVertex[1] = pVertexArray[1];
+        pVertex[2] = pVertexArray[3];
+        pVertex[3] = pVertexArray[2];
+        pTexture[0] = pTextureArray[0];
+        pTexture[1] = pTextureArray[1];
+        pTexture[2] = pTextureArray[3];
+        pTexture[3] = pTextureArray[2];
     }
 
-    // Strict order mode?
-    if ( mStrictOrderMode )
+    // Add colors if specified.
+    if ( pColorArray != NULL )
     {
-        // Bind the texture if not in wireframe mode.
-        if ( !mWireframeMode )
-            glBindTexture( GL_TEXTURE_2D, mStrictOrderTextureHandle.getGLName() );
+        ColorF* pColor = mpColorBuffer + mColorCount;
+        for( U32 n = 0; n < quadCount; ++n, pColor += 4, pColorArray += 4 )
+        {
+            pColor[0] = pColorArray[0];
+            pColor[1] = pColorArray[1];
+            pColor[2] = pColorArray[3];
+            pColor[3] = pColorArray[2];
+        }
+        mColorCount += quadCount * 4;
+    }
 
-        // Draw the triangles
-        glDrawElements( GL_TRIANGLES, mIndexCount, GL_UNSIGNED_SHORT, mIndexBuffer );
+    // Increase the vertex counts.
+    mVertexCount += quadCount * 4;
+    mTextureCoordCount += quadCount * 4;
+}
 
-        // Stats.
-        mpDebugStats->batchDrawCallsStrict++;
+//-----------------------------------------------------------------------------
 
-        // Stats.
-        const U32 trianglesDrawn = mIndexCount / 3;
-        if ( trianglesDrawn > mpDebugStats->batchMaxTriangleDrawn )
-            mpDebugStats->batchMaxTriangleDrawn = trianglesDrawn;
+void BatchRender::flush( U32& reasonMetric )
+{
+    // Finish if no triangles to flush.
+    if ( mTriangleCount == 0 )
+        return;
 
-        // Stats.
-        if ( mVertexCount > mpDebugStats->batchMaxVertexBuffer )
-            mpDebugStats->batchMaxVertexBuffer = mVertexCount;
+    // Increase reason metric.
+    reasonMetric++;
+
+    // Flush.
+    flushInternal();
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::flush( void )
+{
+    // Finish if no triangles to flush.
+    if ( mTriangleCount == 0 )
+        return;
+
+    // Increase reason metric.
+    mpDebugStats->batchAnonymousFlush++;
+
+    // Flush.
+    flushInternal();
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::flushInternal( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(T2D_BatchRender_flush);
+
+    // Finish if no triangles to flush.
+    if ( mTriangleCount == 0 )
+        return;
+
+    // Stats.
+    mpDebugStats->batchFlushes++;
+
+    // Strict order mode?
+    if ( mStrictOrderMode )
+    {
+        // Yes, so draw the indices in submission order.
+        mTextureDraws.push_back( TextureDraw( mStrictOrderTextureHandle.getGLName(), 0, mIndexCount ) );
     }
     else
     {
-        // No, so iterate texture batch map.
+        // No, so reset index count.
+        mIndexCount = 0;
+
+        // Iterate texture batch map.
         for( textureBatchType::iterator batchItr = mTextureBatchMap.begin(); batchItr != mTextureBatchMap.end(); ++batchItr )
         {
-            // Reset index count.
-            mIndexCount = 0;
+            // Fetch start index.
+            const U32 startIndex = mIndexCount;
 
             // Fetch index vector.
             indexVectorType* pIndexVector = batchItr->value;
@@ -476,7 +876,7 @@ void BatchRender::flushInternal( void )
                 const U32 primitiveCount = triangleRun.mPrimitiveCount;
 
                 // Fetch triangle index start.
-                U16 triangleIndex = (U16)triangleRun.mStartIndex;
+                batchIndexType triangleIndex = (batchIndexType)triangleRun.mStartIndex;
 
                 // Fetch primitive mode.
                 const TriangleRun::PrimitiveMode& primitiveMode = triangleRun.mPrimitiveMode;
@@ -484,16 +884,17 @@ void BatchRender::flushInternal( void )
                 // Handle primitive mode.
                 if ( primitiveMode == TriangleRun::QUAD )
                 {
-                    // Add triangle run for quad.
-                    for( U32 n = 0; n < primitiveCount; ++n )
+                    // Add triangle run for quads.
+                    // NOTE: A run can hold many quads so each quad starts four vertices after the previous one.
+                    for( U32 n = 0; n < primitiveCount; ++n, triangleIndex += 4 )
                     {
                         // Add new indices.
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                        mIndexBuffer[mIndexCount++] = triangleIndex--;
-                        mIndexBuffer[mIndexCount++] = triangleIndex--;
-                        mIndexBuffer[mIndexCount++] = triangleIndex--;
+                        mpIndexBuffer[mIndexCount++] = triangleIndex;
+                        mpIndexBuffer[mIndexCount++] = triangleIndex+1;
+                        mpIndexBuffer[mIndexCount++] = triangleIndex+2;
+                        mpIndexBuffer[mIndexCount++] = triangleIndex+3;
+                        mpIndexBuffer[mIndexCount++] = triangleIndex+2;
+                        mpIndexBuffer[mIndexCount++] = triangleIndex+1;
                     }
                 }
                 else if ( primitiveMode == TriangleRun::TRIANGLE )
@@ -502,9 +903,9 @@ void BatchRender::flushInternal( void )
                     for( U32 n = 0; n < primitiveCount; ++n )
                     {
                         // Add new indices.
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
+                        mpIndexBuffer[mIndexCount++] = triangleIndex++;
+                        mpIndexBuffer[mIndexCount++] = triangleIndex++;
+                        mpIndexBuffer[mIndexCount++] = triangleIndex++;
                     }
                 }
                 else
@@ -515,26 +916,10 @@ void BatchRender::flushInternal( void )
             }
 
             // Sanity!
-            AssertFatal( mIndexCount > 0, "No batching indexes are present." );
-
-            // Bind the texture if not in wireframe mode.
-            if ( !mWireframeMode )
-                glBindTexture( GL_TEXTURE_2D, batchItr->key );
+            AssertFatal( mIndexCount > startIndex, "No batching indexes are present." );
 
-            // Draw the triangles.
-            glDrawElements( GL_TRIANGLES, mIndexCount, GL_UNSIGNED_SHORT, mIndexBuffer );
-
-            // Stats.
-            mpDebugStats->batchDrawCallsSorted++;
-
-            // Stats.
-            if ( mVertexCount > mpDebugStats->batchMaxVertexBuffer )
-                mpDebugStats->batchMaxVertexBuffer = mVertexCount;
-
-            // Stats.
-            const U32 trianglesDrawn = mIndexCount / 3;
-            if ( trianglesDrawn > mpDebugStats->batchMaxTriangleDrawn )
-                mpDebugStats->batchMaxTriangleDrawn = trianglesDrawn;
+            // Add the texture draw.
+            mTextureDraws.push_back( TextureDraw( batchItr->key, startIndex, mIndexCount - startIndex ) );
 
             // Return index vector to pool.
             pIndexVector->clear();
@@ -545,6 +930,228 @@ void BatchRender::flushInternal( void )
         mTextureBatchMap.clear();
     }
 
+    // Apply render state.
+    applyRenderState();
+
+    // Fetch the index base.
+    const batchIndexType* pIndexBase = mpIndexBuffer;
+
+    // Is the retained mode active?
+    if ( isRetainedActive() )
+    {
+        // Yes, so upload the batch.
+        mpDebugStats->batchBytesUploaded += uploadRetainedBuffers();
+
+        // Indices are now offsets into the index buffer.
+        pIndexBase = NULL;
+    }
+    else
+    {
+        // No, so use the vertex and texture arrays.
+        glVertexPointer( 2, GL_FLOAT, 0, mpVertexBuffer );
+        glTexCoordPointer( 2, GL_FLOAT, 0, mpTextureBuffer );
+
+        // Use the color array if we have any colors.
+        if ( mColorCount > 0 )
+            glColorPointer( 4, GL_FLOAT, 0, mpColorBuffer );
+
+        // Stats.
+        mpDebugStats->batchBytesUploaded += (mVertexCount * sizeof(Vector2) * 2) + (mColorCount * sizeof(ColorF)) + (mIndexCount * sizeof(batchIndexType));
+    }
+
+    // Iterate texture draws.
+    for( textureDrawVectorType::iterator drawItr = mTextureDraws.begin(); drawItr != mTextureDraws.end(); ++drawItr )
+    {
+        // Fetch texture draw.
+        const TextureDraw& textureDraw = *drawItr;
+
+        // Bind the texture if not in wireframe mode.
+        if ( !mWireframeMode )
+            glBindTexture( GL_TEXTURE_2D, textureDraw.mTextureHandle );
+
+        // Draw the triangles.
+        glDrawElements( GL_TRIANGLES, textureDraw.mIndexCount, BATCHRENDER_INDEXFORMAT, pIndexBase + textureDraw.mStartIndex );
+
+        // Stats.
+        if ( mStrictOrderMode )
+            mpDebugStats->batchDrawCallsStrict++;
+        else
+            mpDebugStats->batchDrawCallsSorted++;
+
+        // Stats.
+        const U32 trianglesDrawn = textureDraw.mIndexCount / 3;
+        if ( trianglesDrawn > mpDebugStats->batchMaxTriangleDrawn )
+            mpDebugStats->batchMaxTriangleDrawn = trianglesDrawn;
+    }
+    mTextureDraws.clear();
+
+    // Stats.
+    if ( mVertexCount > mpDebugStats->batchMaxVertexBuffer )
+        mpDebugStats->batchMaxVertexBuffer = mVertexCount;
+
+    // Is the retained mode active?
+    if ( isRetainedActive() )
+    {
+        // Yes, so the current color is undefined after drawing with a color array.
+        if ( mColorCount > 0 )
+            mRenderState.mColorValid = false;
+    }
+    else
+    {
+        // No, so reset the render state.
+        resetRenderState();
+    }
+
+    // Reset batch state.
+    mTriangleCount = 0;
+    mVertexCount = 0;
+    mTextureCoordCount = 0;
+    mIndexCount = 0;
+    mColorCount = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::setRetainedMode( const bool retained )
+{
+    // Ignore no change.
+    if ( mRetainedMode == retained )
+        return;
+
+    // Flush.
+    flushInternal();
+
+    // Restore render state.
+    restoreRenderState();
+
+    mRetainedMode = retained;
+}
+
+//-----------------------------------------------------------------------------
+
+bool BatchRender::isRetainedActive( void ) const
+{
+#ifdef BATCHRENDER_RETAINED
+    return mRetainedMode && dglDoesSupportVertexBuffer();
+#else
+    return false;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::applyRenderState( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchRender_ApplyRenderState);
+
+    // Fetch whether the current render state is known.
+    const bool stateValid = mRenderStateValid;
+
+    // Enable the vertex array.
+    if ( !stateValid )
+        glEnableClientState( GL_VERTEX_ARRAY );
+
+    // Wireframe mode change?
+    if ( !stateValid || mRenderState.mWireframeMode != mWireframeMode )
+    {
+        if ( mWireframeMode )
+        {
+            // Disable texturing.    
+            glDisable( GL_TEXTURE_2D );
+            glDisableClientState( GL_TEXTURE_COORD_ARRAY );
+
+            // Set the polygon mode to line.
+            glPolygonMode( GL_FRONT_AND_BACK, GL_LINE );
+        }
+        else
+        {
+            // Enable texturing.    
+            glEnable( GL_TEXTURE_2D );
+            glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE );
+            glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+
+            // Set the polygon mode to fill.
+            glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
+        }
+
+        mRenderState.mWireframeMode = mWireframeMode;
+    }
+
+    // Set blend mode.
+    if ( mBlendMode )
+    {
+        if ( !stateValid || !mRenderState.mBlendMode )
+            glEnable( GL_BLEND );
+
+        if ( !stateValid || mRenderState.mSrcBlendFactor != mSrcBlendFactor || mRenderState.mDstBlendFactor != mDstBlendFactor )
+        {
+            glBlendFunc( mSrcBlendFactor, mDstBlendFactor );
+            mRenderState.mSrcBlendFactor = mSrcBlendFactor;
+            mRenderState.mDstBlendFactor = mDstBlendFactor;
+        }
+    }
+    else
+    {
+        if ( !stateValid || mRenderState.mBlendMode )
+            glDisable( GL_BLEND );
+    }
+    mRenderState.mBlendMode = mBlendMode;
+
+    // Set the color.
+    const ColorF& color = mBlendMode ? mBlendColor : ColorF( 1.0f, 1.0f, 1.0f, 1.0f );
+    if ( !stateValid || !mRenderState.mColorValid || mRenderState.mColor != color )
+    {
+        glColor4f( color.red, color.green, color.blue, color.alpha );
+        mRenderState.mColor = color;
+        mRenderState.mColorValid = true;
+    }
+
+    // Set alpha-test mode.
+    if ( mAlphaTestMode >= 0.0f )
+    {
+        if ( !stateValid || mRenderState.mAlphaTestMode < 0.0f )
+            glEnable( GL_ALPHA_TEST );
+
+        if ( !stateValid || mNotEqual( mRenderState.mAlphaTestMode, mAlphaTestMode ) )
+            glAlphaFunc( GL_GREATER, mAlphaTestMode );
+    }
+    else
+    {
+        if ( !stateValid || mRenderState.mAlphaTestMode >= 0.0f )
+            glDisable( GL_ALPHA_TEST );
+    }
+    mRenderState.mAlphaTestMode = mAlphaTestMode;
+
+    // Set the color array.
+    const bool colorArray = mColorCount > 0;
+    if ( !stateValid || mRenderState.mColorArray != colorArray )
+    {
+        if ( colorArray )
+            glEnableClientState( GL_COLOR_ARRAY );
+        else
+            glDisableClientState( GL_COLOR_ARRAY );
+
+        mRenderState.mColorArray = colorArray;
+    }
+
+    // Flag render state as known.
+    mRenderStateValid = true;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::resetRenderState( void )
+{
+#ifdef BATCHRENDER_RETAINED
+    // Unbind the buffers so client arrays can be used.
+    if ( mVertexBufferObject != 0 )
+    {
+        glBindBufferARB( GL_ARRAY_BUFFER_ARB, 0 );
+        glBindBufferARB( GL_ELEMENT_ARRAY_BUFFER_ARB, 0 );
+    }
+#endif
+
     // Reset common render state.
     glDisableClientState( GL_VERTEX_ARRAY );
     glDisableClientState( GL_TEXTURE_COORD_ARRAY );
@@ -554,12 +1161,73 @@ void BatchRender::flushInternal( void )
     glDisable( GL_TEXTURE_2D );
     glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
 
-    // Reset batch state.
-    mTriangleCount = 0;
-    mVertexCount = 0;
-    mTextureCoordCount = 0;
-    mIndexCount = 0;
-    mColorCount = 0;
+    // Flag render state as unknown.
+    mRenderStateValid = false;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 BatchRender::uploadRetainedBuffers( void )
+{
+#ifdef BATCHRENDER_RETAINED
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchRender_UploadRetainedBuffers);
+
+    // Create the buffers if not already created.
+    if ( mVertexBufferObject == 0 )
+    {
+        glGenBuffersARB( 1, &mVertexBufferObject );
+        glGenBuffersARB( 1, &mIndexBufferObject );
+    }
+
+    // Create the retained vertex buffer if not already created.
+    if ( mpRetainedVertexBuffer == NULL )
+        mpRetainedVertexBuffer = new RetainedVertex[mBufferSize];
+
+    // Interleave the vertices.
+    RetainedVertex* pRetainedVertex = mpRetainedVertexBuffer;
+    for( U32 n = 0; n < mVertexCount; ++n, ++pRetainedVertex )
+    {
+        pRetainedVertex->mVertexPos = mpVertexBuffer[n];
+        pRetainedVertex->mTexturePos = mpTextureBuffer[n];
+    }
+
+    // Interleave the colors if we have any.
+    if ( mColorCount > 0 )
+    {
+        pRetainedVertex = mpRetainedVertexBuffer;
+        for( U32 n = 0; n < mColorCount; ++n, ++pRetainedVertex )
+        {
+            pRetainedVertex->mColor = mpColorBuffer[n];
+        }
+    }
+
+    // Calculate upload sizes.
+    const U32 vertexBytes = mVertexCount * sizeof(RetainedVertex);
+    const U32 indexBytes = mIndexCount * sizeof(batchIndexType);
+
+    // Upload the vertices.
+    // NOTE:    Respecifying the buffer orphans the previous storage so we never wait on pending draws.
+    glBindBufferARB( GL_ARRAY_BUFFER_ARB, mVertexBufferObject );
+    glBufferDataARB( GL_ARRAY_BUFFER_ARB, vertexBytes, NULL, GL_STREAM_DRAW_ARB );
+    glBufferSubDataARB( GL_ARRAY_BUFFER_ARB, 0, vertexBytes, mpRetainedVertexBuffer );
+
+    // Upload the indices.
+    glBindBufferARB( GL_ELEMENT_ARRAY_BUFFER_ARB, mIndexBufferObject );
+    glBufferDataARB( GL_ELEMENT_ARRAY_BUFFER_ARB, indexBytes, NULL, GL_STREAM_DRAW_ARB );
+    glBufferSubDataARB( GL_ELEMENT_ARRAY_BUFFER_ARB, 0, indexBytes, mpIndexBuffer );
+
+    // Set the interleaved arrays.
+    const GLsizei stride = sizeof(RetainedVertex);
+    glVertexPointer( 2, GL_FLOAT, stride, (const GLvoid*)0 );
+    glTexCoordPointer( 2, GL_FLOAT, stride, (const GLvoid*)(sizeof(Vector2)) );
+    if ( mColorCount > 0 )
+        glColorPointer( 4, GL_FLOAT, stride, (const GLvoid*)(sizeof(Vector2) * 2) );
+
+    return vertexBytes + indexBytes;
+#else
+    return 0;
+#endif
 }
 
 //-----------------------------------------------------------------------------
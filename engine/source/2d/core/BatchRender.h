@@ -49,8 +49,24 @@
 
 //-----------------------------------------------------------------------------
 
+// The default buffer size (in vertices).
+// This can be raised at startup using "$pref::T2D::batchRenderBufferSize".
 #define BATCHRENDER_BUFFERSIZE      (65535)
-#define BATCHRENDER_MAXTRIANGLES    (BATCHRENDER_BUFFERSIZE/3)
+
+// 32-bit indices are only used where the platform is not restricted to 16-bit element indices.
+#if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
+#define BATCHRENDER_MAXBUFFERSIZE   (65535)
+#define BATCHRENDER_INDEXFORMAT     GL_UNSIGNED_SHORT
+#else
+#define BATCHRENDER_INDEX32
+#define BATCHRENDER_MAXBUFFERSIZE   (1048575)
+#define BATCHRENDER_INDEXFORMAT     GL_UNSIGNED_INT
+#endif
+
+// Retained rendering is only available where the platform binds the ARB buffer object functions.
+#if defined(TORQUE_OS_WIN32) || defined(TORQUE_OS_LINUX) || defined(TORQUE_OS_OPENBSD) || defined(TORQUE_OS_FREEBSD) || defined(TORQUE_OS_OSX)
+#define BATCHRENDER_RETAINED
+#endif
 
 //-----------------------------------------------------------------------------
 
@@ -60,6 +76,19 @@ class SceneRenderRequest;
 
 class BatchRender
 {
+public:
+    /// Quad for batched submission.
+    /// The shared local quad is scaled, rotated then translated to the position.
+    struct BatchQuad
+    {
+        Vector2     mPosition;
+        b2Rot       mRotation;
+        Vector2     mScale;
+        Vector2     mTexelLower;
+        Vector2     mTexelUpper;
+        ColorF      mColor;
+    };
+
 private:
     struct TriangleRun
     {
@@ -80,19 +109,61 @@ private:
         U32 mStartIndex;
     };
 
+    struct TextureDraw
+    {
+        TextureDraw( const U32 textureHandle, const U32 startIndex, const U32 indexCount ) :
+            mTextureHandle( textureHandle ),
+            mStartIndex( startIndex ),
+            mIndexCount( indexCount )
+        { }
+
+        U32 mTextureHandle;
+        U32 mStartIndex;
+        U32 mIndexCount;
+    };
+
+    struct RetainedVertex
+    {
+        Vector2 mVertexPos;
+        Vector2 mTexturePos;
+        ColorF  mColor;
+    };
+
+    struct RenderState
+    {
+        bool    mWireframeMode;
+        bool    mBlendMode;
+        GLenum  mSrcBlendFactor;
+        GLenum  mDstBlendFactor;
+        ColorF  mColor;
+        bool    mColorValid;
+        F32     mAlphaTestMode;
+        bool    mColorArray;
+    };
+
+#ifdef BATCHRENDER_INDEX32
+    typedef U32 batchIndexType;
+#else
+    typedef U16 batchIndexType;
+#endif
+
     typedef Vector<TriangleRun> indexVectorType;
     typedef HashMap<U32, indexVectorType*> textureBatchType;
+    typedef Vector<TextureDraw> textureDrawVectorType;
 
     VectorPtr< indexVectorType* > mIndexVectorPool;
     textureBatchType    mTextureBatchMap;
+    textureDrawVectorType mTextureDraws;
 
     const ColorF        NoColor;
 
-    Vector2             mVertexBuffer[ BATCHRENDER_BUFFERSIZE ];
-    Vector2             mTextureBuffer[ BATCHRENDER_BUFFERSIZE ];
-    U16                 mIndexBuffer[ BATCHRENDER_BUFFERSIZE ];
-    ColorF              mColorBuffer[ BATCHRENDER_BUFFERSIZE ];
-   
+    Vector2*            mpVertexBuffer;
+    Vector2*            mpTextureBuffer;
+    batchIndexType*     mpIndexBuffer;
+    ColorF*             mpColorBuffer;
+    U32                 mBufferSize;
+    U32                 mMaxTriangles;
+
     U32                 mTriangleCount;
     U32                 mVertexCount;
     U32                 mTextureCoordCount;
@@ -112,6 +183,13 @@ private:
     bool                mWireframeMode;
     bool                mBatchEnabled;
 
+    bool                mRetainedMode;
+    RetainedVertex*     mpRetainedVertexBuffer;
+    GLuint              mVertexBufferObject;
+    GLuint              mIndexBufferObject;
+    RenderState         mRenderState;
+    bool                mRenderStateValid;
+
 public:
     BatchRender();
     virtual ~BatchRender();
@@ -216,6 +294,31 @@ public:
     /// Gets the batch enabled mode.
     inline bool getBatchEnabled( void ) const { return mBatchEnabled; }
 
+    /// Sets the retained mode.
+    /// When retained, batches are streamed through buffer objects and render state is left bound between flushes.
+    void setRetainedMode( const bool retained );
+
+    /// Gets the retained mode.
+    inline bool getRetainedMode( void ) const { return mRetainedMode; }
+
+    /// Restore the default render state if any is being retained.
+    /// This must be called before anything other than the batch renderer renders.
+    inline void restoreRenderState( void )
+    {
+        // Ignore if no render state retained.
+        if ( !mRenderStateValid )
+            return;
+
+        resetRenderState();
+    }
+
+    /// Sets the buffer size (in vertices).
+    /// Larger buffers reduce the flushes required when the buffer is full.
+    void setBufferSize( const U32 bufferSize );
+
+    /// Gets the buffer size (in vertices).
+    inline U32 getBufferSize( void ) const { return mBufferSize; }
+
     /// Sets the debug stats to use.
     inline void setDebugStats( DebugStats* pDebugStats ) { mpDebugStats = pDebugStats; }
 
@@ -250,6 +353,27 @@ public:
             TextureHandle& texture,
             const ColorF& color = ColorF(-1.0f, -1.0f, -1.0f) );
 
+    /// Submit quads for batching.
+    /// Each quad transforms the local quad which is indexed as "SubmitQuad".
+    /// The texel lower-x/upper-y is mapped to local vertex #0 and the texel upper-x/lower-y to local vertex #2.
+    /// The quad colors are only used if specified.
+    void SubmitQuads(
+            const U32 quadCount,
+            const BatchQuad* pQuads,
+            const Vector2* pLocalQuad,
+            TextureHandle& texture,
+            const bool useColor );
+
+    /// Submit pre-transformed quads for batching.
+    /// Vertices and textures are four per quad and indexed as "SubmitQuad".
+    /// The colors are four per quad and are only used if not NULL.
+    void SubmitQuads(
+            const U32 quadCount,
+            const Vector2* pVertexArray,
+            const Vector2* pTextureArray,
+            const ColorF* pColorArray,
+            TextureHandle& texture );
+
     /// Render a quad immediately without affecting current batch.
     /// All render state should be set beforehand directly.
     /// Vertex and textures are indexed as:
@@ -289,8 +413,44 @@ private:
     /// Flush (render) any pending batches.
     void flushInternal( void );
 
+    /// Allocate the buffers.
+    void allocateBuffers( void );
+
+    /// Free the buffers.
+    void freeBuffers( void );
+
+    /// Prepare the batch for submitting quads with the specified color state and texture.
+    void prepareQuads( const bool useColor, TextureHandle& texture );
+
+    /// Fetch the quads that can be written before the buffer is full, flushing if required.
+    U32 allocateQuadRun( const U32 quadCount );
+
+    /// Add the indices or triangle run for quads about to be written.
+    void addQuadRun( const U32 quadCount, TextureHandle& texture );
+
+    /// Finish submitting quads.
+    void finishQuads( void );
+
+    /// Transform and write quads directly into the buffers.
+    void writeQuads( const U32 quadCount, const BatchQuad* pQuads, const Vector2* pLocalQuad, const bool useColor );
+
+    /// Write pre-transformed quads directly into the buffers.
+    void writeQuads( const U32 quadCount, const Vector2* pVertexArray, const Vector2* pTextureArray, const ColorF* pColorArray );
+
     /// Find texture batch.
     indexVectorType* findTextureBatch( TextureHandle& handle );
+
+    /// Is the retained mode active.
+    bool isRetainedActive( void ) const;
+
+    /// Apply the batch render state, skipping any that is already set.
+    void applyRenderState( void );
+
+    /// Reset the render state to its default.
+    void resetRenderState( void );
+
+    /// Upload the batch to the retained buffers.
+    U32 uploadRetainedBuffers( void );
 };
 
 #endif
\ No newline at end of file
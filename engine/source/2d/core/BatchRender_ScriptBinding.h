@@ -0,0 +1,124 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+/*! @defgroup BatchRenderFunctions Batch Render
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+//-----------------------------------------------------------------------------
+
+static void runBatchRenderBenchmark( const U32 quadCount, const U32 bufferSize, const bool retained )
+{
+    // Configure the batch renderer.
+    DebugStats debugStats;
+    BatchRender batchRenderer;
+    batchRenderer.setDebugStats( &debugStats );
+    batchRenderer.setBufferSize( bufferSize );
+    batchRenderer.setRetainedMode( retained );
+
+    // Use identity matrices so the quads are within the viewport.
+    glMatrixMode( GL_PROJECTION );
+    glPushMatrix();
+    glLoadIdentity();
+    glMatrixMode( GL_MODELVIEW );
+    glPushMatrix();
+    glLoadIdentity();
+
+    const F32 quadSize = 0.002f;
+    const Vector2 texturePos0( 0.0f, 0.0f );
+    const Vector2 texturePos1( 1.0f, 0.0f );
+    const Vector2 texturePos2( 1.0f, 1.0f );
+    const Vector2 texturePos3( 0.0f, 1.0f );
+
+    // Ensure no previous rendering is timed.
+    glFinish();
+
+    const U32 startTime = Platform::getRealMilliseconds();
+
+    // Submit the quads in a grid.
+    for( U32 n = 0; n < quadCount; ++n )
+    {
+        const F32 x = ((n % 1000) * quadSize) - 1.0f;
+        const F32 y = (((n / 1000) % 1000) * quadSize) - 1.0f;
+
+        batchRenderer.SubmitQuad(
+            Vector2( x, y ),
+            Vector2( x + quadSize, y ),
+            Vector2( x + quadSize, y + quadSize ),
+            Vector2( x, y + quadSize ),
+            texturePos0,
+            texturePos1,
+            texturePos2,
+            texturePos3,
+            BadTextureHandle );
+    }
+
+    // Flush and wait for the rendering to complete.
+    batchRenderer.flush( debugStats.batchAnonymousFlush );
+    batchRenderer.restoreRenderState();
+    glFinish();
+
+    const U32 elapsedTime = Platform::getRealMilliseconds() - startTime;
+
+    // Restore the matrices.
+    glMatrixMode( GL_PROJECTION );
+    glPopMatrix();
+    glMatrixMode( GL_MODELVIEW );
+    glPopMatrix();
+
+    // Info.
+    Con::printf( "BufferSize=%d, Retained=%s, Flushes=%d, BufferFullFlushes=%d, DrawCalls=%d, Uploaded=%d, Time=%dms",
+        batchRenderer.getBufferSize(),
+        batchRenderer.getRetainedMode() ? "YES" : "NO",
+        debugStats.batchFlushes,
+        debugStats.batchBufferFullFlush,
+        debugStats.batchDrawCallsSorted + debugStats.batchDrawCallsStrict,
+        debugStats.batchBytesUploaded,
+        elapsedTime );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Benchmarks the batch renderer by submitting quads using the default buffer size then the specified buffer size.
+    The flush counts and CPU time for each are output to the console.
+    @param quadCount The number of quads to submit.  Defaults to 500000.
+    @param bufferSize The buffer size (in vertices) to compare against the default.  Defaults to the maximum supported buffer size.
+    @param retained Whether to use the retained mode or not.  Defaults to false.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( benchmarkBatchRender, ConsoleVoid, 1, 4, ([quadCount], [bufferSize], [retained?]))
+{
+    const U32 quadCount = argc >= 2 ? (U32)getMax( dAtoi(argv[1]), 1 ) : 500000;
+    const U32 bufferSize = argc >= 3 ? (U32)getMax( dAtoi(argv[2]), 0 ) : BATCHRENDER_MAXBUFFERSIZE;
+    const bool retained = argc >= 4 ? dAtob(argv[3]) : false;
+
+    Con::printSeparator();
+    Con::printf( "Batch render benchmark of %d quads:", quadCount );
+
+    runBatchRenderBenchmark( quadCount, BATCHRENDER_BUFFERSIZE, retained );
+    runBatchRenderBenchmark( quadCount, bufferSize, retained );
+
+    Con::printSeparator();
+}
+
+/*! @} */ // group BatchRenderFunctions
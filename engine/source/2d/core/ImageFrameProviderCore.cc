@@ -42,12 +42,21 @@
 #include "2d/core/RenderProxy.h"
 #endif
 
+#ifndef _SCENE_ANIMATION_CLOCK_H_
+#include "2d/scene/SceneAnimationClock.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
 //-----------------------------------------------------------------------------
 
-ImageFrameProviderCore::ImageFrameProviderCore() : mpImageAsset(NULL), mpAnimationAsset(NULL)
+ImageFrameProviderCore::ImageFrameProviderCore() :
+    mpImageAsset(NULL),
+    mpAnimationAsset(NULL),
+    mpAnimationClock(NULL),
+    mpAnimationGroup(NULL),
+    mAnimationGroupIndex(0)
 {
 }
 
@@ -55,6 +64,10 @@ ImageFrameProviderCore::ImageFrameProviderCore() : mpImageAsset(NULL), mpAnimati
 
 ImageFrameProviderCore::~ImageFrameProviderCore()
 {
+    // Detach from any animation clock.
+    if ( mpAnimationClock != NULL )
+        mpAnimationClock->detachProvider( this );
+
     // Reset the state.
     resetState();
 }
@@ -147,6 +160,10 @@ bool ImageFrameProviderCore::update( const F32 elapsedTime )
     if ( isAnimationFinished() )
         return false;
 
+    // Finish if the animation clock is updating the animation.
+    if ( isAnimationClocked() )
+        return false;
+
     // Finish if animation is paused.
     if ( isAnimationPaused() )
         return true;
@@ -278,7 +295,8 @@ void ImageFrameProviderCore::renderGui( GuiControl& owner, Point2I offset, const
     {
         // Valid, so calculate source region.
         const ImageAsset::FrameArea& frameArea = getProviderImageFrameArea();
-        RectI sourceRegion( frameArea.mPixelArea.mPixelOffset, Point2I(frameArea.mPixelArea.mPixelWidth, frameArea.mPixelArea.mPixelHeight) );
+        const Point2I& atlasOffset = isStaticFrameProvider() ? (*mpImageAsset)->getImageAtlasOffset() : (*mpAnimationAsset)->getImage()->getImageAtlasOffset();
+        RectI sourceRegion( frameArea.mPixelArea.mPixelOffset + atlasOffset, Point2I(frameArea.mPixelArea.mPixelWidth, frameArea.mPixelArea.mPixelHeight) );
 
         // Calculate destination region.
         RectI destinationRegion(offset, owner.mBounds.extent);
@@ -521,6 +539,14 @@ bool ImageFrameProviderCore::setAnimation( const char* pAnimationAssetId )
 //-----------------------------------------------------------------------------
 
 bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& animationAsset )
+{
+    // Play using the shared random generator.
+    return playAnimation( animationAsset, CoreMath::gRandomGenerator );
+}
+
+//-----------------------------------------------------------------------------
+
+bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& animationAsset, RandomGeneratorBase& random )
 {
     // Debug Profiling.
     PROFILE_SCOPE(AnimationController_PlayAnimation);
@@ -566,7 +592,7 @@ bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& anim
     if ( (*mpAnimationAsset)->getRandomStart() )
     {
         // Yes, so calculate start time.
-        mCurrentTime = CoreMath::mGetRandomF(0.0f, mTotalIntegrationTime*0.999f);
+        mCurrentTime = random.randRangeF(0.0f, mTotalIntegrationTime*0.999f);
     }
     else
     {
@@ -580,6 +606,9 @@ bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& anim
     // Do an initial animation update.
     updateAnimation(0.0f);
 
+    // Let the animation clock update the animation if possible.
+    refreshAnimationClock();
+
     // Return Okay.
     return true;
 }
@@ -677,6 +706,9 @@ void ImageFrameProviderCore::setAnimationFrame( const U32 frameIndex )
 
     // Do an immediate animation update.
     updateAnimation(0.0f);
+
+    // Regroup using the new animation time.
+    refreshAnimationClock( true );
 }
 
 //------------------------------------------------------------------------------
@@ -695,6 +727,73 @@ void ImageFrameProviderCore::clearAssets( void )
     mNamedImageFrame = StringTable->EmptyString;
     mStaticProvider = true;
     setProcessTicks( false );
+
+    // Leave any animation clock group.
+    refreshAnimationClock();
+}
+
+//-----------------------------------------------------------------------------
+
+const F32 ImageFrameProviderCore::getCurrentAnimationTime( void ) const
+{
+    // Use the group time if the animation clock is updating the animation.
+    return isAnimationClocked() ? mpAnimationGroup->mCurrentTime : mCurrentTime;
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageFrameProviderCore::setAnimationClock( SceneAnimationClock* pAnimationClock )
+{
+    // Finish if no change.
+    if ( pAnimationClock == mpAnimationClock )
+        return;
+
+    const bool wasClocked = isAnimationClocked();
+
+    // Detach from the current animation clock.
+    if ( mpAnimationClock != NULL )
+        mpAnimationClock->detachProvider( this );
+
+    // Set the animation clock.
+    mpAnimationClock = pAnimationClock;
+
+    // Let the animation clock update the animation if possible.
+    if ( mpAnimationClock != NULL && SceneAnimationClock::canAddProvider( this ) )
+        mpAnimationClock->addProvider( this );
+
+    // Update tick processing if the animation clocking changed whilst animating.
+    if ( wasClocked != isAnimationClocked() && !mStaticProvider && !mAnimationFinished )
+        setProcessTicks( true );
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageFrameProviderCore::refreshAnimationClock( const bool timeChanged )
+{
+    // Finish if there's no animation clock.
+    if ( mpAnimationClock == NULL )
+        return;
+
+    const bool wasClocked = isAnimationClocked();
+
+    // Are we grouped?
+    if ( wasClocked )
+    {
+        // Yes, so finish if the group is still appropriate.
+        if ( !timeChanged && mpAnimationGroup->mTimeScale == mAnimationTimeScale && SceneAnimationClock::canAddProvider( this ) )
+            return;
+
+        // Leave the group, keeping the group time unless the time was changed.
+        mpAnimationClock->removeProvider( this, !timeChanged );
+    }
+
+    // Join a group if possible.
+    if ( SceneAnimationClock::canAddProvider( this ) )
+        mpAnimationClock->addProvider( this );
+
+    // Update tick processing if the animation clocking changed whilst animating.
+    if ( wasClocked != isAnimationClocked() && !mStaticProvider && !mAnimationFinished )
+        setProcessTicks( true );
 }
 
 //-----------------------------------------------------------------------------
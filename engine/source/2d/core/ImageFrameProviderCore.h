@@ -51,6 +51,15 @@
 #include "gui/guiControl.h"
 #endif
 
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
+///-----------------------------------------------------------------------------
+
+class SceneAnimationClock;
+struct SceneAnimationGroup;
+
 ///-----------------------------------------------------------------------------
 
 class ImageFrameProviderCore :
@@ -82,6 +91,12 @@ protected:
     bool                                    mAnimationPaused;
     bool                                    mAnimationFinished;
 
+    SceneAnimationClock*                    mpAnimationClock;
+    SceneAnimationGroup*                    mpAnimationGroup;
+    U32                                     mAnimationGroupIndex;
+
+    friend class SceneAnimationClock;
+
 public:
     ImageFrameProviderCore();
     virtual ~ImageFrameProviderCore();
@@ -127,12 +142,13 @@ public:
     inline StringTableEntry getAnimation( void ) const { return mpAnimationAsset->getAssetId(); }
     void setAnimationFrame( const U32 frameIndex );
     inline S32 getAnimationFrame( void ) const { return mCurrentFrameIndex; }
-    void setAnimationTimeScale( const F32 scale ) { mAnimationTimeScale = scale; }
+    void setAnimationTimeScale( const F32 scale ) { mAnimationTimeScale = scale; refreshAnimationClock(); }
     inline F32 getAnimationTimeScale( void ) const { return mAnimationTimeScale; }
     bool playAnimation( const AssetPtr<AnimationAsset>& animationAsset);
-    inline void pauseAnimation( const bool animationPaused ) { mAnimationPaused = animationPaused; }
-    inline void stopAnimation( void ) { mAnimationFinished = true; mAnimationPaused = false; }
-    inline void resetAnimationTime( void ) { mCurrentTime = 0.0f; }
+    bool playAnimation( const AssetPtr<AnimationAsset>& animationAsset, RandomGeneratorBase& random );
+    inline void pauseAnimation( const bool animationPaused ) { mAnimationPaused = animationPaused; refreshAnimationClock(); }
+    inline void stopAnimation( void ) { mAnimationFinished = true; mAnimationPaused = false; refreshAnimationClock(); }
+    inline void resetAnimationTime( void ) { mCurrentTime = 0.0f; refreshAnimationClock( true ); }
     inline bool isAnimationPaused( void ) const { return mAnimationPaused; }
     inline bool isAnimationFinished( void ) const { return mAnimationFinished; };
     bool isAnimationValid( void ) const;
@@ -146,13 +162,20 @@ public:
     inline const StringTableEntry getCurrentAnimationAssetId( void ) const { return mpAnimationAsset->getAssetId(); };
     const U32 getCurrentAnimationFrame( void ) const;
     const char* getCurrentNamedAnimationFrame( void ) const;
-    inline const F32 getCurrentAnimationTime( void ) const { return mCurrentTime; };
+    const F32 getCurrentAnimationTime( void ) const;
+
+    /// Animation clock.
+    void setAnimationClock( SceneAnimationClock* pAnimationClock );
+    inline SceneAnimationClock* getAnimationClock( void ) const { return mpAnimationClock; }
+    inline bool isAnimationClocked( void ) const { return mpAnimationGroup != NULL; }
 
     void clearAssets( void );
 
     virtual void resetState( void );
 
 protected:
+    void refreshAnimationClock( const bool timeChanged = false );
+
     virtual void onAnimationEnd( void ) {}
     virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
 };
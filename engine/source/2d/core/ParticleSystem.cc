@@ -22,9 +22,23 @@
 
 #include "2d/core/ParticleSystem.h"
 
+#ifndef _CONSOLETYPES_H_
+#include "console/consoleTypes.h"
+#endif
+
+// SIMD particle integration.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PARTICLESYSTEM_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define PARTICLESYSTEM_NEON
+#include <arm_neon.h>
+#endif
+
 //------------------------------------------------------------------------------
 
 ParticleSystem* ParticleSystem::Instance = NULL;
+S32 ParticleSystem::smParticleBudget = 0;
 
 //------------------------------------------------------------------------------
 
@@ -32,6 +46,9 @@ void ParticleSystem::Init( void )
 {
     // Create the particle system.
     Instance = new ParticleSystem();
+
+    // Expose the particle budget.
+    Con::addVariable( PARTICLE_SYSTEM_BUDGET, TypeS32, &smParticleBudget );
 }
 
 //------------------------------------------------------------------------------
@@ -46,89 +63,537 @@ void ParticleSystem::destroy( void )
 //------------------------------------------------------------------------------
 
 ParticleSystem::ParticleSystem() :
-                    mParticlePoolBlockSize(512)
+                    mFrameProviderPoolBlockSize(512)
 {
-    // Reset the free particle head.
-    mpFreeParticleNodes = NULL;
-
-    // Reset the active particle count.
+    // Reset the active and live particle counts.
     mActiveParticleCount = 0;
+    mLiveParticleCount = 0;
 }
 
 //------------------------------------------------------------------------------
 
 ParticleSystem::~ParticleSystem()
 {
-    // Destroy all the particle pool blocks.
-    for ( U32 n = 0; n < (U32)mParticlePool.size(); n++ )
-        delete [] mParticlePool[n];
-
-    // Clear the particle pool.
-    mParticlePool.clear();
+    // Destroy all the frame provider pool blocks.
+    for ( U32 n = 0; n < (U32)mFrameProviderPool.size(); n++ )
+        delete [] mFrameProviderPool[n];
 
-    // Reset the free particle head.
-    mpFreeParticleNodes = NULL;
+    // Clear the frame provider pool.
+    mFrameProviderPool.clear();
+    mFreeFrameProviders.clear();
 }
 
 //------------------------------------------------------------------------------
 
-ParticleSystem::ParticleNode* ParticleSystem::createParticle( void )
+void ParticleSystem::acquireParticles( Vector<ImageFrameProviderCore*>& freeList, const U32 particleCount )
 {
-    // Have we got any free particle nodes?
-    if ( mpFreeParticleNodes == NULL )
+    // Lock the pool.
+    mPoolLock.lock();
+
+    // Generate new free pool blocks until we've got enough free frame providers.
+    while ( (U32)mFreeFrameProviders.size() < particleCount )
     {
-        // No, so generate a new free pool block.
-        ParticleNode* pFreePoolBlock = new ParticleNode[mParticlePoolBlockSize];
+        // Generate a new free pool block.
+        ImageFrameProviderCore* pFreePoolBlock = new ImageFrameProviderCore[mFrameProviderPoolBlockSize];
 
         // Store new free pool block.
-        mParticlePool.push_back( pFreePoolBlock );
+        mFrameProviderPool.push_back( pFreePoolBlock );
+
+        // Add the block to the free frame providers.
+        mFreeFrameProviders.reserve( mFreeFrameProviders.size() + mFrameProviderPoolBlockSize );
+        for ( S32 n = mFrameProviderPoolBlockSize-1; n >= 0; n-- )
+            mFreeFrameProviders.push_back( pFreePoolBlock+n );
+    }
+
+    // Transfer the free frame providers.
+    freeList.reserve( freeList.size() + particleCount );
+    for ( U32 n = 0; n < particleCount; ++n )
+    {
+        freeList.push_back( mFreeFrameProviders.last() );
+        mFreeFrameProviders.pop_back();
+    }
+
+    // Increase the active particle count.
+    mActiveParticleCount += particleCount;
+
+    // Unlock the pool.
+    mPoolLock.unlock();
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::releaseParticles( Vector<ImageFrameProviderCore*>& freeList, const U32 particleCount )
+{
+    // Sanity!
+    AssertFatal( particleCount <= (U32)freeList.size(), "ParticleSystem::releaseParticles() - Cannot release more particles than the free-list holds." );
+
+    // Lock the pool.
+    mPoolLock.lock();
+
+    // Transfer the free frame providers.
+    for ( U32 n = 0; n < particleCount; ++n )
+    {
+        mFreeFrameProviders.push_back( freeList.last() );
+        freeList.pop_back();
+    }
+
+    // Decrease the active particle count.
+    mActiveParticleCount -= particleCount;
+
+    // Unlock the pool.
+    mPoolLock.unlock();
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::updateLiveParticleCount( const S32 particleCountDelta )
+{
+    // Finish if no change.
+    if ( particleCountDelta == 0 )
+        return;
+
+    // Lock the pool.
+    mPoolLock.lock();
+
+    // Sanity!
+    AssertFatal( particleCountDelta > 0 || (U32)(-particleCountDelta) <= mLiveParticleCount, "ParticleSystem::updateLiveParticleCount() - Live particle count underflow." );
+
+    // Update the live particle count.
+    mLiveParticleCount += particleCountDelta;
+
+    // Unlock the pool.
+    mPoolLock.unlock();
+}
+
+//------------------------------------------------------------------------------
+
+U32 ParticleSystem::getEmissionAllowance( const F32 priority ) const
+{
+    // Fetch the particle budget.
+    const U32 particleBudget = getParticleBudget();
+
+    // No allowance limit if there's no budget.
+    if ( particleBudget == 0 )
+        return U32_MAX;
+
+    // Calculate the share of the budget available at this priority.
+    // NOTE:-   The lowest priority emitters stop emitting once the minimum share is used whereas
+    //          the highest priority emitters continue until the whole budget is used.
+    const F32 budgetShare = PARTICLE_SYSTEM_MINIMUM_BUDGET_SHARE + ( 1.0f - PARTICLE_SYSTEM_MINIMUM_BUDGET_SHARE ) * mClampF( priority, 0.0f, 1.0f );
+    const U32 priorityBudget = (U32)( particleBudget * budgetShare );
+
+    // Fetch the live particle count.
+    // NOTE:-   This is read without locking so is only approximate during concurrent integration.
+    const U32 liveParticleCount = mLiveParticleCount;
+
+    return liveParticleCount < priorityBudget ? priorityBudget - liveParticleCount : 0;
+}
+
+//------------------------------------------------------------------------------
+
+ParticleSystem::ParticleStore::ParticleStore() :
+    mParticleLifetime( NULL ),
+    mParticleAge( NULL ),
+    mPosition( NULL ),
+    mVelocity( NULL ),
+    mOrientationAngle( NULL ),
+    mFrameProvider( NULL ),
+    mRenderPosition( NULL ),
+    mRenderRotation( NULL ),
+    mRenderSize( NULL ),
+    mColor( NULL ),
+    mSize( NULL ),
+    mSpeed( NULL ),
+    mSpin( NULL ),
+    mFixedForce( NULL ),
+    mRandomMotion( NULL ),
+    mPreTickPosition( NULL ),
+    mPostTickPosition( NULL ),
+    mParticleCount( 0 ),
+    mParticleCapacity( 0 )
+{
+}
+
+//------------------------------------------------------------------------------
+
+ParticleSystem::ParticleStore::~ParticleStore()
+{
+    // Sanity!
+    AssertFatal( mParticleCount == 0, "ParticleStore::~ParticleStore() - Particles must be freed before the store is destroyed." );
+
+    dFree( mParticleLifetime );
+    dFree( mParticleAge );
+    dFree( mPosition );
+    dFree( mVelocity );
+    dFree( mOrientationAngle );
+    dFree( mFrameProvider );
+    dFree( mRenderPosition );
+    dFree( mRenderRotation );
+    dFree( mRenderSize );
+    dFree( mColor );
+    dFree( mSize );
+    dFree( mSpeed );
+    dFree( mSpin );
+    dFree( mFixedForce );
+    dFree( mRandomMotion );
+    dFree( mPreTickPosition );
+    dFree( mPostTickPosition );
+}
+
+//------------------------------------------------------------------------------
+
+U32 ParticleSystem::ParticleStore::createParticle( void )
+{
+    // Grow the store if full.
+    if ( mParticleCount == mParticleCapacity )
+        reserve( getMax( mParticleCapacity * 2, (U32)64 ) );
+
+    // Newest particles are appended.
+    return mParticleCount++;
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::ParticleStore::moveParticle( const U32 fromIndex, const U32 toIndex )
+{
+    // Sanity!
+    AssertFatal( fromIndex < mParticleCount && toIndex < mParticleCount, "ParticleStore::moveParticle() - Particle index is out of range." );
+
+    mParticleLifetime[toIndex]  = mParticleLifetime[fromIndex];
+    mParticleAge[toIndex]       = mParticleAge[fromIndex];
+    mPosition[toIndex]          = mPosition[fromIndex];
+    mVelocity[toIndex]          = mVelocity[fromIndex];
+    mOrientationAngle[toIndex]  = mOrientationAngle[fromIndex];
+    mFrameProvider[toIndex]     = mFrameProvider[fromIndex];
+    mRenderPosition[toIndex]    = mRenderPosition[fromIndex];
+    mRenderRotation[toIndex]    = mRenderRotation[fromIndex];
+    mRenderSize[toIndex]        = mRenderSize[fromIndex];
+    mColor[toIndex]             = mColor[fromIndex];
+    mSize[toIndex]              = mSize[fromIndex];
+    mSpeed[toIndex]             = mSpeed[fromIndex];
+    mSpin[toIndex]              = mSpin[fromIndex];
+    mFixedForce[toIndex]        = mFixedForce[fromIndex];
+    mRandomMotion[toIndex]      = mRandomMotion[fromIndex];
+    mPreTickPosition[toIndex]   = mPreTickPosition[fromIndex];
+    mPostTickPosition[toIndex]  = mPostTickPosition[fromIndex];
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::ParticleStore::setParticleCount( const U32 particleCount )
+{
+    // Sanity!
+    AssertFatal( particleCount <= mParticleCount, "ParticleStore::setParticleCount() - The particle count can only be reduced." );
+
+    mParticleCount = particleCount;
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::ParticleStore::reserve( const U32 particleCapacity )
+{
+    mParticleLifetime   = (F32*)dRealloc( mParticleLifetime, particleCapacity * sizeof(F32) );
+    mParticleAge        = (F32*)dRealloc( mParticleAge, particleCapacity * sizeof(F32) );
+    mPosition           = (Vector2*)dRealloc( mPosition, particleCapacity * sizeof(Vector2) );
+    mVelocity           = (Vector2*)dRealloc( mVelocity, particleCapacity * sizeof(Vector2) );
+    mOrientationAngle   = (F32*)dRealloc( mOrientationAngle, particleCapacity * sizeof(F32) );
+    mFrameProvider      = (ImageFrameProviderCore**)dRealloc( mFrameProvider, particleCapacity * sizeof(ImageFrameProviderCore*) );
+    mRenderPosition     = (Vector2*)dRealloc( mRenderPosition, particleCapacity * sizeof(Vector2) );
+    mRenderRotation     = (b2Rot*)dRealloc( mRenderRotation, particleCapacity * sizeof(b2Rot) );
+    mRenderSize         = (Vector2*)dRealloc( mRenderSize, particleCapacity * sizeof(Vector2) );
+    mColor              = (ColorF*)dRealloc( mColor, particleCapacity * sizeof(ColorF) );
+    mSize               = (Vector2*)dRealloc( mSize, particleCapacity * sizeof(Vector2) );
+    mSpeed              = (F32*)dRealloc( mSpeed, particleCapacity * sizeof(F32) );
+    mSpin               = (F32*)dRealloc( mSpin, particleCapacity * sizeof(F32) );
+    mFixedForce         = (F32*)dRealloc( mFixedForce, particleCapacity * sizeof(F32) );
+    mRandomMotion       = (F32*)dRealloc( mRandomMotion, particleCapacity * sizeof(F32) );
+    mPreTickPosition    = (Vector2*)dRealloc( mPreTickPosition, particleCapacity * sizeof(Vector2) );
+    mPostTickPosition   = (Vector2*)dRealloc( mPostTickPosition, particleCapacity * sizeof(Vector2) );
+
+    mParticleCapacity = particleCapacity;
+}
+
+//------------------------------------------------------------------------------
+
+static void integrateParticleRange( ParticleSystem::ParticleStore& particles, const ParticleSystem::IntegrationBatch& batch, const U32 firstIndex, const U32 lastIndex )
+{
+    const F32 elapsedTime = batch.mElapsedTime;
+
+    for ( U32 batchIndex = firstIndex; batchIndex < lastIndex; ++batchIndex )
+    {
+        // Fetch the particle index.
+        const U32 particleIndex = batch.mStart + batchIndex;
+
+        // Copy old tick position.
+        particles.mPreTickPosition[particleIndex] = particles.mPostTickPosition[particleIndex];
+
+        // Scale size.
+        Vector2& renderSize = particles.mRenderSize[particleIndex];
+        renderSize.x = mClampF( particles.mSize[particleIndex].x * batch.mSizeXLife[batchIndex], batch.mSizeXLimits.x, batch.mSizeXLimits.y );
+        renderSize.y = batch.mFixedAspect ? renderSize.x : mClampF( particles.mSize[particleIndex].y * batch.mSizeYLife[batchIndex], batch.mSizeYLimits.x, batch.mSizeYLimits.y );
+
+        // Scale speed and fixed-force.
+        const F32 renderSpeed = mClampF( particles.mSpeed[particleIndex] * batch.mSpeedLife[batchIndex], batch.mSpeedLimits.x, batch.mSpeedLimits.y );
+        const F32 renderFixedForce = mClampF( particles.mFixedForce[particleIndex] * batch.mFixedForceLife[batchIndex], batch.mFixedForceLimits.x, batch.mFixedForceLimits.y );
+
+        // Calculate the color.
+        const ColorF& colorLife = batch.mColorLife[batchIndex];
+        particles.mColor[particleIndex].set(    mClampF( colorLife.red, batch.mColorMinimum.red, batch.mColorMaximum.red ),
+                                                mClampF( colorLife.green, batch.mColorMinimum.green, batch.mColorMaximum.green ),
+                                                mClampF( colorLife.blue, batch.mColorMinimum.blue, batch.mColorMaximum.blue ),
+                                                mClampF( colorLife.alpha, batch.mColorMinimum.alpha, batch.mColorMaximum.alpha ) );
+
+        // Time-integrate any fixed force into the velocity.
+        Vector2& velocity = particles.mVelocity[particleIndex];
+        if ( mNotZero( renderFixedForce ) )
+            velocity += (batch.mFixedForceDirection * (renderFixedForce * batch.mForceScale)) * elapsedTime;
+
+        // Adjust particle position.
+        Vector2& position = particles.mPosition[particleIndex];
+        position += (velocity * renderSpeed) * elapsedTime;
 
-        // Initialise Free Pool Block.
-        for ( U32 n = 0; n < (mParticlePoolBlockSize-1); n++ )
+        // Calculate the render spin.
+        batch.mRenderSpin[batchIndex] = particles.mSpin[particleIndex] * batch.mSpinLife[batchIndex];
+
+        // Set the render and post tick position.
+        particles.mRenderPosition[particleIndex] = position;
+        particles.mPostTickPosition[particleIndex] = position;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+#if defined(PARTICLESYSTEM_SSE2)
+
+static inline __m128 selectParticleLanes( const __m128 mask, const __m128 a, const __m128 b )
+{
+    return _mm_or_ps( _mm_and_ps( mask, a ), _mm_andnot_ps( mask, b ) );
+}
+
+//------------------------------------------------------------------------------
+
+static inline __m128 clampParticleLanes( const __m128 value, const __m128 minimum, const __m128 maximum )
+{
+    // NOTE: This matches "mClampF" exactly, including when the limits are inverted.
+    return selectParticleLanes( _mm_cmplt_ps( value, minimum ), minimum, selectParticleLanes( _mm_cmpgt_ps( value, maximum ), maximum, value ) );
+}
+
+#elif defined(PARTICLESYSTEM_NEON)
+
+static inline float32x4_t clampParticleLanes( const float32x4_t value, const float32x4_t minimum, const float32x4_t maximum )
+{
+    // NOTE: This matches "mClampF" exactly, including when the limits are inverted.
+    return vbslq_f32( vcltq_f32( value, minimum ), minimum, vbslq_f32( vcgtq_f32( value, maximum ), maximum, value ) );
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::integrateParticles( ParticleStore& particles, const IntegrationBatch& batch )
+{
+    // Sanity!
+    AssertFatal( batch.mStart + batch.mCount <= particles.getParticleCount(), "ParticleSystem::integrateParticles() - Batch is out of range." );
+
+#if defined(PARTICLESYSTEM_SSE2) || defined(PARTICLESYSTEM_NEON)
+    // Four particles are integrated at a time.
+    // NOTE: Vector2 properties are processed as interleaved pairs of particles.
+    const U32 vectorCount = batch.mCount & ~3;
+    const F32 elapsedTime = batch.mElapsedTime;
+    const U32 start = batch.mStart;
+
+    F32* pSize = &particles.mSize[start].x;
+    F32* pRenderSize = &particles.mRenderSize[start].x;
+    F32* pVelocity = &particles.mVelocity[start].x;
+    F32* pPosition = &particles.mPosition[start].x;
+    F32* pRenderPosition = &particles.mRenderPosition[start].x;
+    F32* pPreTickPosition = &particles.mPreTickPosition[start].x;
+    F32* pPostTickPosition = &particles.mPostTickPosition[start].x;
+    F32* pColor = &particles.mColor[start].red;
+    const F32* pColorLife = &batch.mColorLife[0].red;
+    const F32* pSpeed = particles.mSpeed + start;
+    const F32* pFixedForce = particles.mFixedForce + start;
+    const F32* pSpin = particles.mSpin + start;
+
+#if defined(PARTICLESYSTEM_SSE2)
+    const __m128 sizeMinimum = _mm_setr_ps( batch.mSizeXLimits.x, batch.mSizeYLimits.x, batch.mSizeXLimits.x, batch.mSizeYLimits.x );
+    const __m128 sizeMaximum = _mm_setr_ps( batch.mSizeXLimits.y, batch.mSizeYLimits.y, batch.mSizeXLimits.y, batch.mSizeYLimits.y );
+    const __m128 speedMinimum = _mm_set1_ps( batch.mSpeedLimits.x );
+    const __m128 speedMaximum = _mm_set1_ps( batch.mSpeedLimits.y );
+    const __m128 fixedForceMinimum = _mm_set1_ps( batch.mFixedForceLimits.x );
+    const __m128 fixedForceMaximum = _mm_set1_ps( batch.mFixedForceLimits.y );
+    const __m128 colorMinimum = _mm_loadu_ps( &batch.mColorMinimum.red );
+    const __m128 colorMaximum = _mm_loadu_ps( &batch.mColorMaximum.red );
+    const __m128 fixedForceDirection = _mm_setr_ps( batch.mFixedForceDirection.x, batch.mFixedForceDirection.y, batch.mFixedForceDirection.x, batch.mFixedForceDirection.y );
+    const __m128 forceScale = _mm_set1_ps( batch.mForceScale );
+    const __m128 elapsed = _mm_set1_ps( elapsedTime );
+    const __m128 epsilon = _mm_set1_ps( FLT_EPSILON );
+    const __m128 signMask = _mm_set1_ps( -0.0f );
+
+    for ( U32 batchIndex = 0; batchIndex < vectorCount; batchIndex += 4 )
+    {
+        const U32 pairIndex = batchIndex * 2;
+
+        // Copy old tick position.
+        const __m128 postTick01 = _mm_loadu_ps( pPostTickPosition + pairIndex );
+        const __m128 postTick23 = _mm_loadu_ps( pPostTickPosition + pairIndex + 4 );
+        _mm_storeu_ps( pPreTickPosition + pairIndex, postTick01 );
+        _mm_storeu_ps( pPreTickPosition + pairIndex + 4, postTick23 );
+
+        // Scale size.
+        const __m128 sizeXLife = _mm_loadu_ps( batch.mSizeXLife + batchIndex );
+        const __m128 sizeYLife = batch.mFixedAspect ? sizeXLife : _mm_loadu_ps( batch.mSizeYLife + batchIndex );
+        __m128 renderSize01 = clampParticleLanes( _mm_mul_ps( _mm_loadu_ps( pSize + pairIndex ), _mm_unpacklo_ps( sizeXLife, sizeYLife ) ), sizeMinimum, sizeMaximum );
+        __m128 renderSize23 = clampParticleLanes( _mm_mul_ps( _mm_loadu_ps( pSize + pairIndex + 4 ), _mm_unpackhi_ps( sizeXLife, sizeYLife ) ), sizeMinimum, sizeMaximum );
+        if ( batch.mFixedAspect )
         {
-            pFreePoolBlock[n].mPreviousNode = NULL;
-            pFreePoolBlock[n].mNextNode     = pFreePoolBlock+n+1;
+            renderSize01 = _mm_shuffle_ps( renderSize01, renderSize01, _MM_SHUFFLE(2,2,0,0) );
+            renderSize23 = _mm_shuffle_ps( renderSize23, renderSize23, _MM_SHUFFLE(2,2,0,0) );
         }
+        _mm_storeu_ps( pRenderSize + pairIndex, renderSize01 );
+        _mm_storeu_ps( pRenderSize + pairIndex + 4, renderSize23 );
+
+        // Scale speed and fixed-force.
+        const __m128 renderSpeed = clampParticleLanes( _mm_mul_ps( _mm_loadu_ps( pSpeed + batchIndex ), _mm_loadu_ps( batch.mSpeedLife + batchIndex ) ), speedMinimum, speedMaximum );
+        const __m128 renderFixedForce = clampParticleLanes( _mm_mul_ps( _mm_loadu_ps( pFixedForce + batchIndex ), _mm_loadu_ps( batch.mFixedForceLife + batchIndex ) ), fixedForceMinimum, fixedForceMaximum );
+
+        // Calculate the color.
+        for ( U32 n = 0; n < 4; ++n )
+        {
+            const U32 colorIndex = (batchIndex + n) * 4;
+            _mm_storeu_ps( pColor + colorIndex, clampParticleLanes( _mm_loadu_ps( pColorLife + colorIndex ), colorMinimum, colorMaximum ) );
+        }
+
+        // Time-integrate any fixed force into the velocity.
+        const __m128 fixedForceMask = _mm_cmpnlt_ps( _mm_andnot_ps( signMask, renderFixedForce ), epsilon );
+        const __m128 fixedForce = _mm_and_ps( fixedForceMask, _mm_mul_ps( renderFixedForce, forceScale ) );
+        const __m128 fixedForceMask01 = _mm_unpacklo_ps( fixedForceMask, fixedForceMask );
+        const __m128 fixedForceMask23 = _mm_unpackhi_ps( fixedForceMask, fixedForceMask );
+        __m128 velocity01 = _mm_loadu_ps( pVelocity + pairIndex );
+        __m128 velocity23 = _mm_loadu_ps( pVelocity + pairIndex + 4 );
+        velocity01 = selectParticleLanes( fixedForceMask01, _mm_add_ps( velocity01, _mm_mul_ps( _mm_mul_ps( fixedForceDirection, _mm_unpacklo_ps( fixedForce, fixedForce ) ), elapsed ) ), velocity01 );
+        velocity23 = selectParticleLanes( fixedForceMask23, _mm_add_ps( velocity23, _mm_mul_ps( _mm_mul_ps( fixedForceDirection, _mm_unpackhi_ps( fixedForce, fixedForce ) ), elapsed ) ), velocity23 );
+        _mm_storeu_ps( pVelocity + pairIndex, velocity01 );
+        _mm_storeu_ps( pVelocity + pairIndex + 4, velocity23 );
+
+        // Adjust particle position.
+        const __m128 position01 = _mm_add_ps( _mm_loadu_ps( pPosition + pairIndex ), _mm_mul_ps( _mm_mul_ps( velocity01, _mm_unpacklo_ps( renderSpeed, renderSpeed ) ), elapsed ) );
+        const __m128 position23 = _mm_add_ps( _mm_loadu_ps( pPosition + pairIndex + 4 ), _mm_mul_ps( _mm_mul_ps( velocity23, _mm_unpackhi_ps( renderSpeed, renderSpeed ) ), elapsed ) );
+        _mm_storeu_ps( pPosition + pairIndex, position01 );
+        _mm_storeu_ps( pPosition + pairIndex + 4, position23 );
 
-        // Insert Last Node Preceding any existing free nodes.
-        pFreePoolBlock[mParticlePoolBlockSize-1].mPreviousNode = NULL;
-        pFreePoolBlock[mParticlePoolBlockSize-1].mNextNode = mpFreeParticleNodes;
+        // Calculate the render spin.
+        _mm_storeu_ps( batch.mRenderSpin + batchIndex, _mm_mul_ps( _mm_loadu_ps( pSpin + batchIndex ), _mm_loadu_ps( batch.mSpinLife + batchIndex ) ) );
 
-        // Set Free References.
-        mpFreeParticleNodes = pFreePoolBlock;
+        // Set the render and post tick position.
+        _mm_storeu_ps( pRenderPosition + pairIndex, position01 );
+        _mm_storeu_ps( pRenderPosition + pairIndex + 4, position23 );
+        _mm_storeu_ps( pPostTickPosition + pairIndex, position01 );
+        _mm_storeu_ps( pPostTickPosition + pairIndex + 4, position23 );
     }
+#else
+    const F32 sizeMinimumLanes[4] = { batch.mSizeXLimits.x, batch.mSizeYLimits.x, batch.mSizeXLimits.x, batch.mSizeYLimits.x };
+    const F32 sizeMaximumLanes[4] = { batch.mSizeXLimits.y, batch.mSizeYLimits.y, batch.mSizeXLimits.y, batch.mSizeYLimits.y };
+    const F32 fixedForceDirectionLanes[4] = { batch.mFixedForceDirection.x, batch.mFixedForceDirection.y, batch.mFixedForceDirection.x, batch.mFixedForceDirection.y };
+    const float32x4_t sizeMinimum = vld1q_f32( sizeMinimumLanes );
+    const float32x4_t sizeMaximum = vld1q_f32( sizeMaximumLanes );
+    const float32x4_t speedMinimum = vdupq_n_f32( batch.mSpeedLimits.x );
+    const float32x4_t speedMaximum = vdupq_n_f32( batch.mSpeedLimits.y );
+    const float32x4_t fixedForceMinimum = vdupq_n_f32( batch.mFixedForceLimits.x );
+    const float32x4_t fixedForceMaximum = vdupq_n_f32( batch.mFixedForceLimits.y );
+    const float32x4_t colorMinimum = vld1q_f32( &batch.mColorMinimum.red );
+    const float32x4_t colorMaximum = vld1q_f32( &batch.mColorMaximum.red );
+    const float32x4_t fixedForceDirection = vld1q_f32( fixedForceDirectionLanes );
+    const float32x4_t forceScale = vdupq_n_f32( batch.mForceScale );
+    const float32x4_t elapsed = vdupq_n_f32( elapsedTime );
+    const float32x4_t epsilon = vdupq_n_f32( FLT_EPSILON );
 
-    // Fetch a free node,
-    ParticleNode* pFreeParticleNode = mpFreeParticleNodes;
+    for ( U32 batchIndex = 0; batchIndex < vectorCount; batchIndex += 4 )
+    {
+        const U32 pairIndex = batchIndex * 2;
 
-    // Set the new free node reference.
-    mpFreeParticleNodes = mpFreeParticleNodes->mNextNode;
+        // Copy old tick position.
+        vst1q_f32( pPreTickPosition + pairIndex, vld1q_f32( pPostTickPosition + pairIndex ) );
+        vst1q_f32( pPreTickPosition + pairIndex + 4, vld1q_f32( pPostTickPosition + pairIndex + 4 ) );
 
-    // Reset any previous or next node references.
-    pFreeParticleNode->mNextNode        = NULL;
-    pFreeParticleNode->mPreviousNode    = NULL;
+        // Scale size.
+        const float32x4_t sizeXLife = vld1q_f32( batch.mSizeXLife + batchIndex );
+        const float32x4_t sizeYLife = batch.mFixedAspect ? sizeXLife : vld1q_f32( batch.mSizeYLife + batchIndex );
+        const float32x4x2_t sizeLife = vzipq_f32( sizeXLife, sizeYLife );
+        float32x4_t renderSize01 = clampParticleLanes( vmulq_f32( vld1q_f32( pSize + pairIndex ), sizeLife.val[0] ), sizeMinimum, sizeMaximum );
+        float32x4_t renderSize23 = clampParticleLanes( vmulq_f32( vld1q_f32( pSize + pairIndex + 4 ), sizeLife.val[1] ), sizeMinimum, sizeMaximum );
+        if ( batch.mFixedAspect )
+        {
+            renderSize01 = vtrnq_f32( renderSize01, renderSize01 ).val[0];
+            renderSize23 = vtrnq_f32( renderSize23, renderSize23 ).val[0];
+        }
+        vst1q_f32( pRenderSize + pairIndex, renderSize01 );
+        vst1q_f32( pRenderSize + pairIndex + 4, renderSize23 );
 
-    // Increase the active particle count.
-    mActiveParticleCount++;
+        // Scale speed and fixed-force.
+        const float32x4_t renderSpeed = clampParticleLanes( vmulq_f32( vld1q_f32( pSpeed + batchIndex ), vld1q_f32( batch.mSpeedLife + batchIndex ) ), speedMinimum, speedMaximum );
+        const float32x4_t renderFixedForce = clampParticleLanes( vmulq_f32( vld1q_f32( pFixedForce + batchIndex ), vld1q_f32( batch.mFixedForceLife + batchIndex ) ), fixedForceMinimum, fixedForceMaximum );
+
+        // Calculate the color.
+        for ( U32 n = 0; n < 4; ++n )
+        {
+            const U32 colorIndex = (batchIndex + n) * 4;
+            vst1q_f32( pColor + colorIndex, clampParticleLanes( vld1q_f32( pColorLife + colorIndex ), colorMinimum, colorMaximum ) );
+        }
+
+        // Time-integrate any fixed force into the velocity.
+        const uint32x4_t fixedForceMask = vcgeq_f32( vabsq_f32( renderFixedForce ), epsilon );
+        const float32x4x2_t fixedForce = vzipq_f32( vmulq_f32( renderFixedForce, forceScale ), vmulq_f32( renderFixedForce, forceScale ) );
+        const uint32x4x2_t fixedForceMasks = vzipq_u32( fixedForceMask, fixedForceMask );
+        float32x4_t velocity01 = vld1q_f32( pVelocity + pairIndex );
+        float32x4_t velocity23 = vld1q_f32( pVelocity + pairIndex + 4 );
+        velocity01 = vbslq_f32( fixedForceMasks.val[0], vaddq_f32( velocity01, vmulq_f32( vmulq_f32( fixedForceDirection, fixedForce.val[0] ), elapsed ) ), velocity01 );
+        velocity23 = vbslq_f32( fixedForceMasks.val[1], vaddq_f32( velocity23, vmulq_f32( vmulq_f32( fixedForceDirection, fixedForce.val[1] ), elapsed ) ), velocity23 );
+        vst1q_f32( pVelocity + pairIndex, velocity01 );
+        vst1q_f32( pVelocity + pairIndex + 4, velocity23 );
+
+        // Adjust particle position.
+        const float32x4x2_t speed = vzipq_f32( renderSpeed, renderSpeed );
+        const float32x4_t position01 = vaddq_f32( vld1q_f32( pPosition + pairIndex ), vmulq_f32( vmulq_f32( velocity01, speed.val[0] ), elapsed ) );
+        const float32x4_t position23 = vaddq_f32( vld1q_f32( pPosition + pairIndex + 4 ), vmulq_f32( vmulq_f32( velocity23, speed.val[1] ), elapsed ) );
+        vst1q_f32( pPosition + pairIndex, position01 );
+        vst1q_f32( pPosition + pairIndex + 4, position23 );
 
-    return pFreeParticleNode;
+        // Calculate the render spin.
+        vst1q_f32( batch.mRenderSpin + batchIndex, vmulq_f32( vld1q_f32( pSpin + batchIndex ), vld1q_f32( batch.mSpinLife + batchIndex ) ) );
+
+        // Set the render and post tick position.
+        vst1q_f32( pRenderPosition + pairIndex, position01 );
+        vst1q_f32( pRenderPosition + pairIndex + 4, position23 );
+        vst1q_f32( pPostTickPosition + pairIndex, position01 );
+        vst1q_f32( pPostTickPosition + pairIndex + 4, position23 );
+    }
+#endif
+
+    // Integrate any remaining particles.
+    integrateParticleRange( particles, batch, vectorCount, batch.mCount );
+#else
+    integrateParticleRange( particles, batch, 0, batch.mCount );
+#endif
 }
 
 //------------------------------------------------------------------------------
 
-void ParticleSystem::freeParticle( ParticleNode* pParticleNode )
+void ParticleSystem::integrateParticlesScalar( ParticleStore& particles, const IntegrationBatch& batch )
 {
-    // Reset the particle.
-    pParticleNode->resetState();
+    // Sanity!
+    AssertFatal( batch.mStart + batch.mCount <= particles.getParticleCount(), "ParticleSystem::integrateParticlesScalar() - Batch is out of range." );
 
-    // Remove the previous node reference.
-    pParticleNode->mPreviousNode = NULL;
-    
-    // Insert the node into the free pool.
-    pParticleNode->mNextNode = mpFreeParticleNodes;
-    mpFreeParticleNodes = pParticleNode;
-
-    // Decrease the active particle count.
-    mActiveParticleCount--;
+    integrateParticleRange( particles, batch, 0, batch.mCount );
 }
 
+//------------------------------------------------------------------------------
+
+bool ParticleSystem::getVectorIntegration( void )
+{
+#if defined(PARTICLESYSTEM_SSE2) || defined(PARTICLESYSTEM_NEON)
+    return true;
+#else
+    return false;
+#endif
+}
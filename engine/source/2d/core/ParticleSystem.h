@@ -27,64 +27,108 @@
 #include "2d/core/ImageFrameProvider.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define PARTICLE_SYSTEM_BUDGET                  "$pref::T2D::ParticleBudget"
+#define PARTICLE_SYSTEM_MINIMUM_BUDGET_SHARE    0.5f
+
 //-----------------------------------------------------------------------------
 
 class ParticleSystem
 {
 public:
-    /// Particle node.
-    struct ParticleNode : public IFactoryObjectReset
+    /// Particle store.
+    /// Particles are stored as a structure-of-arrays ordered by age (oldest first) so that
+    /// integration and rendering stream through contiguous memory.
+    class ParticleStore
     {
-        /// Particle Node Linkages.
-        ParticleNode*           mPreviousNode;
-        ParticleNode*           mNextNode;
+    public:
+        ParticleStore();
+        ~ParticleStore();
 
-        /// Suppress Movement.
-        bool                    mSuppressMovement;
+        U32 createParticle( void );
+        void moveParticle( const U32 fromIndex, const U32 toIndex );
+        void setParticleCount( const U32 particleCount );
+        inline U32 getParticleCount( void ) const { return mParticleCount; }
 
         /// Particle Components.
-        F32                     mParticleLifetime;
-        F32                     mParticleAge;
-        Vector2                 mPosition;
-        Vector2                 mVelocity;
-        F32                     mOrientationAngle;
-        Vector2                 mRenderOOBB[4];
-        b2Transform             mTransform;
-        ImageFrameProviderCore  mFrameProvider;
+        F32*                        mParticleLifetime;
+        F32*                        mParticleAge;
+        Vector2*                    mPosition;
+        Vector2*                    mVelocity;
+        F32*                        mOrientationAngle;
+        ImageFrameProviderCore**    mFrameProvider;
 
         /// Render Properties.
-        Vector2                 mRenderSize;
-        F32                     mRenderSpeed;
-        F32                     mRenderSpin;
-        F32                     mRenderFixedForce;
-        F32                     mRenderRandomMotion;
+        Vector2*                    mRenderPosition;
+        b2Rot*                      mRenderRotation;
+        Vector2*                    mRenderSize;
+        ColorF*                     mColor;
 
         /// Base Properties.
-        Vector2                 mSize;
-        F32                     mSpeed;
-        F32                     mSpin;
-        F32                     mFixedForce;
-        F32                     mRandomMotion;
-        ColorF                  mColor;    
+        Vector2*                    mSize;
+        F32*                        mSpeed;
+        F32*                        mSpin;
+        F32*                        mFixedForce;
+        F32*                        mRandomMotion;
 
         /// Interpolated Tick Position.
-        Vector2                 mPreTickPosition;
-        Vector2                 mPostTickPosition;
-        Vector2                 mRenderTickPosition;
+        Vector2*                    mPreTickPosition;
+        Vector2*                    mPostTickPosition;
 
-        ParticleNode() { constructInPlace<ImageFrameProviderCore>(&mFrameProvider); resetState(); }
+    private:
+        void reserve( const U32 particleCapacity );
 
-        virtual void resetState( void )
-        {
-            mFrameProvider.resetState();
-        }
+        U32                         mParticleCount;
+        U32                         mParticleCapacity;
+    };
+
+    /// Particle integration batch.
+    /// The life-field values are sampled per-particle before integration as curve evaluation cannot be vectorized.
+    struct IntegrationBatch
+    {
+        U32                         mStart;
+        U32                         mCount;
+        F32                         mElapsedTime;
+
+        /// Sampled Life-Fields (indexed from zero for the batch).
+        const F32*                  mSizeXLife;
+        const F32*                  mSizeYLife;
+        const F32*                  mSpeedLife;
+        const F32*                  mFixedForceLife;
+        const F32*                  mSpinLife;
+        const ColorF*               mColorLife;
+
+        /// Emitter Limits.
+        Vector2                     mSizeXLimits;
+        Vector2                     mSizeYLimits;
+        Vector2                     mSpeedLimits;
+        Vector2                     mFixedForceLimits;
+        ColorF                      mColorMinimum;
+        ColorF                      mColorMaximum;
+
+        /// Emitter Properties.
+        bool                        mFixedAspect;
+        Vector2                     mFixedForceDirection;
+        F32                         mForceScale;
+
+        /// Render spin output (indexed from zero for the batch).
+        F32*                        mRenderSpin;
     };
 
 private:
-    const U32               mParticlePoolBlockSize;
-    Vector<ParticleNode*>   mParticlePool;
-    ParticleNode*           mpFreeParticleNodes;
-    U32                     mActiveParticleCount;
+    const U32                           mFrameProviderPoolBlockSize;
+    Vector<ImageFrameProviderCore*>     mFrameProviderPool;
+    Vector<ImageFrameProviderCore*>     mFreeFrameProviders;
+    U32                                 mActiveParticleCount;
+    U32                                 mLiveParticleCount;
+    Mutex                               mPoolLock;
+
+    static S32                          smParticleBudget;
 
 public:
     static void Init( void );
@@ -94,11 +138,27 @@ public:
     ParticleSystem();
     ~ParticleSystem();
 
-    ParticleNode* createParticle( void );
-    void freeParticle( ParticleNode* pParticleNode );
+    /// Particle frame providers are transferred in blocks to and from a caller-owned free-list.
+    /// NOTE:   The pool is locked so emitters can be integrated concurrently.  Free-lists are expected to
+    ///         hold frame providers that have already been reset.
+    void acquireParticles( Vector<ImageFrameProviderCore*>& freeList, const U32 particleCount );
+    void releaseParticles( Vector<ImageFrameProviderCore*>& freeList, const U32 particleCount );
 
+    /// NOTE: Particles held in caller-owned free-lists are counted as active.
     inline U32 getActiveParticleCount( void ) const { return mActiveParticleCount; };
-    inline U32 getAllocatedParticleCount( void ) const { return (U32)mParticlePool.size() * mParticlePoolBlockSize; }
+    inline U32 getAllocatedParticleCount( void ) const { return (U32)mFrameProviderPool.size() * mFrameProviderPoolBlockSize; }
+
+    /// Particle budget.
+    /// Emitters report their live particle count changes so emission can be throttled against a global budget.
+    /// NOTE:   The budget is soft; emitters integrated concurrently may briefly overshoot it.
+    void updateLiveParticleCount( const S32 particleCountDelta );
+    inline U32 getLiveParticleCount( void ) const { return mLiveParticleCount; }
+    inline U32 getParticleBudget( void ) const { return smParticleBudget > 0 ? (U32)smParticleBudget : 0; }
+    U32 getEmissionAllowance( const F32 priority ) const;
+
+    static void integrateParticles( ParticleStore& particles, const IntegrationBatch& batch );
+    static void integrateParticlesScalar( ParticleStore& particles, const IntegrationBatch& batch );
+    static bool getVectorIntegration( void );
 };
 
 #endif // _PARTICLE_SYSTEM_H_
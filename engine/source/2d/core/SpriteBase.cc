@@ -73,6 +73,50 @@ void SpriteBase::integrateObject( const F32 totalTime, const F32 elapsedTime, De
 
 //------------------------------------------------------------------------------
 
+void SpriteBase::setProcessTicks( bool tick )
+{
+    // Call image frame provider.
+    ImageFrameProvider::setProcessTicks( tick );
+
+    // Only integrate whilst the animation needs ticking and the scene animation clock isn't updating it.
+    setActiveTickInterest( TICK_INTEREST_ANIMATION, tick && !isAnimationClocked() );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBase::setEnabled( const bool enabled )
+{
+    // Call parent.
+    Parent::setEnabled( enabled );
+
+    // Update the scene animation clock.
+    updateSceneAnimationClock();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBase::OnRegisterScene( Scene* pScene )
+{
+    // Call parent.
+    Parent::OnRegisterScene( pScene );
+
+    // Update the scene animation clock.
+    updateSceneAnimationClock();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBase::OnUnregisterScene( Scene* pScene )
+{
+    // Stop using the scene animation clock.
+    setAnimationClock( NULL );
+
+    // Call parent.
+    Parent::OnUnregisterScene( pScene );
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBase::validRender( void ) const
 {
     return ImageFrameProvider::validRender();
@@ -99,6 +143,42 @@ void SpriteBase::copyTo(SimObject* object)
 
 void SpriteBase::onAnimationEnd( void )
 {
+    // Defer the script callback if integration is deferred.
+    if ( getDeferIntegration() )
+    {
+        deferIntegrationEvent( DEFERRED_ANIMATION_END );
+        return;
+    }
+
     // Do script callback.
     Con::executef( this, 1, "onAnimationEnd" );
 }
+
+//------------------------------------------------------------------------------
+
+void SpriteBase::onDeferredIntegration( const U32 deferredFlags )
+{
+    // Call Parent.
+    Parent::onDeferredIntegration( deferredFlags );
+
+    // Do script callback.
+    if ( deferredFlags & DEFERRED_ANIMATION_END )
+        Con::executef( this, 1, "onAnimationEnd" );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBase::updateSceneAnimationClock( void )
+{
+    // Fetch the scene.
+    Scene* pScene = getScene();
+
+    // Finish if not in a scene.
+    // NOTE:-   Leaving the scene stops using the scene animation clock explicitly.
+    if ( pScene == NULL )
+        return;
+
+    // Use the scene animation clock whilst enabled unless it's an editor scene where ticking is per-object.
+    // NOTE:-   Disabled objects are not ticked so leaving the clock (keeping the animation time) freezes the animation.
+    setAnimationClock( isEnabled() && !pScene->getIsEditorScene() ? &pScene->getAnimationClock() : NULL );
+}
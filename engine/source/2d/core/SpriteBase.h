@@ -44,6 +44,12 @@ public:
     static void initPersistFields();
 
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual bool getParallelIntegrateSafe( void ) const { return true; }
+    virtual void setProcessTicks( bool tick );
+    virtual void setEnabled( const bool enabled );
+
+    virtual void OnRegisterScene( Scene* pScene );
+    virtual void OnUnregisterScene( Scene* pScene );
 
     virtual bool validRender( void ) const;
     virtual bool shouldRender( void ) const { return true; }
@@ -55,6 +61,8 @@ public:
 
 protected:
     virtual void onAnimationEnd( void );
+    virtual void onDeferredIntegration( const U32 deferredFlags );
+    void updateSceneAnimationClock( void );
 
 protected:
     static bool setImage(void* obj, const char* data)                           { DYNAMIC_VOID_CAST_TO(SpriteBase, ImageFrameProvider, obj)->setImage(data); return false; };
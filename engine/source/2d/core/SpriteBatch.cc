@@ -39,14 +39,25 @@ static StringTableEntry spritesNodeName = StringTable->insert( "Sprites" );
 //------------------------------------------------------------------------------
 
 SpriteBatch::SpriteBatch() :
-    mMasterBatchId( 0 ),
     mSelectedSprite( NULL ),
     mBatchSortMode( SceneRenderQueue::RENDER_SORT_OFF ),
+    mBatchCulling( true ),
+    mBatchChunking( false ),
+    mBatchChunkSize( SPRITE_BATCH_DEFAULT_CHUNK_SIZE ),
     mDefaultSpriteStride( 1.0f, 1.0f),
     mDefaultSpriteSize( 1.0f, 1.0f ),
     mDefaultSpriteAngle( 0.0f ),
     mpSpriteBatchQuery( NULL ),
-    mBatchCulling( true )
+    mMasterBatchId( 0 ),
+    mSpriteGridX( 0 ),
+    mSpriteGridY( 0 ),
+    mSpriteGridWidth( 0 ),
+    mSpriteGridHeight( 0 ),
+    mSpriteGridCount( 0 ),
+    mpUnchunkedSprites( NULL ),
+    mBatchChunkMargin( 0.0f ),
+    mpAnimationClock( NULL ),
+    mTickingSpriteCount( 0 )
 {
     // Reset batch transform.
     mBatchTransform.SetIdentity();
@@ -62,6 +73,14 @@ SpriteBatch::SpriteBatch() :
 
 SpriteBatch::~SpriteBatch()
 {
+    // Destroy any batch chunks.
+    destroyBatchChunks();
+
+    // Delete the sprite blocks.
+    for( typeSpriteBatchVector::iterator blockItr = mSpriteBlocks.begin(); blockItr != mSpriteBlocks.end(); ++blockItr )
+    {
+        delete [] *blockItr;
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -84,6 +103,9 @@ void SpriteBatch::onRemove()
 
     // Delete the sprite batch query.
     destroySpriteBatchQuery();
+
+    // Destroy the batch chunks.
+    destroyBatchChunks();
 }
 
 //-----------------------------------------------------------------------------
@@ -99,6 +121,14 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
     // Calculate local AABB.
     const b2AABB localAABB = calculateLocalAABB( pSceneRenderState->mRenderAABB );
 
+    // Are we chunking the batch?
+    if ( mBatchChunking )
+    {
+        // Yes, so prepare the batch chunks.
+        prepareBatchChunks( pSceneRenderObject, pSceneRenderState, pSceneRenderQueue, localAABB );
+        return;
+    }
+
     // Do we have a sprite batch query?
     if ( mpSpriteBatchQuery != NULL )
     {
@@ -153,10 +183,10 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
     else
     {
         // No, so perform a render request for all the sprites.
-        for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+        for( typeSpriteBatchVector::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
         {
             // Fetch sprite batch Item.
-            SpriteBatchItem* pSpriteBatchItem = spriteItr->value;
+            SpriteBatchItem* pSpriteBatchItem = *spriteItr;
 
             // Skip if not visible.
             if ( !pSpriteBatchItem->getVisible() )
@@ -181,6 +211,39 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
 
 void SpriteBatch::render( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer )
 {
+    // Is this a batch chunk?
+    if ( pSceneRenderRequest->mpCustomData2 == this )
+    {
+        // Yes, so debug Profiling.
+        PROFILE_SCOPE(SpriteBatch_RenderChunk);
+
+        // Fetch batch chunk.
+        const SpriteBatchChunk* pBatchChunk = (const SpriteBatchChunk*)pSceneRenderRequest->mpCustomData1;
+
+        // Set the blend mode.
+        pBatchRenderer->setBlendMode( pSceneRenderRequest );
+
+        // Set the alpha test mode.
+        pBatchRenderer->setAlphaTestMode( pSceneRenderRequest );
+
+        // Submit the cached quads for each texture.
+        for( Vector<SpriteBatchChunk::TextureRun>::const_iterator runItr = pBatchChunk->mTextureRuns.begin(); runItr != pBatchChunk->mTextureRuns.end(); ++runItr )
+        {
+            // Fetch the start vertex.
+            const U32 vertexIndex = runItr->mQuadStart * 4;
+
+            // Batch render.
+            pBatchRenderer->SubmitQuads(
+                runItr->mQuadCount,
+                pBatchChunk->mVertices.address() + vertexIndex,
+                pBatchChunk->mTextureCoords.address() + vertexIndex,
+                pBatchChunk->mUseColor ? pBatchChunk->mColors.address() + vertexIndex : NULL,
+                const_cast<TextureHandle&>( runItr->mTexture ) );
+        }
+
+        return;
+    }
+
     // Fetch sprite batch Item.
     SpriteBatchItem* pSpriteBatchItem = (SpriteBatchItem*)pSceneRenderRequest->mpCustomData1;
 
@@ -275,16 +338,20 @@ void SpriteBatch::copyTo( SpriteBatch* pSpriteBatch ) const
     // Set batch culling.
     pSpriteBatch->setBatchCulling( getBatchCulling() );
 
+    // Set batch chunking.
+    pSpriteBatch->setBatchChunkSize( getBatchChunkSize() );
+    pSpriteBatch->setBatchChunking( getBatchChunking() );
+
     // Set sprite default size and angle.
     pSpriteBatch->setDefaultSpriteStride( getDefaultSpriteStride() );
     pSpriteBatch->setDefaultSpriteSize( getDefaultSpriteSize() );
     pSpriteBatch->setDefaultSpriteAngle( getDefaultSpriteAngle() );
 
     // Copy sprites.   
-    for( typeSpriteBatchHash::const_iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    for( typeSpriteBatchVector::const_iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
     {        
         // Fetch sprite.
-        SpriteBatchItem* pSpriteBatchItem = spriteItr->value;
+        SpriteBatchItem* pSpriteBatchItem = *spriteItr;
 
         // Add a sprite.
         const U32 spriteBatchId = pSpriteBatch->addSprite( pSpriteBatchItem->getLogicalPosition() );
@@ -313,7 +380,7 @@ U32 SpriteBatch::addSprite( const SpriteBatchItem::LogicalPosition& logicalPosit
 
     // Insert logical position into sprite positions if it's valid.
     if ( logicalPosition.isValid() )
-        mSpritePositions.insert( logicalPosition, mSelectedSprite );
+        insertSpritePosition( logicalPosition, mSelectedSprite );
 
     // Flag local extents as dirty.
     setLocalExtentsDirty();
@@ -335,7 +402,7 @@ bool SpriteBatch::removeSprite( void )
     // Remove the sprite logical position if it's valid.
     const SpriteBatchItem::LogicalPosition& logicalPosition = mSelectedSprite->getLogicalPosition();
     if ( logicalPosition.isValid() )
-        mSpritePositions.erase( mSelectedSprite->getLogicalPosition() );
+        eraseSpritePosition( logicalPosition );
 
     // Fetch and remove any sprite name.
     StringTableEntry spriteName = mSelectedSprite->getName();
@@ -364,20 +431,29 @@ void SpriteBatch::clearSprites( void )
     // Deselect any sprite.
     deselectSprite();
 
+    // Destroy any batch chunks.
+    destroyBatchChunks();
+
     // Clear sprite positions.
     mSpritePositions.clear();
+    clearSpriteGrid();
 
     // Clear sprite names.
     mSpriteNames.clear();
 
-    // Cache all sprites.
-    for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    // Release all sprites.
+    for( typeSpriteBatchVector::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
     {
-        SpriteBatchItemFactory.cacheObject( spriteItr->value );
+        releaseSprite( *spriteItr );
     }
     mSprites.clear();
+    mSpriteIds.clear();
     mMasterBatchId = 0;
 
+    // Create the batch chunks if chunking.
+    if ( mBatchChunking )
+        createBatchChunks();
+
     // Flag local extents as dirty.
     setLocalExtentsDirty();
 }
@@ -402,6 +478,118 @@ void SpriteBatch::setBatchCulling( const bool batchCulling )
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::setBatchChunking( const bool batchChunking )
+{
+    // Finish if no change.
+    if ( mBatchChunking == batchChunking )
+        return;
+
+    // Set batch chunking.
+    mBatchChunking = batchChunking;
+
+    // Create/destroy batch chunks appropriately.
+    if ( mBatchChunking )
+        createBatchChunks();
+    else
+        destroyBatchChunks();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::setBatchChunkSize( const F32 chunkSize )
+{
+    // Sanity!
+    if ( chunkSize <= 0.0f )
+    {
+        Con::warnf( "SpriteBatch::setBatchChunkSize() - Invalid chunk size of '%g'.", chunkSize );
+        return;
+    }
+
+    // Finish if no change.
+    if ( mIsEqual( mBatchChunkSize, chunkSize ) )
+        return;
+
+    // Set batch chunk size.
+    mBatchChunkSize = chunkSize;
+
+    // Finish if not chunking.
+    if ( !mBatchChunking )
+        return;
+
+    // Recreate the batch chunks.
+    destroyBatchChunks();
+    createBatchChunks();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::updateBatchChunkSprite( SpriteBatchItem* pSpriteBatchItem )
+{
+    // Sanity!
+    AssertFatal( pSpriteBatchItem != NULL, "SpriteBatch::updateBatchChunkSprite() - Cannot update a NULL sprite batch item." );
+    AssertFatal( pSpriteBatchItem->mpBatchChunk != NULL, "SpriteBatch::updateBatchChunkSprite() - Sprite batch item is not in a batch chunk." );
+
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_UpdateBatchChunkSprite);
+
+    // Flag the current batch chunk as dirty.
+    pSpriteBatchItem->mpBatchChunk->mDirty = true;
+
+    // Fetch the batch chunk the sprite should be in.
+    SpriteBatchChunk* pBatchChunk = isChunkable( pSpriteBatchItem ) ? findBatchChunk( getBatchChunkKey( pSpriteBatchItem->getLocalPosition() ), true ) : mpUnchunkedSprites;
+
+    // Finish if the sprite is already in the batch chunk.
+    if ( pBatchChunk == pSpriteBatchItem->mpBatchChunk )
+        return;
+
+    // Move the sprite to the batch chunk.
+    removeBatchChunkSprite( pSpriteBatchItem );
+    addBatchChunkSprite( pBatchChunk, pSpriteBatchItem );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::removeBatchChunkSprite( SpriteBatchItem* pSpriteBatchItem )
+{
+    // Sanity!
+    AssertFatal( pSpriteBatchItem != NULL, "SpriteBatch::removeBatchChunkSprite() - Cannot remove a NULL sprite batch item." );
+
+    // Fetch the batch chunk.
+    SpriteBatchChunk* pBatchChunk = pSpriteBatchItem->mpBatchChunk;
+
+    // Finish if not in a batch chunk.
+    if ( pBatchChunk == NULL )
+        return;
+
+    // Fetch the sprite index.
+    const U32 spriteIndex = (U32)pSpriteBatchItem->mBatchChunkIndex;
+
+    // Sanity!
+    AssertFatal( spriteIndex < (U32)pBatchChunk->mSprites.size() && pBatchChunk->mSprites[spriteIndex] == pSpriteBatchItem, "SpriteBatch::removeBatchChunkSprite() - Invalid batch chunk index." );
+
+    // Remove the sprite, moving the last sprite into its place.
+    pBatchChunk->mSprites.erase_fast( spriteIndex );
+    if ( spriteIndex < (U32)pBatchChunk->mSprites.size() )
+        pBatchChunk->mSprites[spriteIndex]->mBatchChunkIndex = spriteIndex;
+
+    // Reset the sprite batch chunk.
+    pSpriteBatchItem->mpBatchChunk = NULL;
+    pSpriteBatchItem->mBatchChunkIndex = -1;
+
+    // Flag the batch chunk as dirty.
+    pBatchChunk->mDirty = true;
+
+    // Finish if the batch chunk is not empty or is the unchunked sprites.
+    if ( pBatchChunk->mSprites.size() > 0 || pBatchChunk == mpUnchunkedSprites )
+        return;
+
+    // Destroy the empty batch chunk.
+    mBatchChunks.erase( pBatchChunk->mKey );
+    delete pBatchChunk;
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBatch::selectSprite( const SpriteBatchItem::LogicalPosition& logicalPosition )
 {
     // Select sprite.
@@ -419,6 +607,23 @@ bool SpriteBatch::selectSprite( const SpriteBatchItem::LogicalPosition& logicalP
 
 //------------------------------------------------------------------------------
 
+bool SpriteBatch::selectSpriteCell( const S32 cellX, const S32 cellY )
+{
+    // Select sprite.
+    mSelectedSprite = findSpriteCell( cellX, cellY );
+
+    // Finish if we selected the sprite.
+    if ( mSelectedSprite != NULL )
+        return true;
+
+    // Not selected so warn.
+    Con::warnf( "Cannot select sprite at logical position '%d %d' as one does not exist.", cellX, cellY );
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBatch::selectSpriteId( const U32 batchId )
 {
     // Select sprite.
@@ -627,6 +832,9 @@ void SpriteBatch::clearSpriteAsset( void )
 
     // Clear the asset.
     mSelectedSprite->clearAssets();
+
+    // Flag the batch chunk as dirty.
+    mSelectedSprite->setBatchChunkDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -1100,13 +1308,24 @@ SpriteBatchItem* SpriteBatch::createSprite( void )
     const U32 batchId = ++mMasterBatchId;
 
     // Create sprite batch item,
-    SpriteBatchItem* pSpriteBatchItem = SpriteBatchItemFactory.createObject();
+    SpriteBatchItem* pSpriteBatchItem = allocateSprite();
 
     // Set batch parent.
     pSpriteBatchItem->setBatchParent( this, batchId );
 
-    // Create sprite batch item,
-    mSprites.insert( batchId, pSpriteBatchItem );
+    // Use the batch animation clock.
+    pSpriteBatchItem->setAnimationClock( mpAnimationClock );
+
+    // Add to a batch chunk if chunking.
+    // NOTE: The sprite moves between batch chunks as it is configured.
+    if ( mpUnchunkedSprites != NULL )
+    {
+        addBatchChunkSprite( mpUnchunkedSprites, pSpriteBatchItem );
+        updateBatchChunkSprite( pSpriteBatchItem );
+    }
+
+    // Insert sprite batch item.
+    insertSprite( pSpriteBatchItem );
 
     return pSpriteBatchItem;
 }
@@ -1122,19 +1341,29 @@ SpriteBatchItem* SpriteBatch::createSprite( const Vector2* explicitVertices  )
     const U32 batchId = ++mMasterBatchId;
 
     // Create sprite batch item,
-    SpriteBatchItem* pSpriteBatchItem = SpriteBatchItemFactory.createObject();
+    SpriteBatchItem* pSpriteBatchItem = allocateSprite();
 
     // Set batch parent.
     pSpriteBatchItem->setBatchParent( this, batchId );
 
+    // Use the batch animation clock.
+    pSpriteBatchItem->setAnimationClock( mpAnimationClock );
+
+    // Add to a batch chunk if chunking.
+    if ( mpUnchunkedSprites != NULL )
+    {
+        addBatchChunkSprite( mpUnchunkedSprites, pSpriteBatchItem );
+        updateBatchChunkSprite( pSpriteBatchItem );
+    }
+
     // Set explicit mode.
     pSpriteBatchItem->setExplicitMode( true );
 
     // Set explicit vertices.
 
 
-    // Create sprite batch item,
-    mSprites.insert( batchId, pSpriteBatchItem );
+    // Insert sprite batch item.
+    insertSprite( pSpriteBatchItem );
 
     return pSpriteBatchItem;
 }
@@ -1150,6 +1379,15 @@ SpriteBatchItem* SpriteBatch::findSpritePosition( const SpriteBatchItem::Logical
     if ( !logicalPosition.isValid() )
         return NULL;
 
+    // Is the logical position a cell?
+    if ( logicalPosition.isCell() )
+    {
+        // Yes, so finish if the cell is in the sprite grid.
+        SpriteBatchItem** ppSpriteBatchItem = findSpriteGridCell( logicalPosition.getCellX(), logicalPosition.getCellY() );
+        if ( ppSpriteBatchItem != NULL )
+            return *ppSpriteBatchItem;
+    }
+
     // Find sprite.
     typeSpritePositionHash::iterator spriteItr = mSpritePositions.find( logicalPosition );
 
@@ -1164,9 +1402,32 @@ SpriteBatchItem* SpriteBatch::findSpriteId( const U32 batchId )
     PROFILE_SCOPE(SpriteBatch_FindSpriteId);
 
     // Find sprite.
-    typeSpriteBatchHash::iterator spriteItr = mSprites.find( batchId );
+    // NOTE: Batch Ids are never reused so they are hashed rather than indexed to keep the lookup bounded by the live sprites.
+    typeSpriteIdHash::iterator spriteItr = mSpriteIds.find( batchId );
+
+    return spriteItr == mSpriteIds.end() ? NULL : spriteItr->value;
+}
+
+//------------------------------------------------------------------------------
+
+SpriteBatchItem* SpriteBatch::findSpriteCell( const S32 cellX, const S32 cellY )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_FindSpriteCell);
+
+    // Finish if the cell is in the sprite grid.
+    SpriteBatchItem** ppSpriteBatchItem = findSpriteGridCell( cellX, cellY );
+    if ( ppSpriteBatchItem != NULL )
+        return *ppSpriteBatchItem;
+
+    // Finish if there are no other sprite positions.
+    if ( mSpritePositions.size() == 0 )
+        return NULL;
 
-    return spriteItr != mSprites.end() ? spriteItr->value : NULL;
+    // Find the sprite position.
+    char cellBuffer[32];
+    dSprintf( cellBuffer, sizeof(cellBuffer), "%d %d", cellX, cellY );
+    return findSpritePosition( SpriteBatchItem::LogicalPosition( cellBuffer ) );
 }
 
 //------------------------------------------------------------------------------
@@ -1241,16 +1502,57 @@ SpriteBatchItem* SpriteBatch::createSprite( const SpriteBatchItem::LogicalPositi
 
 void SpriteBatch::integrateSprites(const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats)
 {
+   // Finish if no sprites need ticking.
+   // NOTE: Sprites updated by the scene animation clock don't need ticking.
+   if ( mTickingSpriteCount == 0 )
+      return;
+
    //process the elapsed time for all sprites
-   for (typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr)
+   for (typeSpriteBatchVector::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr)
    {
       // Update image frame provider.
-      spriteItr->value->ImageFrameProvider::update(elapsedTime);
+      (*spriteItr)->ImageFrameProvider::update(elapsedTime);
    }
 }
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::setAnimationClock( SceneAnimationClock* pAnimationClock )
+{
+    // Finish if no change.
+    if ( pAnimationClock == mpAnimationClock )
+        return;
+
+    // Set the animation clock.
+    mpAnimationClock = pAnimationClock;
+
+    // Set the sprites animation clock.
+    for( typeSpriteBatchVector::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    {
+        (*spriteItr)->setAnimationClock( pAnimationClock );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::setSpriteTicking( const bool ticking )
+{
+    // Sanity!
+    AssertFatal( ticking || mTickingSpriteCount > 0, "SpriteBatch::setSpriteTicking() - Ticking sprite count underflow." );
+
+    // Update the ticking sprite count.
+    if ( ticking )
+        mTickingSpriteCount++;
+    else
+        mTickingSpriteCount--;
+
+    // Notify if the sprites started or stopped ticking.
+    if ( mTickingSpriteCount == (ticking ? 1 : 0) )
+        onSpriteTicking( ticking );
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBatch::setBatchTransform( const b2Transform& batchTransform )
 {
     // Update world transform.
@@ -1284,15 +1586,15 @@ void SpriteBatch::updateLocalExtents( void )
     }
 
     // Fetch first sprite.
-    typeSpriteBatchHash::iterator spriteItr = mSprites.begin();
+    typeSpriteBatchVector::iterator spriteItr = mSprites.begin();
 
     // Set render AABB to this sprite.
-    b2AABB localAABB = spriteItr->value->getLocalAABB();
+    b2AABB localAABB = (*spriteItr)->getLocalAABB();
 
     // Combine with the rest of the sprites.
     for( ; spriteItr != mSprites.end(); ++spriteItr )
     {
-        localAABB.Combine( spriteItr->value->getLocalAABB() );
+        localAABB.Combine( (*spriteItr)->getLocalAABB() );
     }
 
     // Fetch local render extents.
@@ -1328,10 +1630,10 @@ void SpriteBatch::createSpriteBatchQuery( void )
         return;
 
     // Add proxies for all the sprites.
-    for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    for( typeSpriteBatchVector::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
     {
         // Fetch sprite batch item.
-        SpriteBatchItem* pSpriteBatchItem = spriteItr->value;
+        SpriteBatchItem* pSpriteBatchItem = *spriteItr;
 
         // Create query proxy for sprite.
         createQueryProxy( pSpriteBatchItem );
@@ -1353,10 +1655,10 @@ void SpriteBatch::destroySpriteBatchQuery( void )
     if ( mSprites.size() > 0 )
     {
         // Yes, so destroy proxies of all the sprites.
-        for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+        for( typeSpriteBatchVector::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
         {
             // Destroy query proxy for sprite.
-            destroyQueryProxy( spriteItr->value );
+            destroyQueryProxy( *spriteItr );
         }
     }
 
@@ -1373,29 +1675,263 @@ bool SpriteBatch::destroySprite( const U32 batchId )
     PROFILE_SCOPE(SpriteBatch_DestroySprite);
 
     // Find sprite.
-    typeSpriteBatchHash::iterator spriteItr = mSprites.find( batchId );
+    SpriteBatchItem* pSpriteBatchItem = findSpriteId( batchId );
 
     // Finish if sprite not found.
-    if ( spriteItr == mSprites.end() )
+    if ( pSpriteBatchItem == NULL )
         return false;
 
-    // Find sprite.    
-    SpriteBatchItem* pSpriteBatchItem = spriteItr->value;
+    // Fetch sprite index.
+    const U32 spriteIndex = pSpriteBatchItem->mBatchIndex;
+
+    // Sanity!
+    AssertFatal( spriteIndex < (U32)mSprites.size() && mSprites[spriteIndex] == pSpriteBatchItem, "SpriteBatch::destroySprite() - Invalid sprite index." );
+
+    // Remove from sprites, moving the last sprite into its place.
+    mSprites.erase_fast( spriteIndex );
+    if ( spriteIndex < (U32)mSprites.size() )
+        mSprites[spriteIndex]->mBatchIndex = spriteIndex;
+
+    // Remove from sprite Ids.
+    mSpriteIds.erase( batchId );
+
+    // Release sprite.
+    releaseSprite( pSpriteBatchItem );
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+
+SpriteBatchItem* SpriteBatch::allocateSprite( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_AllocateSprite);
+
+    // Do we have any free sprites?
+    if ( mFreeSprites.size() == 0 )
+    {
+        // No, so allocate a contiguous sprite block.
+        SpriteBatchItem* pSpriteBlock = new SpriteBatchItem[SPRITE_BATCH_ITEM_BLOCK_SIZE];
+        mSpriteBlocks.push_back( pSpriteBlock );
+
+        // Add the block sprites as free in reverse so they are allocated in order.
+        mFreeSprites.reserve( SPRITE_BATCH_ITEM_BLOCK_SIZE );
+        for( S32 index = SPRITE_BATCH_ITEM_BLOCK_SIZE-1; index >= 0; --index )
+        {
+            mFreeSprites.push_back( pSpriteBlock + index );
+        }
+    }
+
+    // Fetch a free sprite.
+    SpriteBatchItem* pSpriteBatchItem = mFreeSprites.back();
+    mFreeSprites.pop_back();
+
+    return pSpriteBatchItem;
+}
+
+//------------------------------------------------------------------------------
 
+void SpriteBatch::releaseSprite( SpriteBatchItem* pSpriteBatchItem )
+{
     // Sanity!
-    AssertFatal( pSpriteBatchItem != NULL, "SpriteBatch::destroySprite() - Found sprite but it was NULL." );
+    AssertFatal( pSpriteBatchItem != NULL, "SpriteBatch::releaseSprite() - Cannot release a NULL sprite." );
+
+    // Reset the sprite.
+    pSpriteBatchItem->resetState();
+
+    // Stop using the animation clock.
+    pSpriteBatchItem->setAnimationClock( NULL );
+
+    // Add as a free sprite.
+    mFreeSprites.push_back( pSpriteBatchItem );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::insertSprite( SpriteBatchItem* pSpriteBatchItem )
+{
+    // Fetch batch Id.
+    const U32 batchId = pSpriteBatchItem->getBatchId();
+
+    // Grow the sprites geometrically.
+    if ( (U32)mSprites.size() == mSprites.capacity() )
+        mSprites.reserve( getMax( (U32)SPRITE_BATCH_ITEM_BLOCK_SIZE, mSprites.capacity() * 2 ) );
+
+    // Add to sprites.
+    pSpriteBatchItem->mBatchIndex = mSprites.size();
+    mSprites.push_back( pSpriteBatchItem );
+
+    // Add to sprite Ids.
+    mSpriteIds.insert( batchId, pSpriteBatchItem );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::insertSpritePosition( const SpriteBatchItem::LogicalPosition& logicalPosition, SpriteBatchItem* pSpriteBatchItem )
+{
+    // Is the logical position a cell?
+    if ( logicalPosition.isCell() )
+    {
+        // Yes, so find the cell in the sprite grid, growing it if possible.
+        const S32 cellX = logicalPosition.getCellX();
+        const S32 cellY = logicalPosition.getCellY();
+        SpriteBatchItem** ppSpriteBatchItem = findSpriteGridCell( cellX, cellY );
+        if ( ppSpriteBatchItem == NULL && growSpriteGrid( cellX, cellY ) )
+            ppSpriteBatchItem = findSpriteGridCell( cellX, cellY );
+
+        // Did we find the cell?
+        if ( ppSpriteBatchItem != NULL )
+        {
+            // Yes, so insert into the sprite grid.
+            if ( *ppSpriteBatchItem == NULL )
+                mSpriteGridCount++;
 
-    // Cache sprite.
-    SpriteBatchItemFactory.cacheObject( pSpriteBatchItem );
+            *ppSpriteBatchItem = pSpriteBatchItem;
+            return;
+        }
+    }
+
+    // Insert into sprite positions.
+    mSpritePositions.insert( logicalPosition, pSpriteBatchItem );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::eraseSpritePosition( const SpriteBatchItem::LogicalPosition& logicalPosition )
+{
+    // Is the logical position a cell?
+    if ( logicalPosition.isCell() )
+    {
+        // Yes, so is the cell in the sprite grid?
+        SpriteBatchItem** ppSpriteBatchItem = findSpriteGridCell( logicalPosition.getCellX(), logicalPosition.getCellY() );
+        if ( ppSpriteBatchItem != NULL )
+        {
+            // Yes, so erase from the sprite grid.
+            if ( *ppSpriteBatchItem != NULL )
+                mSpriteGridCount--;
+
+            *ppSpriteBatchItem = NULL;
+            return;
+        }
+    }
+
+    // Erase from sprite positions.
+    mSpritePositions.erase( logicalPosition );
+}
+
+//------------------------------------------------------------------------------
+
+SpriteBatchItem** SpriteBatch::findSpriteGridCell( const S32 cellX, const S32 cellY )
+{
+    // Calculate the offset cell.
+    const U32 offsetX = (U32)(cellX - mSpriteGridX);
+    const U32 offsetY = (U32)(cellY - mSpriteGridY);
 
-    // Remove from sprites.
-    mSprites.erase( batchId );
+    // Finish if the cell is outside the sprite grid.
+    if ( offsetX >= (U32)mSpriteGridWidth || offsetY >= (U32)mSpriteGridHeight )
+        return NULL;
+
+    return mSpriteGrid.address() + (offsetY * mSpriteGridWidth) + offsetX;
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatch::growSpriteGrid( const S32 cellX, const S32 cellY )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_GrowSpriteGrid);
+
+    // Calculate the bounds required to include the cell.
+    const bool emptyGrid = mSpriteGridWidth == 0;
+    const S64 gridUpperX = (S64)mSpriteGridX + mSpriteGridWidth - 1;
+    const S64 gridUpperY = (S64)mSpriteGridY + mSpriteGridHeight - 1;
+    const S64 lowerX = emptyGrid || cellX < mSpriteGridX ? cellX : mSpriteGridX;
+    const S64 lowerY = emptyGrid || cellY < mSpriteGridY ? cellY : mSpriteGridY;
+    const S64 upperX = emptyGrid || cellX > gridUpperX ? cellX : gridUpperX;
+    const S64 upperY = emptyGrid || cellY > gridUpperY ? cellY : gridUpperY;
+    S64 width = upperX - lowerX + 1;
+    S64 height = upperY - lowerY + 1;
+
+    // Calculate the maximum area allowed for the sprites positioned.
+    const S64 maximumArea = (S64)SPRITE_BATCH_GRID_MAXIMUM_SPARSITY * (S64)(mSpriteGridCount + mSpritePositions.size() + 1);
+
+    // Finish if the required area is too sparse.
+    if ( width * height > maximumArea && width * height > SPRITE_BATCH_GRID_MINIMUM_AREA )
+        return false;
+
+    // Double any growing dimension to amortize growth if the area allows.
+    const S64 grownWidth = width > mSpriteGridWidth && width < (S64)mSpriteGridWidth * 2 ? (S64)mSpriteGridWidth * 2 : width;
+    const S64 grownHeight = height > mSpriteGridHeight && height < (S64)mSpriteGridHeight * 2 ? (S64)mSpriteGridHeight * 2 : height;
+    if ( grownWidth * grownHeight <= maximumArea || grownWidth * grownHeight <= SPRITE_BATCH_GRID_MINIMUM_AREA )
+    {
+        width = grownWidth;
+        height = grownHeight;
+    }
+
+    // Grow toward the cell.
+    const S32 gridX = (S32)( cellX < mSpriteGridX ? upperX - width + 1 : lowerX );
+    const S32 gridY = (S32)( cellY < mSpriteGridY ? upperY - height + 1 : lowerY );
+
+    // Create the new sprite grid.
+    typeSpriteBatchVector spriteGrid;
+    spriteGrid.setSize( (U32)(width * height) );
+    dMemset( spriteGrid.address(), 0, spriteGrid.size() * sizeof(SpriteBatchItem*) );
+
+    // Copy the existing sprite grid.
+    for( S32 y = 0; y < mSpriteGridHeight; ++y )
+    {
+        dMemcpy(
+            spriteGrid.address() + ((mSpriteGridY + y - gridY) * (S32)width) + (mSpriteGridX - gridX),
+            mSpriteGrid.address() + (y * mSpriteGridWidth),
+            mSpriteGridWidth * sizeof(SpriteBatchItem*) );
+    }
+
+    // Set the new sprite grid.
+    mSpriteGrid = spriteGrid;
+    mSpriteGridX = gridX;
+    mSpriteGridY = gridY;
+    mSpriteGridWidth = (S32)width;
+    mSpriteGridHeight = (S32)height;
+
+    // Finish if there are no other sprite positions.
+    if ( mSpritePositions.size() == 0 )
+        return true;
+
+    // Find any other sprite positions that are now in the sprite grid.
+    typeSpriteBatchVector gridSprites;
+    for( typeSpritePositionHash::iterator spriteItr = mSpritePositions.begin(); spriteItr != mSpritePositions.end(); ++spriteItr )
+    {
+        const SpriteBatchItem::LogicalPosition& logicalPosition = spriteItr->key;
+        if ( logicalPosition.isCell() && findSpriteGridCell( logicalPosition.getCellX(), logicalPosition.getCellY() ) != NULL )
+            gridSprites.push_back( spriteItr->value );
+    }
+
+    // Move them into the sprite grid.
+    for( typeSpriteBatchVector::iterator spriteItr = gridSprites.begin(); spriteItr != gridSprites.end(); ++spriteItr )
+    {
+        const SpriteBatchItem::LogicalPosition& logicalPosition = (*spriteItr)->getLogicalPosition();
+        mSpritePositions.erase( logicalPosition );
+        insertSpritePosition( logicalPosition, *spriteItr );
+    }
 
     return true;
 }
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::clearSpriteGrid( void )
+{
+    mSpriteGrid.clear();
+    mSpriteGridX = 0;
+    mSpriteGridY = 0;
+    mSpriteGridWidth = 0;
+    mSpriteGridHeight = 0;
+    mSpriteGridCount = 0;
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBatch::checkSpriteSelected( void ) const
 {
     // Finish if a sprite is selected.
@@ -1429,6 +1965,366 @@ b2AABB SpriteBatch::calculateLocalAABB( const b2AABB& renderAABB )
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::createBatchChunks( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_CreateBatchChunks);
+
+    // Finish if batch chunking is off or there are already batch chunks.
+    if ( !mBatchChunking || mpUnchunkedSprites != NULL )
+        return;
+
+    // Create the unchunked sprites.
+    mpUnchunkedSprites = new SpriteBatchChunk( 0 );
+
+    // Reset the batch chunk margin.
+    mBatchChunkMargin = 0.0f;
+
+    // Add all the sprites.
+    for( typeSpriteBatchVector::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    {
+        // Fetch sprite batch item.
+        SpriteBatchItem* pSpriteBatchItem = *spriteItr;
+
+        // Add to the appropriate batch chunk.
+        addBatchChunkSprite( isChunkable( pSpriteBatchItem ) ? findBatchChunk( getBatchChunkKey( pSpriteBatchItem->getLocalPosition() ), true ) : mpUnchunkedSprites, pSpriteBatchItem );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::destroyBatchChunks( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_DestroyBatchChunks);
+
+    // Finish if there are no batch chunks.
+    if ( mpUnchunkedSprites == NULL )
+        return;
+
+    // Remove all the sprites from their batch chunks.
+    for( typeSpriteBatchVector::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    {
+        // Fetch sprite batch item.
+        SpriteBatchItem* pSpriteBatchItem = *spriteItr;
+
+        pSpriteBatchItem->mpBatchChunk = NULL;
+        pSpriteBatchItem->mBatchChunkIndex = -1;
+    }
+
+    // Delete the batch chunks.
+    for( typeBatchChunkHash::iterator chunkItr = mBatchChunks.begin(); chunkItr != mBatchChunks.end(); ++chunkItr )
+    {
+        delete chunkItr->value;
+    }
+    mBatchChunks.clear();
+
+    // Delete the unchunked sprites.
+    delete mpUnchunkedSprites;
+    mpUnchunkedSprites = NULL;
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatch::isChunkable( SpriteBatchItem* pSpriteBatchItem ) const
+{
+    // Only static images using the default render state can be cached.
+    // NOTE: The blend color is cached per-vertex so it can vary.
+    return
+        pSpriteBatchItem->isStaticFrameProvider() &&
+        pSpriteBatchItem->getBlendMode() &&
+        pSpriteBatchItem->getSrcBlendFactor() == GL_SRC_ALPHA &&
+        pSpriteBatchItem->getDstBlendFactor() == GL_ONE_MINUS_SRC_ALPHA &&
+        pSpriteBatchItem->getAlphaTest() < 0.0f &&
+        pSpriteBatchItem->getRenderGroup() == StringTable->EmptyString &&
+        mIsZero( pSpriteBatchItem->getDepth() );
+}
+
+//------------------------------------------------------------------------------
+
+U32 SpriteBatch::getBatchChunkKey( const Vector2& localPosition ) const
+{
+    // Calculate the chunk cell.
+    const S32 cellX = (S32)mFloor( localPosition.x / mBatchChunkSize );
+    const S32 cellY = (S32)mFloor( localPosition.y / mBatchChunkSize );
+
+    // Pack the cell into the key.
+    // NOTE: Cells that wrap simply share a chunk whose bounds are calculated from its sprites.
+    return ((U32)(U16)cellX << 16) | (U32)(U16)cellY;
+}
+
+//------------------------------------------------------------------------------
+
+SpriteBatchChunk* SpriteBatch::findBatchChunk( const U32 chunkKey, const bool createChunk )
+{
+    // Find batch chunk.
+    typeBatchChunkHash::iterator chunkItr = mBatchChunks.find( chunkKey );
+
+    // Finish if found.
+    if ( chunkItr != mBatchChunks.end() )
+        return chunkItr->value;
+
+    // Finish if not creating the batch chunk.
+    if ( !createChunk )
+        return NULL;
+
+    // Create the batch chunk.
+    SpriteBatchChunk* pBatchChunk = new SpriteBatchChunk( chunkKey );
+    mBatchChunks.insert( chunkKey, pBatchChunk );
+
+    return pBatchChunk;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::addBatchChunkSprite( SpriteBatchChunk* pBatchChunk, SpriteBatchItem* pSpriteBatchItem )
+{
+    // Sanity!
+    AssertFatal( pBatchChunk != NULL, "SpriteBatch::addBatchChunkSprite() - Cannot add to a NULL batch chunk." );
+    AssertFatal( pSpriteBatchItem->mpBatchChunk == NULL, "SpriteBatch::addBatchChunkSprite() - Sprite batch item is already in a batch chunk." );
+
+    // Add the sprite.
+    pSpriteBatchItem->mpBatchChunk = pBatchChunk;
+    pSpriteBatchItem->mBatchChunkIndex = pBatchChunk->mSprites.size();
+    pBatchChunk->mSprites.push_back( pSpriteBatchItem );
+
+    // Flag the batch chunk as dirty.
+    pBatchChunk->mDirty = true;
+
+    // Finish if this is the unchunked sprites.
+    if ( pBatchChunk == mpUnchunkedSprites )
+        return;
+
+    // Calculate the chunk cell bounds.
+    const Vector2 cellLower( mFloor( pSpriteBatchItem->getLocalPosition().x / mBatchChunkSize ) * mBatchChunkSize, mFloor( pSpriteBatchItem->getLocalPosition().y / mBatchChunkSize ) * mBatchChunkSize );
+    const Vector2 cellUpper = cellLower + Vector2( mBatchChunkSize, mBatchChunkSize );
+
+    // Grow the batch chunk margin so that culling includes sprites overhanging their cell.
+    const b2AABB& localAABB = pSpriteBatchItem->getLocalAABB();
+    mBatchChunkMargin = getMax( mBatchChunkMargin, cellLower.x - localAABB.lowerBound.x );
+    mBatchChunkMargin = getMax( mBatchChunkMargin, cellLower.y - localAABB.lowerBound.y );
+    mBatchChunkMargin = getMax( mBatchChunkMargin, localAABB.upperBound.x - cellUpper.x );
+    mBatchChunkMargin = getMax( mBatchChunkMargin, localAABB.upperBound.y - cellUpper.y );
+}
+
+//------------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK batchChunkSpriteSort( SpriteBatchItem* const* a, SpriteBatchItem* const* b )
+{
+    // Sort by batch Id which is the creation order.
+    const U32 batchIdA = (*a)->getBatchId();
+    const U32 batchIdB = (*b)->getBatchId();
+    return batchIdA < batchIdB ? -1 : batchIdA > batchIdB ? 1 : 0;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::updateBatchChunk( SpriteBatchChunk* pBatchChunk )
+{
+    // Finish if the batch chunk is up-to-date.
+    if ( !pBatchChunk->mDirty && pBatchChunk->mLastBatchTransformId == mBatchTransformId )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_UpdateBatchChunk);
+
+    // Reset the texture runs.
+    Vector<SpriteBatchChunk::TextureRun>& textureRuns = pBatchChunk->mTextureRuns;
+    textureRuns.clear();
+
+    // Sort the sprites into creation order.
+    // NOTE: Sprites are moved between chunks as they change so this keeps the draw order of overlapping sprites stable.
+    pBatchChunk->mSprites.sort( batchChunkSpriteSort );
+
+    // Count the quads.
+    const U32 spriteCount = (U32)pBatchChunk->mSprites.size();
+    U32 quadCount = 0;
+    for( U32 spriteIndex = 0; spriteIndex < spriteCount; ++spriteIndex )
+    {
+        // Fetch sprite batch item.
+        SpriteBatchItem* pSpriteBatchItem = pBatchChunk->mSprites[spriteIndex];
+
+        // Count if rendering.
+        if ( pSpriteBatchItem->getVisible() && pSpriteBatchItem->validRender() )
+            quadCount++;
+    }
+
+    // Size the quads.
+    pBatchChunk->mVertices.setSize( quadCount * 4 );
+    pBatchChunk->mTextureCoords.setSize( quadCount * 4 );
+    pBatchChunk->mColors.setSize( quadCount * 4 );
+    pBatchChunk->mUseColor = false;
+
+    // Write the quads in sprite order.
+    const ColorF noColor( 1.0f, 1.0f, 1.0f, 1.0f );
+    bool firstQuad = true;
+    U32 quadIndex = 0;
+    for( U32 spriteIndex = 0; spriteIndex < spriteCount; ++spriteIndex )
+    {
+        // Fetch sprite batch item.
+        SpriteBatchItem* pSpriteBatchItem = pBatchChunk->mSprites[spriteIndex];
+
+        // Skip if not rendering.
+        if ( !pSpriteBatchItem->getVisible() || !pSpriteBatchItem->validRender() )
+            continue;
+
+        // Start a texture run if the texture changes.
+        // NOTE: Only consecutive sprites share a texture run so the submission order is kept.
+        TextureHandle& texture = pSpriteBatchItem->getProviderTexture();
+        if ( textureRuns.size() == 0 || textureRuns.last().mTexture != texture )
+        {
+            textureRuns.push_back( SpriteBatchChunk::TextureRun( texture ) );
+            textureRuns.last().mQuadStart = quadIndex;
+        }
+
+        // Fetch the quad vertex.
+        textureRuns.last().mQuadCount++;
+        const U32 vertexIndex = quadIndex++ * 4;
+
+        // Update the world transform.
+        pSpriteBatchItem->updateWorldTransform( mBatchTransformId );
+
+        // Write the vertices.
+        const Vector2* pRenderOOBB = pSpriteBatchItem->getRenderOOBB();
+        Vector2* pVertex = pBatchChunk->mVertices.address() + vertexIndex;
+        pVertex[0] = pRenderOOBB[0];
+        pVertex[1] = pRenderOOBB[1];
+        pVertex[2] = pRenderOOBB[2];
+        pVertex[3] = pRenderOOBB[3];
+
+        // Fetch and flip texel area.
+        ImageAsset::FrameArea::TexelArea texelArea = pSpriteBatchItem->getProviderImageFrameArea().mTexelArea;
+        texelArea.setFlip( pSpriteBatchItem->getFlipX(), pSpriteBatchItem->getFlipY() );
+        const Vector2& texLower = texelArea.mTexelLower;
+        const Vector2& texUpper = texelArea.mTexelUpper;
+
+        // Write the texture coordinates.
+        Vector2* pTexture = pBatchChunk->mTextureCoords.address() + vertexIndex;
+        pTexture[0].Set( texLower.x, texUpper.y );
+        pTexture[1].Set( texUpper.x, texUpper.y );
+        pTexture[2].Set( texUpper.x, texLower.y );
+        pTexture[3].Set( texLower.x, texLower.y );
+
+        // Write the colors.
+        const ColorF& blendColor = pSpriteBatchItem->getBlendColor();
+        ColorF* pColor = pBatchChunk->mColors.address() + vertexIndex;
+        pColor[0] = blendColor;
+        pColor[1] = blendColor;
+        pColor[2] = blendColor;
+        pColor[3] = blendColor;
+        if ( blendColor != noColor )
+            pBatchChunk->mUseColor = true;
+
+        // Combine the render AABB.
+        if ( firstQuad )
+            pBatchChunk->mRenderAABB = pSpriteBatchItem->mRenderAABB;
+        else
+            pBatchChunk->mRenderAABB.Combine( pSpriteBatchItem->mRenderAABB );
+        firstQuad = false;
+    }
+
+    // Flag the batch chunk as up-to-date.
+    pBatchChunk->mDirty = false;
+    pBatchChunk->mLastBatchTransformId = mBatchTransformId;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::prepareBatchChunks( SceneRenderObject* pSceneRenderObject, const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue, const b2AABB& localAABB )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_PrepareBatchChunks);
+
+    // Sanity!
+    AssertFatal( mpUnchunkedSprites != NULL, "SpriteBatch::prepareBatchChunks() - Batch chunks have not been created." );
+
+    // Calculate the chunk cells overlapping the local AABB including any overhanging sprites.
+    const F32 lowerCellX = mFloor( (localAABB.lowerBound.x - mBatchChunkMargin) / mBatchChunkSize );
+    const F32 lowerCellY = mFloor( (localAABB.lowerBound.y - mBatchChunkMargin) / mBatchChunkSize );
+    const F32 upperCellX = mFloor( (localAABB.upperBound.x + mBatchChunkMargin) / mBatchChunkSize );
+    const F32 upperCellY = mFloor( (localAABB.upperBound.y + mBatchChunkMargin) / mBatchChunkSize );
+    const F32 cellCount = (upperCellX - lowerCellX + 1.0f) * (upperCellY - lowerCellY + 1.0f);
+
+    // Are there fewer cells than batch chunks?
+    if ( cellCount < (F32)mBatchChunks.size() )
+    {
+        // Yes, so prepare the batch chunks in the cells.
+        for( S32 cellY = (S32)lowerCellY; cellY <= (S32)upperCellY; ++cellY )
+        {
+            for( S32 cellX = (S32)lowerCellX; cellX <= (S32)upperCellX; ++cellX )
+            {
+                // Find the batch chunk.
+                SpriteBatchChunk* pBatchChunk = findBatchChunk( ((U32)(U16)cellX << 16) | (U32)(U16)cellY, false );
+
+                // Prepare the batch chunk if found.
+                if ( pBatchChunk != NULL )
+                    prepareBatchChunk( pBatchChunk, pSceneRenderObject, pSceneRenderState, pSceneRenderQueue );
+            }
+        }
+    }
+    else
+    {
+        // No, so prepare all the batch chunks.
+        for( typeBatchChunkHash::iterator chunkItr = mBatchChunks.begin(); chunkItr != mBatchChunks.end(); ++chunkItr )
+        {
+            prepareBatchChunk( chunkItr->value, pSceneRenderObject, pSceneRenderState, pSceneRenderQueue );
+        }
+    }
+
+    // Prepare the unchunked sprites.
+    const U32 unchunkedCount = (U32)mpUnchunkedSprites->mSprites.size();
+    for( U32 spriteIndex = 0; spriteIndex < unchunkedCount; ++spriteIndex )
+    {
+        // Fetch sprite batch Item.
+        SpriteBatchItem* pSpriteBatchItem = mpUnchunkedSprites->mSprites[spriteIndex];
+
+        // Skip if not visible or not in view.
+        if ( !pSpriteBatchItem->getVisible() || !b2TestOverlap( pSpriteBatchItem->getLocalAABB(), localAABB ) )
+            continue;
+
+        // Create a render request.
+        SceneRenderRequest* pSceneRenderRequest = pSceneRenderQueue->createRenderRequest();
+
+        // Prepare batch item.
+        pSpriteBatchItem->prepareRender( pSceneRenderRequest, mBatchTransformId );
+
+        // Set identity.
+        pSceneRenderRequest->mpSceneRenderObject = pSceneRenderObject;
+
+        // Set custom data.
+        pSceneRenderRequest->mpCustomData1 = pSpriteBatchItem;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::prepareBatchChunk( SpriteBatchChunk* pBatchChunk, SceneRenderObject* pSceneRenderObject, const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue )
+{
+    // Update the batch chunk.
+    updateBatchChunk( pBatchChunk );
+
+    // Finish if nothing to render or not in view.
+    if ( pBatchChunk->getQuadCount() == 0 || !b2TestOverlap( pBatchChunk->mRenderAABB, pSceneRenderState->mRenderAABB ) )
+        return;
+
+    // Create a render request.
+    SceneRenderRequest* pSceneRenderRequest = pSceneRenderQueue->createRenderRequest();
+
+    // Prepare the batch chunk.
+    // NOTE: The batch is used as the second custom data to identify the batch chunk.
+    pSceneRenderRequest->set(
+        pSceneRenderObject,
+        pBatchChunk->mRenderAABB.GetCenter(),
+        0.0f,
+        Vector2::getZero(),
+        pBatchChunk->mKey,
+        StringTable->EmptyString,
+        pBatchChunk,
+        this );
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBatch::onTamlCustomWrite( TamlCustomNodes& customNodes )
 {
     // Debug Profiling.
@@ -1442,10 +2338,10 @@ void SpriteBatch::onTamlCustomWrite( TamlCustomNodes& customNodes )
     TamlCustomNode* pSpritesNode = customNodes.addNode( spritesNodeName );
 
     // Write all sprites.
-    for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    for( typeSpriteBatchVector::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
     {      
         // Write type with sprite item.
-        spriteItr->value->onTamlCustomWrite( pSpritesNode );
+        (*spriteItr)->onTamlCustomWrite( pSpritesNode );
     }
 }
 
@@ -1496,7 +2392,7 @@ void SpriteBatch::onTamlCustomRead( const TamlCustomNodes& customNodes )
         if ( logicalPosition.isValid() )
         {
             // Yes, so insert into sprite positions.
-            mSpritePositions.insert( logicalPosition, pSpriteBatchItem );
+            insertSpritePosition( logicalPosition, pSpriteBatchItem );
         }
 
         // Fetch sprite name.
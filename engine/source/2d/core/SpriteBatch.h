@@ -31,9 +31,21 @@
 #include "2d/scene/SceneRenderObject.h"
 #endif
 
+#ifndef _SPRITE_BATCH_CHUNK_H_
+#include "2d/core/SpriteBatchChunk.h"
+#endif
+
+//------------------------------------------------------------------------------  
+
+#define SPRITE_BATCH_DEFAULT_CHUNK_SIZE         16.0f
+#define SPRITE_BATCH_ITEM_BLOCK_SIZE            256
+#define SPRITE_BATCH_GRID_MINIMUM_AREA          4096
+#define SPRITE_BATCH_GRID_MAXIMUM_SPARSITY      4
+
 //------------------------------------------------------------------------------  
 
 class SpriteBatchQuery;
+class SceneAnimationClock;
 
 //------------------------------------------------------------------------------  
 
@@ -43,16 +55,21 @@ public:
     static const S32                INVALID_SPRITE_PROXY = -1;  
 
 protected:
-    typedef HashMap< U32, SpriteBatchItem* > typeSpriteBatchHash;
+    typedef Vector< SpriteBatchItem* > typeSpriteBatchVector;
+    typedef HashMap< U32, SpriteBatchItem* > typeSpriteIdHash;
     typedef HashMap< SpriteBatchItem::LogicalPosition, SpriteBatchItem* > typeSpritePositionHash;
     typedef HashMap< StringTableEntry, SpriteBatchItem* > typeSpriteNameHash;
+    typedef HashMap< U32, SpriteBatchChunk* > typeBatchChunkHash;
 
-    typeSpriteBatchHash             mSprites;
+    typeSpriteBatchVector           mSprites;
+    typeSpriteIdHash                mSpriteIds;
     typeSpritePositionHash          mSpritePositions;
     typeSpriteNameHash              mSpriteNames;
     SpriteBatchItem*                mSelectedSprite;
     SceneRenderQueue::RenderSort    mBatchSortMode;
     bool                            mBatchCulling;
+    bool                            mBatchChunking;
+    F32                             mBatchChunkSize;
     Vector2                         mDefaultSpriteStride;
     Vector2                         mDefaultSpriteSize;
     F32                             mDefaultSpriteAngle;
@@ -61,6 +78,16 @@ private:
     SpriteBatchQuery*               mpSpriteBatchQuery;
     U32                             mMasterBatchId;
 
+    typeSpriteBatchVector           mSpriteBlocks;
+    typeSpriteBatchVector           mFreeSprites;
+
+    typeSpriteBatchVector           mSpriteGrid;
+    S32                             mSpriteGridX;
+    S32                             mSpriteGridY;
+    S32                             mSpriteGridWidth;
+    S32                             mSpriteGridHeight;
+    U32                             mSpriteGridCount;
+
     b2Transform                     mBatchTransform;
     bool                            mBatchTransformDirty;
     U32                             mBatchTransformId;
@@ -68,6 +95,13 @@ private:
     Vector2                         mLocalExtents;
     bool                            mLocalExtentsDirty;
 
+    typeBatchChunkHash              mBatchChunks;
+    SpriteBatchChunk*               mpUnchunkedSprites;
+    F32                             mBatchChunkMargin;
+
+    SceneAnimationClock*            mpAnimationClock;
+    U32                             mTickingSpriteCount;
+
 public:
     SpriteBatch();
     virtual ~SpriteBatch();
@@ -106,6 +140,22 @@ public:
     void setBatchCulling( const bool batchCulling );
     inline bool getBatchCulling( void ) const { return mBatchCulling; }
 
+    /// Batch chunking.
+    /// NOTE: Sprites within a chunk are drawn in creation order and each chunk is sorted as a single render request.
+    void setBatchChunking( const bool batchChunking );
+    inline bool getBatchChunking( void ) const { return mBatchChunking; }
+    void setBatchChunkSize( const F32 chunkSize );
+    inline F32 getBatchChunkSize( void ) const { return mBatchChunkSize; }
+    inline U32 getBatchChunkCount( void ) const { return (U32)mBatchChunks.size(); }
+
+    void updateBatchChunkSprite( SpriteBatchItem* pSpriteBatchItem );
+    void removeBatchChunkSprite( SpriteBatchItem* pSpriteBatchItem );
+
+    void setAnimationClock( SceneAnimationClock* pAnimationClock );
+    inline SceneAnimationClock* getAnimationClock( void ) const { return mpAnimationClock; }
+    void setSpriteTicking( const bool ticking );
+    inline U32 getTickingSpriteCount( void ) const { return mTickingSpriteCount; }
+
     inline void setDefaultSpriteStride( const Vector2& defaultStride ) { mDefaultSpriteStride = defaultStride; }
     inline const Vector2& getDefaultSpriteStride( void ) const { return mDefaultSpriteStride; }
 
@@ -116,6 +166,7 @@ public:
     inline F32 getDefaultSpriteAngle( void ) const { return mDefaultSpriteAngle; }
 
     bool selectSprite( const SpriteBatchItem::LogicalPosition& logicalPosition );
+    bool selectSpriteCell( const S32 cellX, const S32 cellY );
     bool selectSpriteId( const U32 batchId );
     bool selectSpriteName( const char* pName );
     inline void deselectSprite( void ) { mSelectedSprite = NULL; }
@@ -193,12 +244,14 @@ protected:
     SpriteBatchItem* createSprite( void );
     SpriteBatchItem* createSprite( const Vector2* explicitVertices );
     SpriteBatchItem* findSpritePosition( const SpriteBatchItem::LogicalPosition& logicalPosition );
+    SpriteBatchItem* findSpriteCell( const S32 cellX, const S32 cellY );
     SpriteBatchItem* findSpriteId( const U32 batchId );
     SpriteBatchItem* findSpriteName( const char* pName );
 
     virtual SpriteBatchItem* createSprite( const SpriteBatchItem::LogicalPosition& logicalPosition );
 
     void integrateSprites(const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats);
+    virtual void onSpriteTicking( const bool ticking ) {}
 
     void setBatchTransform( const b2Transform& batchTransform );
     void updateLocalExtents( void );
@@ -206,14 +259,35 @@ protected:
     void createSpriteBatchQuery( void );
     void destroySpriteBatchQuery( void );
 
+    void createBatchChunks( void );
+    void destroyBatchChunks( void );
+
     void onTamlCustomWrite( TamlCustomNodes& customNodes  );
     void onTamlCustomRead( const TamlCustomNodes& customNodes );
 
 private:
     bool destroySprite( const U32 batchId );
+
+    SpriteBatchItem* allocateSprite( void );
+    void insertSprite( SpriteBatchItem* pSpriteBatchItem );
+    void releaseSprite( SpriteBatchItem* pSpriteBatchItem );
+
+    void insertSpritePosition( const SpriteBatchItem::LogicalPosition& logicalPosition, SpriteBatchItem* pSpriteBatchItem );
+    void eraseSpritePosition( const SpriteBatchItem::LogicalPosition& logicalPosition );
+    SpriteBatchItem** findSpriteGridCell( const S32 cellX, const S32 cellY );
+    bool growSpriteGrid( const S32 cellX, const S32 cellY );
+    void clearSpriteGrid( void );
     bool checkSpriteSelected( void ) const;
 
     b2AABB calculateLocalAABB( const b2AABB& renderAABB );
+
+    bool isChunkable( SpriteBatchItem* pSpriteBatchItem ) const;
+    U32 getBatchChunkKey( const Vector2& localPosition ) const;
+    SpriteBatchChunk* findBatchChunk( const U32 chunkKey, const bool createChunk );
+    void addBatchChunkSprite( SpriteBatchChunk* pBatchChunk, SpriteBatchItem* pSpriteBatchItem );
+    void updateBatchChunk( SpriteBatchChunk* pBatchChunk );
+    void prepareBatchChunks( SceneRenderObject* pSceneRenderObject, const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue, const b2AABB& localAABB );
+    void prepareBatchChunk( SpriteBatchChunk* pBatchChunk, SceneRenderObject* pSceneRenderObject, const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue );
 };
 
 #endif // _SPRITE_BATCH_H_
@@ -0,0 +1,87 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SPRITE_BATCH_CHUNK_H_
+#define _SPRITE_BATCH_CHUNK_H_
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
+#ifndef _COLOR_H_
+#include "graphics/color.h"
+#endif
+
+///-----------------------------------------------------------------------------
+
+class SpriteBatchItem;
+
+///-----------------------------------------------------------------------------
+
+/// A fixed-size cell of static sprites whose pre-transformed quads are cached.
+/// The cache is only rebuilt when a sprite in the chunk changes or the batch transform changes.
+struct SpriteBatchChunk
+{
+    /// A run of cached quads that use the same texture.
+    struct TextureRun
+    {
+        TextureRun( TextureHandle& texture ) :
+            mTexture( texture ),
+            mQuadStart( 0 ),
+            mQuadCount( 0 )
+        {
+        }
+
+        TextureHandle   mTexture;
+        U32             mQuadStart;
+        U32             mQuadCount;
+    };
+
+    SpriteBatchChunk( const U32 key ) :
+        mKey( key ),
+        mUseColor( false ),
+        mDirty( true ),
+        mLastBatchTransformId( 0 )
+    {
+        mRenderAABB.lowerBound.SetZero();
+        mRenderAABB.upperBound.SetZero();
+    }
+
+    inline U32 getQuadCount( void ) const { return (U32)mVertices.size() / 4; }
+
+    U32                         mKey;
+    Vector<SpriteBatchItem*>    mSprites;
+    Vector<TextureRun>          mTextureRuns;
+    Vector<Vector2>             mVertices;
+    Vector<Vector2>             mTextureCoords;
+    Vector<ColorF>              mColors;
+    b2AABB                      mRenderAABB;
+    bool                        mUseColor;
+    bool                        mDirty;
+    U32                         mLastBatchTransformId;
+};
+
+#endif // _SPRITE_BATCH_CHUNK_H_
@@ -61,7 +61,80 @@ static StringTableEntry spriteUserDataName          = StringTable->insert("UserD
 
 //------------------------------------------------------------------------------
 
-SpriteBatchItem::SpriteBatchItem() : mProxyId( SpriteBatch::INVALID_SPRITE_PROXY )
+bool SpriteBatchItem::LogicalPosition::getCell( const char* pLogicalPositionArgs, S32& cellX, S32& cellY )
+{
+    // Sanity!
+    AssertFatal( pLogicalPositionArgs != NULL, "LogicalPosition::getCell() - Cannot use NULL position arguments." );
+
+    const char* pLogicalPositionSeparator = ",\t ";
+    char cellBuffer[2][16];
+    S32 cellCount = 0;
+
+    // Split the arguments into the cell buffers.
+    const char* pArg = pLogicalPositionArgs;
+    while( true )
+    {
+        // Skip separators.
+        while( *pArg != 0 && dStrchr( pLogicalPositionSeparator, *pArg ) != NULL )
+            ++pArg;
+
+        // Finish if no more arguments.
+        if ( *pArg == 0 )
+            break;
+
+        // Fail if too many arguments.
+        if ( cellCount == 2 )
+            return false;
+
+        // Copy the argument.
+        U32 length = 0;
+        while( pArg[length] != 0 && dStrchr( pLogicalPositionSeparator, pArg[length] ) == NULL )
+        {
+            // Fail if the argument is too long.
+            if ( length == sizeof(cellBuffer[0]) - 1 )
+                return false;
+
+            cellBuffer[cellCount][length] = pArg[length];
+            ++length;
+        }
+        cellBuffer[cellCount++][length] = 0;
+        pArg += length;
+    }
+
+    // Parse the cell.
+    return cellCount == 2 && getCellArg( cellBuffer[0], cellX ) && getCellArg( cellBuffer[1], cellY );
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatchItem::LogicalPosition::getCellArg( const char* pArg, S32& cell )
+{
+    // Skip any sign.
+    const char* pDigits = ( *pArg == '-' || *pArg == '+' ) ? pArg + 1 : pArg;
+
+    // Fail if there are no digits or too many to fit.
+    const U32 digitCount = dStrlen( pDigits );
+    if ( digitCount == 0 || digitCount > 9 )
+        return false;
+
+    // Fail if not all digits.
+    for( const char* pDigit = pDigits; *pDigit != 0; ++pDigit )
+    {
+        if ( !dIsdigit( *pDigit ) )
+            return false;
+    }
+
+    cell = dAtoi( pArg );
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+
+SpriteBatchItem::SpriteBatchItem() :
+    mProxyId( SpriteBatch::INVALID_SPRITE_PROXY ),
+    mpBatchChunk( NULL ),
+    mTicking( false )
 {
     resetState();
 }
@@ -90,8 +163,19 @@ void SpriteBatchItem::resetState( void )
         mSpriteBatch->destroyQueryProxy( this );
     }
 
+    // Are we in a batch chunk?
+    if ( mpBatchChunk != NULL )
+    {
+        // Sanity!
+        AssertFatal( mSpriteBatch != NULL, "Cannot remove batch chunk sprite with NULL sprite batch." );
+
+        // Remove from the batch chunk.
+        mSpriteBatch->removeBatchChunkSprite( this );
+    }
+
     mSpriteBatch = NULL;
     mBatchId = 0;
+    mBatchIndex = 0;
     mName = StringTable->EmptyString;
     mLogicalPosition.resetState();
 
@@ -131,6 +215,9 @@ void SpriteBatchItem::resetState( void )
 
     mSpriteBatchQueryKey = 0;
 
+    mpBatchChunk = NULL;
+    mBatchChunkIndex = -1;
+
     mUserData = NULL;
 
     // Only animates if the scene is not paused.
@@ -182,6 +269,92 @@ void SpriteBatchItem::copyTo( SpriteBatchItem* pSpriteBatchItem ) const
 
 //------------------------------------------------------------------------------
 
+bool SpriteBatchItem::setImage( const char* pImageAssetId, const U32 frame )
+{
+    // Call parent.
+    const bool status = Parent::setImage( pImageAssetId, frame );
+
+    // Flag the batch chunk as dirty.
+    setBatchChunkDirty();
+
+    return status;
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatchItem::setImage( const char* pImageAssetId, const char* pNamedFrame )
+{
+    // Call parent.
+    const bool status = Parent::setImage( pImageAssetId, pNamedFrame );
+
+    // Flag the batch chunk as dirty.
+    setBatchChunkDirty();
+
+    return status;
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatchItem::setImageFrame( const U32 frame )
+{
+    // Call parent.
+    const bool status = Parent::setImageFrame( frame );
+
+    // Flag the batch chunk as dirty.
+    setBatchChunkDirty();
+
+    return status;
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatchItem::setNamedImageFrame( const char* frame )
+{
+    // Call parent.
+    const bool status = Parent::setNamedImageFrame( frame );
+
+    // Flag the batch chunk as dirty.
+    setBatchChunkDirty();
+
+    return status;
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatchItem::setAnimation( const char* pAnimationAssetId )
+{
+    // Call parent.
+    const bool status = Parent::setAnimation( pAnimationAssetId );
+
+    // Flag the batch chunk as dirty.
+    setBatchChunkDirty();
+
+    return status;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatchItem::setProcessTicks( bool tick )
+{
+    // Call parent.
+    Parent::setProcessTicks( tick );
+
+    // Only tick whilst the animation needs ticking and the scene animation clock isn't updating it.
+    const bool ticking = tick && !isAnimationClocked();
+
+    // Finish if no change.
+    if ( ticking == mTicking )
+        return;
+
+    mTicking = ticking;
+
+    // Update the sprite batch ticking.
+    if ( mSpriteBatch != NULL )
+        mSpriteBatch->setSpriteTicking( ticking );
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBatchItem::prepareRender( SceneRenderRequest* pSceneRenderRequest, const U32 batchTransformId )
 {
     // Debug Profiling.
@@ -240,6 +413,12 @@ void SpriteBatchItem::setExplicitVertices( const Vector2* explicitVertices )
     mExplicitVerts[1] = explicitVertices[1];
     mExplicitVerts[2] = explicitVertices[2];
     mExplicitVerts[3] = explicitVertices[3];
+
+    // Flag local transform as dirty.
+    mLocalTransformDirty = true;
+
+    // Flag the batch chunk as dirty.
+    setBatchChunkDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -331,6 +510,28 @@ void SpriteBatchItem::updateWorldTransform( const U32 batchTransformId )
 
 //------------------------------------------------------------------------------
 
+void SpriteBatchItem::updateBatchChunk( void )
+{
+    // Sanity!
+    AssertFatal( mSpriteBatch != NULL, "SpriteBatchItem::updateBatchChunk() - Cannot update batch chunk with a NULL sprite batch." );
+
+    // Update the batch chunk.
+    mSpriteBatch->updateBatchChunkSprite( this );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatchItem::onAssetRefreshed( AssetPtrBase* pAssetPtrBase )
+{
+    // Call parent.
+    Parent::onAssetRefreshed( pAssetPtrBase );
+
+    // Flag the batch chunk as dirty.
+    setBatchChunkDirty();
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBatchItem::onTamlCustomWrite( TamlCustomNode* pParentNode )
 {
     // Add sprite node.
@@ -31,6 +31,7 @@
 
 class SpriteBatch;
 class SceneRenderRequest;
+struct SpriteBatchChunk;
 
 //------------------------------------------------------------------------------  
 
@@ -90,10 +91,23 @@ public:
 
             // Set argument string.
             mArgString = StringTable->insert( pLogicalPositionArgs );
+
+            // Set as a cell if both arguments are integers.
+            mIsCell = mArgCount == 2 && getCellArg( mArgs[0], mCellX ) && getCellArg( mArgs[1], mCellY );
         }
 
         inline bool isValid( void ) const { return mArgCount != 0; }
 
+        inline bool isCell( void ) const { return mIsCell; }
+        inline S32 getCellX( void ) const { return mCellX; }
+        inline S32 getCellY( void ) const { return mCellY; }
+
+        /// Parse logical position arguments as a cell without constructing a logical position.
+        static bool getCell( const char* pLogicalPositionArgs, S32& cellX, S32& cellY );
+
+        /// Parse a single logical position argument as a cell coordinate.
+        static bool getCellArg( const char* pArg, S32& cell );
+
         inline S32 getArgCount( void ) const { return mArgCount; }
 
         inline StringTableEntry getArg( const S32 argIndex ) const
@@ -133,6 +147,9 @@ public:
             mArgCount = 0;
             dMemset( mArgs, 0, sizeof(mArgs) );
             mArgString = StringTable->EmptyString;
+            mIsCell = false;
+            mCellX = 0;
+            mCellY = 0;
         }
 
         // This should be as unique as possible as it is used for hashing.
@@ -185,11 +202,15 @@ public:
         S32                 mArgCount;
         StringTableEntry    mArgs[MAX_ARGUMENTS];
         StringTableEntry    mArgString;
+        bool                mIsCell;
+        S32                 mCellX;
+        S32                 mCellY;
     };
 
 protected:
     SpriteBatch*        mSpriteBatch;
     U32                 mBatchId;
+    U32                 mBatchIndex;
     S32                 mProxyId;
     StringTableEntry    mName;
     LogicalPosition     mLogicalPosition;
@@ -227,6 +248,11 @@ protected:
 
     U32                 mSpriteBatchQueryKey;
 
+    SpriteBatchChunk*   mpBatchChunk;
+    S32                 mBatchChunkIndex;
+
+    bool                mTicking;
+
     void*               mUserData;
 
 public:
@@ -243,51 +269,51 @@ public:
     inline void setLogicalPosition( const LogicalPosition& logicalPosition ) { mLogicalPosition = logicalPosition; }
     inline const LogicalPosition& getLogicalPosition( void ) const { return mLogicalPosition; }
 
-    inline void setVisible( const bool visible ) { mVisible = visible; }
+    inline void setVisible( const bool visible ) { mVisible = visible; setBatchChunkDirty(); }
     inline bool getVisible( void ) const { return mVisible; }
 
-    inline void setExplicitMode( const bool explicitMode ) { mExplicitMode = explicitMode; }
+    inline void setExplicitMode( const bool explicitMode ) { mExplicitMode = explicitMode; setBatchChunkDirty(); }
     inline bool getExplicitMode( void ) const { return mExplicitMode; }
 
-    inline void setLocalPosition( const Vector2& localPosition ) { mLocalPosition = localPosition; mLocalTransformDirty = true; }
+    inline void setLocalPosition( const Vector2& localPosition ) { mLocalPosition = localPosition; mLocalTransformDirty = true; setBatchChunkDirty(); }
     inline Vector2 getLocalPosition( void ) const { return mLocalPosition; }
 
     void setExplicitVertices( const Vector2* explicitVertices );
 
-    inline void setLocalAngle( const F32 localAngle ) { mLocalAngle = localAngle; mLocalTransformDirty = true; }
+    inline void setLocalAngle( const F32 localAngle ) { mLocalAngle = localAngle; mLocalTransformDirty = true; setBatchChunkDirty(); }
     inline F32 getLocalAngle( void ) const { return mLocalAngle; }
 
-    inline void setSize( const Vector2& size ) { mSize = size; mLocalTransformDirty = true; }
+    inline void setSize( const Vector2& size ) { mSize = size; mLocalTransformDirty = true; setBatchChunkDirty(); }
     inline Vector2 getSize( void ) const { return mSize; }
 
     inline const b2AABB& getLocalAABB( void ) { if ( mLocalTransformDirty ) updateLocalTransform(); return mLocalAABB; }
 
-    void setDepth( const F32 depth ) { mDepth = depth; }
+    void setDepth( const F32 depth ) { mDepth = depth; setBatchChunkDirty(); }
     F32 getDepth( void ) const { return mDepth; }
 
-    inline void setFlipX( const bool flipX ) { mFlipX = flipX; }
+    inline void setFlipX( const bool flipX ) { mFlipX = flipX; setBatchChunkDirty(); }
     inline bool getFlipX( void ) const { return mFlipX; }
 
-    inline void setFlipY( const bool flipY ) { mFlipY = flipY; }
+    inline void setFlipY( const bool flipY ) { mFlipY = flipY; setBatchChunkDirty(); }
     inline bool getFlipY( void ) const { return mFlipY; }
 
     inline void setSortPoint( const Vector2& sortPoint ) { mSortPoint = sortPoint; }
     inline Vector2 getSortPoint( void ) const { return mSortPoint; }
-    inline void setRenderGroup( const char* pRenderGroup ) { mRenderGroup = StringTable->insert( pRenderGroup ); }
+    inline void setRenderGroup( const char* pRenderGroup ) { mRenderGroup = StringTable->insert( pRenderGroup ); setBatchChunkDirty(); }
     inline StringTableEntry getRenderGroup( void ) const { return mRenderGroup; }
 
-    inline void setBlendMode( const bool blendMode ) { mBlendMode = blendMode; }
+    inline void setBlendMode( const bool blendMode ) { mBlendMode = blendMode; setBatchChunkDirty(); }
     inline bool getBlendMode( void ) const { return mBlendMode; }
-    inline void setSrcBlendFactor( GLenum srcBlendFactor ) { mSrcBlendFactor = srcBlendFactor; }
+    inline void setSrcBlendFactor( GLenum srcBlendFactor ) { mSrcBlendFactor = srcBlendFactor; setBatchChunkDirty(); }
     inline GLenum getSrcBlendFactor( void ) const { return mSrcBlendFactor; }
-    inline void setDstBlendFactor( GLenum dstBlendFactor ) { mDstBlendFactor = dstBlendFactor; }
+    inline void setDstBlendFactor( GLenum dstBlendFactor ) { mDstBlendFactor = dstBlendFactor; setBatchChunkDirty(); }
     inline GLenum getDstBlendFactor( void ) const { return mDstBlendFactor; }
-    inline void setBlendColor( const ColorF& blendColor ) { mBlendColor = blendColor; }
+    inline void setBlendColor( const ColorF& blendColor ) { mBlendColor = blendColor; setBatchChunkDirty(); }
     inline const ColorF& getBlendColor( void ) const { return mBlendColor; }
-    inline void setBlendAlpha( const F32 alpha ) { mBlendColor.alpha = alpha; }
+    inline void setBlendAlpha( const F32 alpha ) { mBlendColor.alpha = alpha; setBatchChunkDirty(); }
     inline F32 getBlendAlpha( void ) const { return mBlendColor.alpha; }
 
-    inline void setAlphaTest( const F32 alphaTest ) { mAlphaTest = alphaTest; }
+    inline void setAlphaTest( const F32 alphaTest ) { mAlphaTest = alphaTest; setBatchChunkDirty(); }
     inline F32 getAlphaTest( void ) const { return mAlphaTest; }
 
     inline void setDataObject( SimObject* pDataObject ) { mDataObject = pDataObject; }
@@ -300,6 +326,17 @@ public:
     inline void setSpriteBatchQueryKey( const U32 key ) { mSpriteBatchQueryKey = key; }
     inline U32  getSpriteBatchQueryKey( void ) const { return mSpriteBatchQueryKey; }
 
+    inline SpriteBatchChunk* getBatchChunk( void ) const { return mpBatchChunk; }
+    inline void setBatchChunkDirty( void ) { if ( mpBatchChunk != NULL ) updateBatchChunk(); }
+
+    inline bool setImage( const char* pImageAssetId ) { return setImage( pImageAssetId, mImageFrame ); }
+    virtual bool setImage( const char* pImageAssetId, const U32 frame );
+    virtual bool setImage( const char* pImageAssetId, const char* pNamedFrame );
+    virtual bool setImageFrame( const U32 frame );
+    virtual bool setNamedImageFrame( const char* frame );
+    virtual bool setAnimation( const char* pAnimationAssetId );
+    virtual void setProcessTicks( bool tick );
+
     virtual void copyTo( SpriteBatchItem* pSpriteBatchItem ) const;
 
     inline const Vector2* getLocalOOBB( void ) const { return mLocalOOBB; }
@@ -316,13 +353,12 @@ protected:
     inline void setName( const char* pName ) { mName = StringTable->insert( pName ); }
     void updateLocalTransform( void );
     void updateWorldTransform( const U32 batchTransformId );
+    void updateBatchChunk( void );
+
+    virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
 
     void onTamlCustomWrite( TamlCustomNode* pParentNode );
     void onTamlCustomRead( const TamlCustomNode* pSpriteNode );
 };
 
-//------------------------------------------------------------------------------  
-
-static FactoryCache<SpriteBatchItem> SpriteBatchItemFactory;
-
 #endif // _SPRITE_BATCH_ITEM_H_
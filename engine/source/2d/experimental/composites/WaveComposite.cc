@@ -47,6 +47,9 @@ WaveComposite::WaveComposite() :
     //          For smaller scale composites, this is more efficient and saves memory.
     //          Do not turn this off for larger scale composites like tile-maps.
     SpriteBatch::setBatchCulling( false );
+
+    // The wave is integrated every tick.
+    setTickInterest( TICK_INTEREST_ANIMATION );
 }
 
 //------------------------------------------------------------------------------
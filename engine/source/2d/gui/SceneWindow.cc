@@ -28,6 +28,7 @@
 #include "math/mMathFn.h"
 #include "2d/sceneobject/SceneObject.h"
 #include "2d/core/Utility.h"
+#include "2d/core/ParticleSystem.h"
 #include "2d/gui/SceneWindow.h"
 
 #ifndef _ASSET_MANAGER_H_
@@ -1773,7 +1774,7 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
     const S32 metricsOffset = (S32)font->getStrWidth( "WWWWWWWWWWWW" );
 
     // Set Banner Height.
-    F32 bannerLineHeight = fullMetrics ? 17.0f : 1.0f;
+    F32 bannerLineHeight = fullMetrics ? 19.0f : 1.0f;
 
     // Add an extra line if we're monitoring a scene object.
     if ( pDebugSceneObject != NULL )
@@ -1813,24 +1814,27 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
     {
         // Rendering.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Render", NULL );
-        dSprintf( mDebugText, sizeof( mDebugText ), "- FPS=%4.1f<%4.1f/%4.1f>, Frames=%u, Picked=%d<%d>, RenderRequests=%d<%d>, RenderFallbacks=%d<%d>",
+        dSprintf( mDebugText, sizeof( mDebugText ), "- FPS=%4.1f<%4.1f/%4.1f>, Frames=%u, Picked=%d<%d>, RenderRequests=%d<%d>, RenderFallbacks=%d<%d>, CacheHits=%d<%d>, CacheMisses=%d<%d>",
             debugStats.fps, debugStats.minFPS, debugStats.maxFPS,
             debugStats.frameCount,
             debugStats.renderPicked, debugStats.maxRenderPicked,
             debugStats.renderRequests, debugStats.maxRenderRequests,
-            debugStats.renderFallbacks, debugStats.maxRenderFallbacks );
+            debugStats.renderFallbacks, debugStats.maxRenderFallbacks,
+            debugStats.renderCacheHits, debugStats.maxRenderCacheHits,
+            debugStats.renderCacheMisses, debugStats.maxRenderCacheMisses );
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
         // Scene.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Scene", NULL );
-        dSprintf( mDebugText, sizeof( mDebugText ), "- Count=%d, Index=%d, Time=%0.1fs, Objects=%d<%d>(Global=%d), Enabled=%d<%d>, Visible=%d<%d>, Awake=%d<%d>, Controllers=%d",
+        dSprintf( mDebugText, sizeof( mDebugText ), "- Count=%d, Index=%d, Time=%0.1fs, Objects=%d<%d>(Global=%d), Enabled=%d<%d>, Visible=%d<%d>, Awake=%d<%d>, TickSkipped=%d<%d>, Controllers=%d",
             Scene::getGlobalSceneCount(), pScene->getSceneIndex(),
             pScene->getSceneTime(),
             debugStats.objectsCount, debugStats.maxObjectsCount, SceneObject::getGlobalSceneObjectCount(),
             debugStats.objectsEnabled, debugStats.maxObjectsEnabled,
             debugStats.objectsVisible, debugStats.maxObjectsVisible,
             debugStats.objectsAwake, debugStats.maxObjectsAwake,
+            debugStats.objectsTickSkipped, debugStats.maxObjectsTickSkipped,
             pScene->getControllers() == NULL ? 0 : pScene->getControllers()->size() );        
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
@@ -1864,13 +1868,15 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
 
         // Batching #1.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Batching", NULL );
-        dSprintf( mDebugText, sizeof( mDebugText ), "- %sTris=%d<%d>, MaxTriDraw=%d, MaxVerts=%d, Strict=%d<%d>, Sorted=%d<%d>",
+        dSprintf( mDebugText, sizeof( mDebugText ), "- %s%sTris=%d<%d>, MaxTriDraw=%d, MaxVerts=%d, Strict=%d<%d>, Sorted=%d<%d>, Upload=%d<%d>",
             pScene->getBatchingEnabled() ? "" : "(OFF) ",
+            pScene->getBatchingRetained() ? "(RETAINED) " : "",
             debugStats.batchTrianglesSubmitted, debugStats.maxBatchTrianglesSubmitted,
             debugStats.batchMaxTriangleDrawn,
             debugStats.batchMaxVertexBuffer,
             debugStats.batchDrawCallsStrict, debugStats.maxBatchDrawCallsStrict,
-            debugStats.batchDrawCallsSorted, debugStats.maxBatchDrawCallsSorted                   
+            debugStats.batchDrawCallsSorted, debugStats.maxBatchDrawCallsSorted,
+            debugStats.batchBytesUploaded, debugStats.maxBatchBytesUploaded
             );
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
@@ -1940,6 +1946,27 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
+        // Physics timings #3.
+        F32 solveThreadFastest = 0.0f;
+        F32 solveThreadSlowest = 0.0f;
+        F32 maxSolveThreadSlowest = 0.0f;
+        for ( S32 index = 0; index < worldProfile.solveThreadCount; ++index )
+        {
+            solveThreadFastest = index == 0 ? worldProfile.solveThreads[index] : getMin( solveThreadFastest, worldProfile.solveThreads[index] );
+            solveThreadSlowest = getMax( solveThreadSlowest, worldProfile.solveThreads[index] );
+        }
+        for ( S32 index = 0; index < maxWorldProfile.solveThreadCount; ++index )
+        {
+            maxSolveThreadSlowest = getMax( maxSolveThreadSlowest, maxWorldProfile.solveThreads[index] );
+        }
+        dSprintf( mDebugText, sizeof( mDebugText ), "- Islands=%d<%d>, SolveThreads=%d<%d>, ThreadFastest=%0.0f, ThreadSlowest=%0.0f<%0.0f>",
+            worldProfile.islandCount, maxWorldProfile.islandCount,
+            worldProfile.solveThreadCount, maxWorldProfile.solveThreadCount,
+            solveThreadFastest,
+            solveThreadSlowest, maxSolveThreadSlowest );
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
         // Physics spatial tree.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Partition", NULL );
         const b2World* pWorld = pScene->getWorld();
@@ -1955,10 +1982,21 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
 
         // Particles.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Particles", NULL );
-        dSprintf( mDebugText, sizeof( mDebugText ), "- Allocated=%d, Used=%d<%d>, Free=%d",
+        dSprintf( mDebugText, sizeof( mDebugText ), "- Allocated=%d, Used=%d<%d>, Free=%d, Throttled=%d<%d>, Budget=%d",
             debugStats.particlesAlloc,
             debugStats.particlesUsed, debugStats.maxParticlesUsed,
-            debugStats.particlesFree );
+            debugStats.particlesFree,
+            debugStats.particlesThrottled, debugStats.maxParticlesThrottled,
+            ParticleSystem::Instance->getParticleBudget() );
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
+        // Animation.
+        dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Animation", NULL );
+        dSprintf( mDebugText, sizeof( mDebugText ), "- Groups=%d, Clocked=%d, FrameChanges=%d<%d>",
+            debugStats.animationGroups,
+            debugStats.animationProviders,
+            debugStats.animationFrameChanges, debugStats.maxAnimationFrameChanges );
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
@@ -263,7 +263,7 @@ void GuiImageButtonCtrl::renderButton( ImageAsset* pImageAsset, const U32 frame,
     {
         // Yes, so calculate the source region.
         const ImageAsset::FrameArea::PixelArea& pixelArea = pImageAsset->getImageFrameArea( frame ).mPixelArea;
-        RectI sourceRegion( pixelArea.mPixelOffset, Point2I(pixelArea.mPixelWidth, pixelArea.mPixelHeight) );
+        RectI sourceRegion( pixelArea.mPixelOffset + pImageAsset->getImageAtlasOffset(), Point2I(pixelArea.mPixelWidth, pixelArea.mPixelHeight) );
 
         // Calculate destination region.
         RectI destinationRegion(offset, mBounds.extent);
@@ -73,11 +73,14 @@ public:
         if ( objectsEnabled > maxObjectsEnabled ) maxObjectsEnabled = objectsEnabled;
         if ( objectsVisible > maxObjectsVisible ) maxObjectsVisible = objectsVisible;
         if ( objectsAwake > maxObjectsAwake ) maxObjectsAwake = objectsAwake;
+        if ( objectsTickSkipped > maxObjectsTickSkipped ) maxObjectsTickSkipped = objectsTickSkipped;
 
         // Render pick/requests.
         if ( renderPicked > maxRenderPicked ) maxRenderPicked = renderPicked;
         if ( renderRequests > maxRenderRequests ) maxRenderRequests = renderRequests;
         if ( renderFallbacks > maxRenderFallbacks ) maxRenderFallbacks = renderFallbacks;
+        if ( renderCacheHits > maxRenderCacheHits ) maxRenderCacheHits = renderCacheHits;
+        if ( renderCacheMisses > maxRenderCacheMisses ) maxRenderCacheMisses = renderCacheMisses;
 
         // Batching.
         if ( batchTrianglesSubmitted > maxBatchTrianglesSubmitted ) maxBatchTrianglesSubmitted = batchTrianglesSubmitted;
@@ -93,9 +96,14 @@ public:
         if ( batchLayerFlush > maxBatchLayerFlush ) maxBatchLayerFlush = batchLayerFlush;
         if ( batchNoBatchFlush > maxBatchNoBatchFlush ) maxBatchNoBatchFlush = batchNoBatchFlush;
         if ( batchAnonymousFlush > maxBatchAnonymousFlush ) maxBatchAnonymousFlush = batchAnonymousFlush;
+        if ( batchBytesUploaded > maxBatchBytesUploaded ) maxBatchBytesUploaded = batchBytesUploaded;
 
         // Particles.
         if ( particlesUsed > maxParticlesUsed ) maxParticlesUsed = particlesUsed;
+        if ( particlesThrottled > maxParticlesThrottled ) maxParticlesThrottled = particlesThrottled;
+
+        // Animation.
+        if ( animationFrameChanges > maxAnimationFrameChanges ) maxAnimationFrameChanges = animationFrameChanges;
 
         // World profile.
         if ( worldProfile.step > maxWorldProfile.step ) maxWorldProfile.step = worldProfile.step;
@@ -106,6 +114,12 @@ public:
         if ( worldProfile.solvePosition > maxWorldProfile.solvePosition ) maxWorldProfile.solvePosition = worldProfile.solvePosition;
         if ( worldProfile.broadphase > maxWorldProfile.broadphase ) maxWorldProfile.broadphase = worldProfile.broadphase;
         if ( worldProfile.solveTOI > maxWorldProfile.solveTOI ) maxWorldProfile.solveTOI = worldProfile.solveTOI;
+        if ( worldProfile.islandCount > maxWorldProfile.islandCount ) maxWorldProfile.islandCount = worldProfile.islandCount;
+        if ( worldProfile.solveThreadCount > maxWorldProfile.solveThreadCount ) maxWorldProfile.solveThreadCount = worldProfile.solveThreadCount;
+        for ( S32 index = 0; index < worldProfile.solveThreadCount; ++index )
+        {
+            if ( worldProfile.solveThreads[index] > maxWorldProfile.solveThreads[index] ) maxWorldProfile.solveThreads[index] = worldProfile.solveThreads[index];
+        }
     }
 
     /// Reset debug stats.
@@ -123,6 +137,9 @@ public:
         objectsAwake = 0;
         maxObjectsAwake = 0;
 
+        objectsTickSkipped = 0;
+        maxObjectsTickSkipped = 0;
+
         renderPicked = 0;
         maxRenderPicked = 0;
 
@@ -132,6 +149,12 @@ public:
         renderFallbacks = 0;
         maxRenderFallbacks = 0;
 
+        renderCacheHits = 0;
+        maxRenderCacheHits = 0;
+
+        renderCacheMisses = 0;
+        maxRenderCacheMisses = 0;
+
         bodyCount = 0;
         maxBodyCount = 0;
 
@@ -186,10 +209,20 @@ public:
         batchAnonymousFlush = 0;
         maxBatchAnonymousFlush = 0;
 
+        batchBytesUploaded = 0;
+        maxBatchBytesUploaded = 0;
+
         particlesAlloc = 0;
         particlesFree = 0;
         particlesUsed = 0;
         maxParticlesUsed = 0;
+        particlesThrottled = 0;
+        maxParticlesThrottled = 0;
+
+        animationGroups = 0;
+        animationProviders = 0;
+        animationFrameChanges = 0;
+        maxAnimationFrameChanges = 0;
 
         fps = 0.0f;
         minFPS = 10000.0f;
@@ -213,6 +246,9 @@ public:
     U32     objectsAwake;
     U32     maxObjectsAwake;
 
+    U32     objectsTickSkipped;
+    U32     maxObjectsTickSkipped;
+
     U32     renderPicked;
     U32     maxRenderPicked;
 
@@ -222,6 +258,12 @@ public:
     U32     renderFallbacks;
     U32     maxRenderFallbacks;
 
+    U32     renderCacheHits;
+    U32     maxRenderCacheHits;
+
+    U32     renderCacheMisses;
+    U32     maxRenderCacheMisses;
+
     U32     bodyCount;
     U32     maxBodyCount;
 
@@ -276,10 +318,20 @@ public:
     U32     batchAnonymousFlush;
     U32     maxBatchAnonymousFlush;
 
+    U32     batchBytesUploaded;
+    U32     maxBatchBytesUploaded;
+
     U32     particlesAlloc;
     U32     particlesFree;
     U32     particlesUsed;
     U32     maxParticlesUsed;
+    U32     particlesThrottled;
+    U32     maxParticlesThrottled;
+
+    U32     animationGroups;
+    U32     animationProviders;
+    U32     animationFrameChanges;
+    U32     maxAnimationFrameChanges;
 
     F32     fps;
     F32     minFPS;
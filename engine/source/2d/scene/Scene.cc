@@ -56,6 +56,18 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _GAMEINTERFACE_H_
+#include "game/gameInterface.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_JOB_SCHEDULER_H_
+#include "platform/threads/jobScheduler.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
 // Script bindings.
 #include "Scene_ScriptBinding.h"
 
@@ -153,6 +165,10 @@ Scene::Scene() :
     mVelocityIterations(8),
     mPositionIterations(3),
 
+    /// Scene occupancy.
+    mEnabledSceneObjectCount(0),
+    mVisibleSceneObjectCount(0),
+
     /// Joint access.
     mJointMasterId(1),
 
@@ -164,13 +180,22 @@ Scene::Scene() :
     mDebugMask(0X00000000),
     mpDebugSceneObject(NULL),
 
+    /// Parallel render compilation.
+    mpParallelRenderState(NULL),
+
     /// Window rendering.
     mpCurrentRenderWindow(NULL),
     
     /// Miscellaneous.
     mIsEditorScene(0),
+    mParallelIntegrate(false),
+    mParallelRenderCompile(false),
+    mParallelSolve(false),
+    mParallelCollide(false),
+    mRenderQueryCache(false),
     mUpdateCallback(false),
     mRenderCallback(false),
+    mContactStream(false),
     mSceneIndex(0)
 {
     // Set Vector Associations.
@@ -178,6 +203,8 @@ Scene::Scene() :
     VECTOR_SET_ASSOCIATION( mDeleteRequests );
     VECTOR_SET_ASSOCIATION( mDeleteRequestsTemp );
     VECTOR_SET_ASSOCIATION( mEndContacts );
+    VECTOR_SET_ASSOCIATION( mContactEvents );
+    VECTOR_SET_ASSOCIATION( mContactListeners );
     VECTOR_SET_ASSOCIATION( mAssetPreloads );
      
     // Initialize layer sort mode.
@@ -188,7 +215,7 @@ Scene::Scene() :
     mBatchRenderer.setDebugStats( &mDebugStats );
 
     // Register the scene controllers set.
-    mControllers = new SimSet();
+    mControllers = new SceneControllerSet();
     mControllers->registerObject();
 
     // Assign scene index.    
@@ -260,6 +287,9 @@ void Scene::onRemove()
     // Process Delete Requests.
     processDeleteRequests(true);
 
+    // Clear the animation clock.
+    mAnimationClock.clear();
+
     // Delete ground body.
     mpWorld->DestroyBody( mpGroundBody );
     mpGroundBody = NULL;
@@ -316,10 +346,20 @@ void Scene::initPersistFields()
     }
 
     addProtectedField("Controllers", TypeSimObjectPtr, Offset(mControllers, Scene), &defaultProtectedNotSetFn, &defaultProtectedGetFn, &defaultProtectedNotWriteFn, "The scene controllers to use.");
+
+    // Integration.
+    addField("ParallelIntegrate", TypeBool, Offset(mParallelIntegrate, Scene), &writeParallelIntegrate, "Whether objects that are safe to do so are integrated across multiple threads or not.");
+    addField("ParallelRenderCompile", TypeBool, Offset(mParallelRenderCompile, Scene), &writeParallelRenderCompile, "Whether the render requests for each layer are compiled across multiple threads or not.");
+    addField("ParallelSolve", TypeBool, Offset(mParallelSolve, Scene), &writeParallelSolve, "Whether the physics islands are solved across multiple threads or not.");
+    addField("ParallelCollide", TypeBool, Offset(mParallelCollide, Scene), &writeParallelCollide, "Whether the physics contacts are updated across multiple threads or not.");
+
+    // Rendering.
+    addProtectedField("RenderQueryCache", TypeBool, Offset(mRenderQueryCache, Scene), &setRenderQueryCache, &defaultProtectedGetFn, &writeRenderQueryCache, "Whether the visible objects are cached between frames so that only the changes are queried or not.");
     
     // Callbacks.
     addField("UpdateCallback", TypeBool, Offset(mUpdateCallback, Scene), &writeUpdateCallback, "");
     addField("RenderCallback", TypeBool, Offset(mRenderCallback, Scene), &writeRenderCallback, "");
+    addField("ContactStream", TypeBool, Offset(mContactStream, Scene), &writeContactStream, "Whether the contacts are delivered with a single 'onSceneContacts' callback each tick instead of a collision callback per contact.");
 }
 
 //-----------------------------------------------------------------------------
@@ -416,6 +456,46 @@ void Scene::PostSolve( b2Contact* pContact, const b2ContactImpulse* pImpulse )
 
 //-----------------------------------------------------------------------------
 
+int32 Scene::GetThreadCount( void ) const
+{
+    // The calling thread always participates.
+    return (int32)JobScheduler::Instance->getWorkerCount() + 1;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::ParallelFor( int32 count, int32 grainSize, b2TaskFunction task, void* pContext )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_PhysicsParallelFor);
+
+    // Sanity!
+    AssertFatal( task != NULL, "Scene::ParallelFor() - Cannot execute a NULL physics task." );
+
+    // Finish if nothing to do.
+    if ( count <= 0 )
+        return;
+
+    // Execute the physics task across the job scheduler.
+    PhysicsTask physicsTask;
+    physicsTask.mpTask = task;
+    physicsTask.mpContext = pContext;
+    JobScheduler::Instance->parallelFor( (U32)count, (U32)getMax( grainSize, 1 ), &executePhysicsTaskJob, &physicsTask );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::executePhysicsTaskJob( void* pContext, const U32 startIndex, const U32 endIndex )
+{
+    // Fetch physics task.
+    const PhysicsTask* pPhysicsTask = static_cast<const PhysicsTask*>( pContext );
+
+    // Execute the physics task.
+    pPhysicsTask->mpTask( pPhysicsTask->mpContext, (int32)startIndex, (int32)endIndex );
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::forwardContacts( void )
 {
     // Debug Profiling.
@@ -446,30 +526,201 @@ void Scene::forwardContacts( void )
 
 //-----------------------------------------------------------------------------
 
-void Scene::dispatchBeginContactCallbacks( void )
+void Scene::addContactListener( SceneContactListener* pContactListener )
+{
+    // Sanity!
+    AssertFatal( pContactListener != NULL, "Scene::addContactListener() - Cannot add a NULL contact listener." );
+
+    // Finish if already added.
+    for ( typeContactListenerVector::iterator listenerItr = mContactListeners.begin(); listenerItr != mContactListeners.end(); ++listenerItr )
+    {
+        if ( *listenerItr == pContactListener )
+            return;
+    }
+
+    // Add the contact listener.
+    mContactListeners.push_back( pContactListener );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::removeContactListener( SceneContactListener* pContactListener )
+{
+    // Remove the contact listener.
+    for ( typeContactListenerVector::iterator listenerItr = mContactListeners.begin(); listenerItr != mContactListeners.end(); ++listenerItr )
+    {
+        if ( *listenerItr == pContactListener )
+        {
+            mContactListeners.erase( listenerItr );
+            return;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+const SceneContactEvent* Scene::getContactEvent( const U32 eventIndex ) const
+{
+    // Is the contact event index valid?
+    if ( eventIndex >= (U32)mContactEvents.size() )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::getContactEvent() - Invalid contact event index (%d) as there are only (%d) contact event(s).", eventIndex, mContactEvents.size() );
+        return NULL;
+    }
+
+    return &mContactEvents[eventIndex];
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::buildContactEvents( void )
 {
     // Debug Profiling.
-    PROFILE_SCOPE(Scene_DispatchBeginContactCallbacks);
+    PROFILE_SCOPE(Scene_BuildContactEvents);
 
     // Sanity!
-    AssertFatal( b2_maxManifoldPoints == 2, "Scene::dispatchBeginContactCallbacks() - Invalid assumption about max manifold points." );
+    AssertFatal( b2_maxManifoldPoints == 2, "Scene::buildContactEvents() - Invalid assumption about max manifold points." );
+
+    // Clear the contact events.
+    mContactEvents.clear();
 
     // Fetch contact count.
-    const U32 contactCount = mBeginContacts.size();
+    const U32 contactCount = mEndContacts.size() + mBeginContacts.size();
 
     // Finish if no contacts.
     if ( contactCount == 0 )
         return;
 
-    // Iterate all contacts.
+    // Reserve the contact events.
+    if ( contactCount > mContactEvents.capacity() )
+        mContactEvents.reserve( getMax( contactCount, mContactEvents.capacity() * 2 ) );
+
+    // Iterate end contacts.
+    for ( typeContactVector::iterator contactItr = mEndContacts.begin(); contactItr != mEndContacts.end(); ++contactItr )
+    {
+        addContactEvent( *contactItr, SceneContactEvent::CONTACT_EVENT_END );
+    }
+
+    // Iterate begin contacts.
     for ( typeContactHash::iterator contactItr = mBeginContacts.begin(); contactItr != mBeginContacts.end(); ++contactItr )
     {
-        // Fetch contact.
-        const TickContact& tickContact = contactItr->value;
+        addContactEvent( contactItr->value, SceneContactEvent::CONTACT_EVENT_BEGIN );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::addContactEvent( const TickContact& tickContact, const SceneContactEvent::ContactEventType contactEventType )
+{
+    // Fetch scene objects.
+    SceneObject* pSceneObjectA = tickContact.mpSceneObjectA;
+    SceneObject* pSceneObjectB = tickContact.mpSceneObjectB;
+
+    // Skip if either object is being deleted.
+    if ( pSceneObjectA->isBeingDeleted() || pSceneObjectB->isBeingDeleted() )
+        return;
+
+    // Skip if both objects don't have collision callback active unless there are contact listeners.
+    if ( mContactListeners.size() == 0 && !pSceneObjectA->getCollisionCallback() && !pSceneObjectB->getCollisionCallback() )
+        return;
+
+    // Fetch shape index.
+    const S32 shapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
+    const S32 shapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
+
+    // Sanity!
+    AssertFatal( shapeIndexA >= 0, "Scene::addContactEvent() - Cannot find shape index reported on physics proxy of a fixture." );
+    AssertFatal( shapeIndexB >= 0, "Scene::addContactEvent() - Cannot find shape index reported on physics proxy of a fixture." );
+
+    // Add the contact event.
+    mContactEvents.increment();
+    SceneContactEvent& contactEvent = mContactEvents.last();
+
+    contactEvent.mType = contactEventType;
+    contactEvent.mpSceneObjectA = pSceneObjectA;
+    contactEvent.mpSceneObjectB = pSceneObjectB;
+    contactEvent.mSceneObjectIdA = pSceneObjectA->getId();
+    contactEvent.mSceneObjectIdB = pSceneObjectB->getId();
+    contactEvent.mShapeIndexA = shapeIndexA;
+    contactEvent.mShapeIndexB = shapeIndexB;
+    contactEvent.mPointCount = tickContact.mPointCount;
+    contactEvent.mNormal = tickContact.mWorldManifold.normal;
+
+    for ( U32 index = 0; index < b2_maxManifoldPoints; ++index )
+    {
+        contactEvent.mPoints[index] = tickContact.mWorldManifold.points[index];
+        contactEvent.mNormalImpulses[index] = tickContact.mNormalImpulses[index];
+        contactEvent.mTangentImpulses[index] = tickContact.mTangentImpulses[index];
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::dispatchContactEvents( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_DispatchContactEvents);
+
+    // Build the contact events.
+    buildContactEvents();
+
+    // Fetch contact event count.
+    const U32 contactEventCount = mContactEvents.size();
+
+    // Finish if no contact events.
+    if ( contactEventCount == 0 )
+        return;
+
+    // Do we have any contact listeners?
+    if ( mContactListeners.size() > 0 )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_DispatchContactListeners);
+
+        // Yes, so notify them.
+        // NOTE:-   We work on a copy as listeners can be removed during the notification.
+        typeContactListenerVector contactListeners = mContactListeners;
+        for ( typeContactListenerVector::iterator listenerItr = contactListeners.begin(); listenerItr != contactListeners.end(); ++listenerItr )
+        {
+            (*listenerItr)->onSceneContacts( this, mContactEvents.address(), contactEventCount );
+        }
+    }
+
+    // Are we streaming the contacts?
+    if ( mContactStream )
+    {
+        // Yes, so format the contact event count.
+        char contactEventCountBuffer[16];
+        dSprintf( contactEventCountBuffer, sizeof(contactEventCountBuffer), "%d", contactEventCount );
+
+        // Does the scene handle the contact stream callback?
+        Namespace* pNamespace = getNamespace();
+        if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneContacts" ) ) != NULL )
+        {
+            // Yes, so perform script callback on the Scene.
+            Con::executef( this, 2, "onSceneContacts", contactEventCountBuffer );
+        }
+        else
+        {
+            // No, so call it on its behaviors.
+            const char* args[3] = { "onSceneContacts", "", contactEventCountBuffer };
+            callOnBehaviors( 3, args );
+        }
+
+        return;
+    }
+
+    // Iterate the contact events.
+    // NOTE:-   The callbacks may delete objects so their state is checked for each contact event.
+    for ( U32 eventIndex = 0; eventIndex < contactEventCount; ++eventIndex )
+    {
+        // Fetch contact event.
+        const SceneContactEvent& contactEvent = mContactEvents[eventIndex];
 
         // Fetch scene objects.
-        SceneObject* pSceneObjectA = tickContact.mpSceneObjectA;
-        SceneObject* pSceneObjectB = tickContact.mpSceneObjectB;
+        SceneObject* pSceneObjectA = contactEvent.mpSceneObjectA;
+        SceneObject* pSceneObjectB = contactEvent.mpSceneObjectB;
 
         // Skip if either object is being deleted.
         if ( pSceneObjectA->isBeingDeleted() || pSceneObjectB->isBeingDeleted() )
@@ -479,254 +730,319 @@ void Scene::dispatchBeginContactCallbacks( void )
         if ( !pSceneObjectA->getCollisionCallback() && !pSceneObjectB->getCollisionCallback() )
             continue;
 
-        // Fetch normal and contact points.
-        const U32& pointCount = tickContact.mPointCount;
-        const b2Vec2& normal = tickContact.mWorldManifold.normal;
-        const b2Vec2& point1 = tickContact.mWorldManifold.points[0];
-        const b2Vec2& point2 = tickContact.mWorldManifold.points[1];
-        const S32 shapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
-        const S32 shapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
-
-        // Sanity!
-        AssertFatal( shapeIndexA >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-        AssertFatal( shapeIndexB >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-
-        // Fetch collision impulse information
-        const F32 normalImpulse1 = tickContact.mNormalImpulses[0];
-        const F32 normalImpulse2 = tickContact.mNormalImpulses[1];
-        const F32 tangentImpulse1 = tickContact.mTangentImpulses[0];
-        const F32 tangentImpulse2 = tickContact.mTangentImpulses[1];
-
-        // Format objects.
-        char sceneObjectABuffer[16];
-        char sceneObjectBBuffer[16];
-        dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", pSceneObjectA->getId() );
-        dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", pSceneObjectB->getId() );
-
-        // Format miscellaneous information twice so object b can see things from his point of view.
-        char miscInfoBufferA[128];
-        char miscInfoBufferB[128];
-        if ( pointCount == 2 )
+        // Dispatch the callback.
+        if ( contactEvent.mType == SceneContactEvent::CONTACT_EVENT_BEGIN )
+            dispatchBeginContactCallback( contactEvent );
+        else
+            dispatchEndContactCallback( contactEvent );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::dispatchBeginContactCallback( const SceneContactEvent& contactEvent )
+{
+    // Fetch scene objects.
+    SceneObject* pSceneObjectA = contactEvent.mpSceneObjectA;
+    SceneObject* pSceneObjectB = contactEvent.mpSceneObjectB;
+
+    // Fetch normal and contact points.
+    const U32& pointCount = contactEvent.mPointCount;
+    const b2Vec2& normal = contactEvent.mNormal;
+    const b2Vec2& point1 = contactEvent.mPoints[0];
+    const b2Vec2& point2 = contactEvent.mPoints[1];
+    const S32 shapeIndexA = contactEvent.mShapeIndexA;
+    const S32 shapeIndexB = contactEvent.mShapeIndexB;
+
+    // Fetch collision impulse information
+    const F32 normalImpulse1 = contactEvent.mNormalImpulses[0];
+    const F32 normalImpulse2 = contactEvent.mNormalImpulses[1];
+    const F32 tangentImpulse1 = contactEvent.mTangentImpulses[0];
+    const F32 tangentImpulse2 = contactEvent.mTangentImpulses[1];
+
+    // Format objects.
+    char sceneObjectABuffer[16];
+    char sceneObjectBBuffer[16];
+    dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", contactEvent.mSceneObjectIdA );
+    dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", contactEvent.mSceneObjectIdB );
+
+    // Format miscellaneous information twice so object b can see things from his point of view.
+    char miscInfoBufferA[128];
+    char miscInfoBufferB[128];
+    if ( pointCount == 2 )
+    {
+        dSprintf(miscInfoBufferA, sizeof(miscInfoBufferA),
+            "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+            shapeIndexA, shapeIndexB,
+            -normal.x, -normal.y,
+            point1.x, point1.y,
+            normalImpulse1,
+            tangentImpulse1,
+            point2.x, point2.y,
+            normalImpulse2,
+            tangentImpulse2 );
+
+        dSprintf(miscInfoBufferB, sizeof(miscInfoBufferB),
+           "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+           shapeIndexB, shapeIndexA,
+           normal.x, normal.y,
+           point1.x, point1.y,
+           normalImpulse1,
+           tangentImpulse1,
+           point2.x, point2.y,
+           normalImpulse2,
+           tangentImpulse2);
+    }
+    else if ( pointCount == 1 )
+    {
+        dSprintf(miscInfoBufferA, sizeof(miscInfoBufferA),
+            "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+            shapeIndexA, shapeIndexB,
+            -normal.x, -normal.y,
+            point1.x, point1.y,
+            normalImpulse1,
+            tangentImpulse1 );
+
+        dSprintf(miscInfoBufferB, sizeof(miscInfoBufferB),
+           "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+           shapeIndexB, shapeIndexA,
+           normal.x, normal.y,
+           point1.x, point1.y,
+           normalImpulse1,
+           tangentImpulse1);
+    }
+    else
+    {
+        dSprintf(miscInfoBufferA, sizeof(miscInfoBufferA),
+            "%d %d",
+            shapeIndexA, shapeIndexB );
+
+        dSprintf(miscInfoBufferB, sizeof(miscInfoBufferB),
+           "%d %d",
+           shapeIndexB, shapeIndexA);
+    }
+
+    // Does the scene handle the collision callback?
+    Namespace* pNamespace = getNamespace();
+    if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneCollision" ) ) != NULL )
+    {
+        // Yes, so perform script callback on the Scene.
+        Con::executef( this, 4, "onSceneCollision",
+            sceneObjectABuffer,
+            sceneObjectBBuffer,
+            miscInfoBufferA );
+    }
+    else
+    {
+        // No, so call it on its behaviors.
+        const char* args[5] = { "onSceneCollision", "", sceneObjectABuffer, sceneObjectBBuffer, miscInfoBufferA };
+        callOnBehaviors( 5, args );
+    }
+
+    // Is object A allowed to collide with object B?
+    if (    (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
+            (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0 )
+    {
+        // Yes, so does it handle the collision callback?
+        if ( pSceneObjectA->isMethod("onCollision") )            
         {
-            dSprintf(miscInfoBufferA, sizeof(miscInfoBufferA),
-                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-                shapeIndexA, shapeIndexB,
-                -normal.x, -normal.y,
-                point1.x, point1.y,
-                normalImpulse1,
-                tangentImpulse1,
-                point2.x, point2.y,
-                normalImpulse2,
-                tangentImpulse2 );
-
-            dSprintf(miscInfoBufferB, sizeof(miscInfoBufferB),
-               "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-               shapeIndexB, shapeIndexA,
-               normal.x, normal.y,
-               point1.x, point1.y,
-               normalImpulse1,
-               tangentImpulse1,
-               point2.x, point2.y,
-               normalImpulse2,
-               tangentImpulse2);
+            // Yes, so perform the script callback on it.
+            Con::executef( pSceneObjectA, 3, "onCollision",
+                sceneObjectBBuffer,
+                miscInfoBufferA );
+        }
+        else
+        {
+            // No, so call it on its behaviors.
+            const char* args[4] = { "onCollision", "", sceneObjectBBuffer, miscInfoBufferA };
+            pSceneObjectA->callOnBehaviors( 4, args );
         }
-        else if ( pointCount == 1 )
+    }
+
+    // Is object B allowed to collide with object A?
+    if (    (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
+            (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0 )
+    {
+        // Yes, so does it handle the collision callback?
+        if ( pSceneObjectB->isMethod("onCollision") )            
         {
-            dSprintf(miscInfoBufferA, sizeof(miscInfoBufferA),
-                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-                shapeIndexA, shapeIndexB,
-                -normal.x, -normal.y,
-                point1.x, point1.y,
-                normalImpulse1,
-                tangentImpulse1 );
-
-            dSprintf(miscInfoBufferB, sizeof(miscInfoBufferB),
-               "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-               shapeIndexB, shapeIndexA,
-               normal.x, normal.y,
-               point1.x, point1.y,
-               normalImpulse1,
-               tangentImpulse1);
+            // Yes, so perform the script callback on it.
+            Con::executef( pSceneObjectB, 3, "onCollision",
+                sceneObjectABuffer,
+                miscInfoBufferB );
         }
         else
         {
-            dSprintf(miscInfoBufferA, sizeof(miscInfoBufferA),
-                "%d %d",
-                shapeIndexA, shapeIndexB );
-
-            dSprintf(miscInfoBufferB, sizeof(miscInfoBufferB),
-               "%d %d",
-               shapeIndexB, shapeIndexA);
+            // No, so call it on its behaviors.
+            const char* args[4] = { "onCollision", "", sceneObjectABuffer, miscInfoBufferB };
+            pSceneObjectB->callOnBehaviors( 4, args );
         }
+    }
+}
 
-        // Does the scene handle the collision callback?
-        Namespace* pNamespace = getNamespace();
-        if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneCollision" ) ) != NULL )
+//-----------------------------------------------------------------------------
+
+void Scene::dispatchEndContactCallback( const SceneContactEvent& contactEvent )
+{
+    // Fetch scene objects.
+    SceneObject* pSceneObjectA = contactEvent.mpSceneObjectA;
+    SceneObject* pSceneObjectB = contactEvent.mpSceneObjectB;
+
+    // Fetch shape index.
+    const S32 shapeIndexA = contactEvent.mShapeIndexA;
+    const S32 shapeIndexB = contactEvent.mShapeIndexB;
+
+    // Format objects.
+    char sceneObjectABuffer[16];
+    char sceneObjectBBuffer[16];
+    dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", contactEvent.mSceneObjectIdA );
+    dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", contactEvent.mSceneObjectIdB );
+
+    // Format miscellaneous information.
+    char miscInfoBuffer[32];
+    dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer), "%d %d", shapeIndexA, shapeIndexB );
+
+    // Does the scene handle the collision callback?
+    Namespace* pNamespace = getNamespace();
+    if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneEndCollision" ) ) != NULL )
+    {
+        // Yes, so does the scene handle the collision callback?
+        Con::executef( this, 4, "onSceneEndCollision",
+            sceneObjectABuffer,
+            sceneObjectBBuffer,
+            miscInfoBuffer );
+    }
+    else
+    {
+        // No, so call it on its behaviors.
+        const char* args[5] = { "onSceneEndCollision", "", sceneObjectABuffer, sceneObjectBBuffer, miscInfoBuffer };
+        callOnBehaviors( 5, args );
+    }
+
+    // Is object A allowed to collide with object B?
+    if (    (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
+            (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0 )
+    {
+        // Yes, so does it handle the collision callback?
+        if ( pSceneObjectA->isMethod("onEndCollision") )            
         {
-            // Yes, so perform script callback on the Scene.
-            Con::executef( this, 4, "onSceneCollision",
-                sceneObjectABuffer,
+            // Yes, so perform the script callback on it.
+            Con::executef( pSceneObjectA, 3, "onEndCollision",
                 sceneObjectBBuffer,
-                miscInfoBufferA );
+                miscInfoBuffer );
         }
         else
         {
             // No, so call it on its behaviors.
-            const char* args[5] = { "onSceneCollision", "", sceneObjectABuffer, sceneObjectBBuffer, miscInfoBufferA };
-            callOnBehaviors( 5, args );
+            const char* args[4] = { "onEndCollision", "", sceneObjectBBuffer, miscInfoBuffer };
+            pSceneObjectA->callOnBehaviors( 4, args );
         }
+    }
 
-        // Is object A allowed to collide with object B?
-        if (    (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
-                (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0 )
+    // Is object B allowed to collide with object A?
+    if (    (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
+            (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0 )
+    {
+        // Yes, so does it handle the collision callback?
+        if ( pSceneObjectB->isMethod("onEndCollision") )            
         {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectA->isMethod("onCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectA, 3, "onCollision",
-                    sceneObjectBBuffer,
-                    miscInfoBufferA );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onCollision", "", sceneObjectBBuffer, miscInfoBufferA };
-                pSceneObjectA->callOnBehaviors( 4, args );
-            }
+            // Yes, so perform the script callback on it.
+            Con::executef( pSceneObjectB, 3, "onEndCollision",
+                sceneObjectABuffer,
+                miscInfoBuffer );
         }
-
-        // Is object B allowed to collide with object A?
-        if (    (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
-                (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0 )
+        else
         {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectB->isMethod("onCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectB, 3, "onCollision",
-                    sceneObjectABuffer,
-                    miscInfoBufferB );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onCollision", "", sceneObjectABuffer, miscInfoBufferB };
-                pSceneObjectB->callOnBehaviors( 4, args );
-            }
+            // No, so call it on its behaviors.
+            const char* args[4] = { "onEndCollision", "", sceneObjectABuffer, miscInfoBuffer };
+            pSceneObjectB->callOnBehaviors( 4, args );
         }
     }
 }
 
 //-----------------------------------------------------------------------------
 
-void Scene::dispatchEndContactCallbacks( void )
+void Scene::integrateSceneObjects( DebugStats* pDebugStats )
 {
-    // Debug Profiling.
-    PROFILE_SCOPE(Scene_DispatchEndContactCallbacks);
+    // Fetch ticked scene object count.
+    const S32 tickedSceneObjectCount = mTickedSceneObjects.size();
 
-    // Sanity!
-    AssertFatal( b2_maxManifoldPoints == 2, "Scene::dispatchEndContactCallbacks() - Invalid assumption about max manifold points." );
-
-    // Fetch contact count.
-    const U32 contactCount = mEndContacts.size();
+    // Clear parallel scene objects.
+    mParallelSceneObjects.clear();
 
-    // Finish if no contacts.
-    if ( contactCount == 0 )
-        return;
-
-    // Iterate all contacts.
-    for ( typeContactVector::iterator contactItr = mEndContacts.begin(); contactItr != mEndContacts.end(); ++contactItr )
+    // Gather the objects that can be integrated in parallel if we're able to.
+    if ( mParallelIntegrate && JobScheduler::Instance->getWorkerCount() > 0 )
     {
-        // Fetch contact.
-        const TickContact& tickContact = *contactItr;
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_GatherParallelIntegrate);
 
-        // Fetch scene objects.
-        SceneObject* pSceneObjectA = tickContact.mpSceneObjectA;
-        SceneObject* pSceneObjectB = tickContact.mpSceneObjectB;
+        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
+        {
+            // Fetch scene object.
+            SceneObject* pSceneObject = mTickedSceneObjects[i];
 
-        // Skip if either object is being deleted.
-        if ( pSceneObjectA->isBeingDeleted() || pSceneObjectB->isBeingDeleted() )
-            continue;
+            // Skip if not interested in integration or not parallel-safe.
+            if ( (pSceneObject->getIntegrationTickInterest() & SceneObject::TICK_INTEREST_INTEGRATION) == 0 ||
+                !pSceneObject->canIntegrateParallel() )
+                continue;
 
-        // Skip if both objects don't have collision callback active.
-        if ( !pSceneObjectA->getCollisionCallback() && !pSceneObjectB->getCollisionCallback() )
-            continue;
+            // Defer any side effects of the integration.
+            pSceneObject->beginDeferredIntegration();
+            mParallelSceneObjects.push_back( pSceneObject );
+        }
+    }
 
-        // Fetch shape index.
-        const S32 shapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
-        const S32 shapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
+    // Integrate the parallel objects.
+    if ( mParallelSceneObjects.size() > 0 )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_IntegrateObjectParallel);
 
-        // Sanity!
-        AssertFatal( shapeIndexA >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-        AssertFatal( shapeIndexB >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
+        JobScheduler::Instance->parallelFor( (U32)mParallelSceneObjects.size(), 64, &integrateSceneObjectsJob, this );
+    }
 
-        // Format objects.
-        char sceneObjectABuffer[16];
-        char sceneObjectBBuffer[16];
-        dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", pSceneObjectA->getId() );
-        dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", pSceneObjectB->getId() );
+    // Iterate ticked scene objects.
+    // NOTE:-   Objects are processed in tick order so any deferred side effects happen in the
+    //          same order as they would have done had everything been integrated serially.
+    for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_IntegrateObject);
 
-        // Format miscellaneous information.
-        char miscInfoBuffer[32];
-        dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer), "%d %d", shapeIndexA, shapeIndexB );
+        // Fetch scene object.
+        SceneObject* pSceneObject = mTickedSceneObjects[i];
 
-        // Does the scene handle the collision callback?
-        Namespace* pNamespace = getNamespace();
-        if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneEndCollision" ) ) != NULL )
-        {
-            // Yes, so does the scene handle the collision callback?
-            Con::executef( this, 4, "onSceneEndCollision",
-                sceneObjectABuffer,
-                sceneObjectBBuffer,
-                miscInfoBuffer );
-        }
-        else
+        // Was the object integrated in parallel?
+        if ( pSceneObject->getDeferIntegration() )
         {
-            // No, so call it on its behaviors.
-            const char* args[5] = { "onSceneEndCollision", "", sceneObjectABuffer, sceneObjectBBuffer, miscInfoBuffer };
-            callOnBehaviors( 5, args );
+            // Yes, so perform its deferred side effects.
+            pSceneObject->endDeferredIntegration();
+            continue;
         }
 
-        // Is object A allowed to collide with object B?
-        if (    (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
-                (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0 )
+        // Skip if not interested in integration.
+        if ( (pSceneObject->getIntegrationTickInterest() & SceneObject::TICK_INTEREST_INTEGRATION) == 0 )
         {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectA->isMethod("onEndCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectA, 3, "onEndCollision",
-                    sceneObjectBBuffer,
-                    miscInfoBuffer );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onEndCollision", "", sceneObjectBBuffer, miscInfoBuffer };
-                pSceneObjectA->callOnBehaviors( 4, args );
-            }
+            mDebugStats.objectsTickSkipped++;
+            continue;
         }
 
-        // Is object B allowed to collide with object A?
-        if (    (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
-                (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0 )
-        {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectB->isMethod("onEndCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectB, 3, "onEndCollision",
-                    sceneObjectABuffer,
-                    miscInfoBuffer );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onEndCollision", "", sceneObjectABuffer, miscInfoBuffer };
-                pSceneObjectB->callOnBehaviors( 4, args );
-            }
-        }
+        // Integrate.
+        pSceneObject->integrateObject( mSceneTime, Tickable::smTickSec, pDebugStats );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::integrateSceneObjectsJob( void* pContext, const U32 startIndex, const U32 endIndex )
+{
+    // Fetch scene.
+    Scene* pScene = static_cast<Scene*>( pContext );
+
+    // Integrate the parallel objects.
+    for ( U32 i = startIndex; i < endIndex; ++i )
+    {
+        pScene->mParallelSceneObjects[i]->integrateObject( pScene->mSceneTime, Tickable::smTickSec, &pScene->mDebugStats );
     }
 }
 
@@ -745,27 +1061,29 @@ void Scene::processTick( void )
     processDeleteRequests(false);
 
     // Update debug stats.
-    mDebugStats.fps           = Con::getFloatVariable("fps::framePeriod", 0.0f);
-    mDebugStats.frameCount    = (U32)Con::getIntVariable("fps::frameCount", 0);
+    mDebugStats.fps           = Game->getFramesPerSecond();
+    mDebugStats.frameCount    = Game->getFrameCount();
     mDebugStats.bodyCount     = (U32)mpWorld->GetBodyCount();
     mDebugStats.jointCount    = (U32)mpWorld->GetJointCount();
     mDebugStats.contactCount  = (U32)mpWorld->GetContactCount();
     mDebugStats.proxyCount    = (U32)mpWorld->GetProxyCount();
     mDebugStats.objectsCount  = (U32)mSceneObjects.size();
+    mDebugStats.objectsEnabled = mEnabledSceneObjectCount;
+    mDebugStats.objectsVisible = mVisibleSceneObjectCount;
     mDebugStats.worldProfile  = mpWorld->GetProfile();
 
     // Set particle stats.
     mDebugStats.particlesAlloc = ParticleSystem::Instance->getAllocatedParticleCount();
-    mDebugStats.particlesUsed = ParticleSystem::Instance->getActiveParticleCount();
+    mDebugStats.particlesUsed = ParticleSystem::Instance->getLiveParticleCount();
     mDebugStats.particlesFree = mDebugStats.particlesAlloc - mDebugStats.particlesUsed;
 
     // Finish if scene is paused.
     if ( !getScenePause() )
     {
         // Reset object stats.
-        U32 objectsEnabled = 0;
-        U32 objectsVisible = 0;
         U32 objectsAwake   = 0;
+        mDebugStats.objectsTickSkipped = 0;
+        mDebugStats.particlesThrottled = 0;
 
         // Fetch if a "normal" i.e. non-editor scene.
         const bool isNormalScene = !getIsEditorScene();
@@ -773,40 +1091,10 @@ void Scene::processTick( void )
         // Update scene time.
         mSceneTime += Tickable::smTickSec;
 
-        // Clear ticked scene objects.
-        mTickedSceneObjects.clear();
-
-        // Iterate scene objects.
-        for( S32 n = 0; n < mSceneObjects.size(); ++n )
-        {
-            // Fetch scene object.
-            SceneObject* pSceneObject = mSceneObjects[n];
-
-            // Update awake/asleep counts.
-            if ( pSceneObject->getAwake() )
-                objectsAwake++;
-
-            // Update visible.
-            if ( pSceneObject->getVisible() )
-                objectsVisible++;
-
-            // Push scene object if it's eligible for ticking.
-            if ( pSceneObject->isEnabled() )
-            {
-                // Update enabled.
-                objectsEnabled++;
-
-                // Add to ticked objects if object is not being deleted and this is a "normal" scene or
-                // the object is marked as allowing editor ticks.
-                if ( !pSceneObject->isBeingDeleted() && (isNormalScene || pSceneObject->getIsEditorTickAllowed() )  )
-                    mTickedSceneObjects.push_back( pSceneObject );
-            }
-        }
-
-        // Update object stats.
-        mDebugStats.objectsEnabled = objectsEnabled;
-        mDebugStats.objectsVisible = objectsVisible;
-        mDebugStats.objectsAwake   = objectsAwake;
+        // Fetch the ticked scene objects.
+        // NOTE:-   The tickable scene objects are maintained as objects are added, removed, enabled or deleted.
+        //          We work on a copy as callbacks during the tick can change them.
+        mTickedSceneObjects = mTickableSceneObjects;
 
         // Debug Status Reference.
         DebugStats* pDebugStats = &mDebugStats;
@@ -824,16 +1112,39 @@ void Scene::processTick( void )
             // Debug Profiling.
             PROFILE_SCOPE(Scene_PreIntegrate);
 
+            // Fetch scene object.
+            SceneObject* pSceneObject = mTickedSceneObjects[i];
+
+            // Update awake counts.
+            if ( pSceneObject->getAwake() )
+                objectsAwake++;
+
+            // Fetch the tick interest.
+            // NOTE:-   This is kept for the integration stage so that bodies that move and then fall asleep
+            //          during the physics step are still integrated.
+            const U32 tickInterest = pSceneObject->getTickInterest();
+            pSceneObject->mPreTickInterest = tickInterest;
+
+            // Skip if not interested in integration.
+            if ( (tickInterest & SceneObject::TICK_INTEREST_INTEGRATION) == 0 )
+            {
+                mDebugStats.objectsTickSkipped++;
+                continue;
+            }
+
             // Pre-integrate.
-            mTickedSceneObjects[i]->preIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
+            pSceneObject->preIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
         }
 
+        // Update object stats.
+        mDebugStats.objectsAwake = objectsAwake;
+
         // ****************************************************
         // Integrate controllers.
         // ****************************************************
 
         // Fetch the controller set.
-        SimSet* pControllerSet = getControllers();
+        SceneControllerSet* pControllerSet = getControllers();
 
         // Do we have any scene controllers?
         if ( pControllerSet != NULL )
@@ -841,22 +1152,9 @@ void Scene::processTick( void )
             // Debug Profiling.
             PROFILE_SCOPE(Scene_IntegrateSceneControllers);
 
-            // Yes, so fetch scene controller count.
-            const S32 sceneControllerCount = (S32)pControllerSet->size();
-
-            // Iterate scene controllers.
-            for( S32 i = 0; i < sceneControllerCount; i++ )
-            {
-                // Fetch the scene controller.
-                SceneController* pController = dynamic_cast<SceneController*>((*pControllerSet)[i]);
-
-                // Skip if not a controller.
-                if ( pController == NULL )
-                    continue;
-
-                // Integrate.
-                pController->integrate( this, mSceneTime, Tickable::smTickSec, pDebugStats );
-            }
+            // Yes, so integrate them.
+            // NOTE:    Controllers that declare a region share a single world query for their candidates.
+            pControllerSet->integrate( this, mSceneTime, Tickable::smTickSec, pDebugStats );
         }
 
         // Debug Profiling.
@@ -865,10 +1163,16 @@ void Scene::processTick( void )
         // Reset contacts.
         mBeginContacts.clear();
         mEndContacts.clear();
+        mContactEvents.clear();
 
         // Only step the physics if a "normal" scene.
         if ( isNormalScene )
         {
+            // Solve the physics islands and update the physics contacts across the job scheduler if requested.
+            const bool parallelPhysics = JobScheduler::Instance->getWorkerCount() > 0;
+            mpWorld->SetTaskExecutor( mParallelSolve && parallelPhysics ? this : NULL );
+            mpWorld->SetCollideTaskExecutor( mParallelCollide && parallelPhysics ? this : NULL );
+
             // Step the physics.
             mpWorld->Step( Tickable::smTickSec, mVelocityIterations, mPositionIterations );
         }
@@ -880,18 +1184,19 @@ void Scene::processTick( void )
         forwardContacts();
 
         // ****************************************************
-        // Integrate objects.
+        // Integrate animations.
         // ****************************************************
 
-        // Iterate ticked scene objects.
-        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
-        {
-            // Debug Profiling.
-            PROFILE_SCOPE(Scene_IntegrateObject);
+        // Advance the grouped animations.
+        // NOTE:-   Only the providers whose animation frame changes are touched.
+        mAnimationClock.integrate( Tickable::smTickSec, pDebugStats );
+
+        // ****************************************************
+        // Integrate objects.
+        // ****************************************************
 
-            // Integrate.
-            mTickedSceneObjects[i]->integrateObject( mSceneTime, Tickable::smTickSec, pDebugStats );
-        }
+        // Integrate.
+        integrateSceneObjects( pDebugStats );
 
         // ****************************************************
         // Post-Integrate Stage.
@@ -903,8 +1208,18 @@ void Scene::processTick( void )
             // Debug Profiling.
             PROFILE_SCOPE(Scene_PostIntegrate);
 
+            // Fetch scene object.
+            SceneObject* pSceneObject = mTickedSceneObjects[i];
+
+            // Skip if not interested in post-integration.
+            if ( (pSceneObject->getTickInterest() & SceneObject::TICK_INTEREST_POST_INTEGRATION) == 0 )
+            {
+                mDebugStats.objectsTickSkipped++;
+                continue;
+            }
+
             // Post-integrate.
-            mTickedSceneObjects[i]->postIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
+            pSceneObject->postIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
         }
 
         // Scene update callback.
@@ -919,9 +1234,8 @@ void Scene::processTick( void )
         // Only dispatch contacts if a "normal" scene.
         if ( isNormalScene )
         {
-            // Dispatch contacts callbacks.
-            dispatchEndContactCallbacks();
-            dispatchBeginContactCallbacks();
+            // Dispatch contacts events.
+            dispatchContactEvents();
         }
 
         // Clear ticked scene objects.
@@ -959,6 +1273,10 @@ void Scene::interpolateTick( F32 timeDelta )
         if ( !pSceneObject->isEnabled() || pSceneObject->isBeingDeleted() )
             continue;
 
+        // Skip interpolation of scene object if it's not interested.
+        if ( (pSceneObject->getTickInterest() & SceneObject::TICK_INTEREST_INTEGRATION) == 0 )
+            continue;
+
         pSceneObject->interpolateObject( timeDelta );
     }
 }
@@ -990,6 +1308,9 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     pDebugStats->batchLayerFlush                = 0;
     pDebugStats->batchNoBatchFlush              = 0;
     pDebugStats->batchAnonymousFlush            = 0;
+    pDebugStats->batchBytesUploaded             = 0;
+    pDebugStats->renderCacheHits                = 0;
+    pDebugStats->renderCacheMisses              = 0;
 
     // Set batch renderer wireframe mode.
     mBatchRenderer.setWireframeMode( getDebugMask() & SCENE_DEBUG_WIREFRAME_RENDER );
@@ -1014,8 +1335,21 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     WorldQueryFilter queryFilter( pSceneRenderState->mRenderLayerMask, pSceneRenderState->mRenderGroupMask, true, true, false, false );
     mpWorldQuery->setQueryFilter( queryFilter );
 
-    // Query render AABB.
-    mpWorldQuery->aabbQueryAABB( cameraAABB );
+    // Are we using the render query cache?
+    if ( mRenderQueryCache )
+    {
+        // Yes, so query render AABB using the cache.
+        mpWorldQuery->renderQueryAABB( cameraAABB );
+
+        // Update the cache stats.
+        pDebugStats->renderCacheHits = mpWorldQuery->getRenderQueryCacheHits();
+        pDebugStats->renderCacheMisses = mpWorldQuery->getRenderQueryCacheMisses();
+    }
+    else
+    {
+        // No, so query render AABB.
+        mpWorldQuery->aabbQueryAABB( cameraAABB );
+    }
 
     // Debug Profiling.
     PROFILE_END();  //Scene_RenderSceneVisibleQuery
@@ -1026,223 +1360,110 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
         // Debug Profiling.
         PROFILE_SCOPE(Scene_RenderSceneCompileRenderRequests);
 
-        // Fetch the primary scene render queue.
-        SceneRenderQueue* pSceneRenderQueue = SceneRenderQueueFactory.createObject();      
-
-        // Yes so step through layers.
-        for ( S32 layer = MAX_LAYERS_SUPPORTED-1; layer >= 0 ; layer-- )
+        // Are we compiling the layers in parallel?
+        if ( mParallelRenderCompile && JobScheduler::Instance->getWorkerCount() > 0 )
         {
-            // Fetch layer.
-            typeWorldQueryResultVector& layerResults = mpWorldQuery->getLayeredQueryResults( layer );
-
-            // Fetch layer object count.
-            const U32 layerObjectCount = layerResults.size();
-
-            // Are there any objects to render in this layer?
-            if ( layerObjectCount > 0 )
+            // Yes, so gather the layers to compile.
+            mParallelRenderCompileLayers.clear();
+            for ( S32 layer = MAX_LAYERS_SUPPORTED-1; layer >= 0 ; layer-- )
             {
-                // Yes, so increase render picked.
-                pDebugStats->renderPicked += layerObjectCount;
-
-                // Iterate query results.
-                for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
-                {
-                    // Fetch scene object.
-                    SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
-
-                    // Skip if the object should not render.
-                    if ( !pSceneObject->shouldRender() )
-                        continue;
-
-                    // Can the scene object prepare a render?
-                    if ( pSceneObject->canPrepareRender() )
-                    {
-                        // Yes. so is it batch isolated.
-                        if ( pSceneObject->getBatchIsolated() )
-                        {
-                            // Yes, so create a default render request  on the primary queue.
-                            SceneRenderRequest* pIsolatedSceneRenderRequest = Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
-
-                            // Create a new isolated render queue.
-                            pIsolatedSceneRenderRequest->mpIsolatedRenderQueue = SceneRenderQueueFactory.createObject();
-
-                            // Prepare in the isolated queue.
-                            pSceneObject->scenePrepareRender( pSceneRenderState, pIsolatedSceneRenderRequest->mpIsolatedRenderQueue );
-
-                            // Increase render request count.
-                            pDebugStats->renderRequests += (U32)pIsolatedSceneRenderRequest->mpIsolatedRenderQueue->getRenderRequests().size();
+                // Skip if there are no objects to render in this layer.
+                if ( mpWorldQuery->getLayeredQueryResults( layer ).size() == 0 )
+                    continue;
 
-                            // Adjust for the extra private render request.
-                            pDebugStats->renderRequests -= 1;
-                        }
-                        else
-                        {
-                            // No, so prepare in primary queue.
-                            pSceneObject->scenePrepareRender( pSceneRenderState, pSceneRenderQueue );
-                        }
-                    }
-                    else
-                    {
-                        // No, so create a default render request for it.
-                        Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
-                    }
-                }
+                // Fetch the parallel render layer.
+                ParallelRenderLayer& renderLayer = mParallelRenderLayers[layer];
 
-                // Fetch render requests.
-                SceneRenderQueue::typeRenderRequestVector& sceneRenderRequests = pSceneRenderQueue->getRenderRequests();
+                // Create the layer render queue.
+                // NOTE:    Each layer has its own render request cache so that layers can be compiled without contention.
+                renderLayer.mpRenderQueue = SceneRenderQueueFactory.createObject();
+                renderLayer.mpRenderQueue->setRenderRequestFactory( &renderLayer.mRenderRequestFactory );
+                renderLayer.mRenderRequests = 0;
 
-                // Fetch render request count.
-                const U32 renderRequestCount = (U32)sceneRenderRequests.size();
+                mParallelRenderCompileLayers.push_back( layer );
+            }
 
-                // Increase render request count.
-                pDebugStats->renderRequests += renderRequestCount;
+            // Compile the layers in parallel.
+            mpParallelRenderState = pSceneRenderState;
+            JobScheduler::Instance->parallelFor( (U32)mParallelRenderCompileLayers.size(), 1, &compileRenderLayersJob, this );
+            mpParallelRenderState = NULL;
 
-                // Do we have more than a single render request?
-                if ( renderRequestCount > 1 )
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(Scene_RenderSceneLayerSorting);
+            // Render the layers in order.
+            for ( S32 index = 0; index < mParallelRenderCompileLayers.size(); ++index )
+            {
+                // Fetch layer.
+                const U32 layer = mParallelRenderCompileLayers[index];
 
-                    // Yes, so fetch layer sort mode.
-                    SceneRenderQueue::RenderSort& mode = mLayerSortModes[layer];
+                // Fetch the parallel render layer.
+                ParallelRenderLayer& renderLayer = mParallelRenderLayers[layer];
 
-                    // Temporarily switch to normal sort if batch sort but batcher disabled.
-                    if ( !mBatchRenderer.getBatchEnabled() && mode == SceneRenderQueue::RENDER_SORT_BATCH )
-                        mode = SceneRenderQueue::RENDER_SORT_NEWEST;
+                // Increase render picked and requests.
+                pDebugStats->renderPicked += mpWorldQuery->getLayeredQueryResults( layer ).size();
+                pDebugStats->renderRequests += renderLayer.mRenderRequests;
 
-                    // Set render queue mode.
-                    pSceneRenderQueue->setSortMode( mode );
+                // Render the layer.
+                renderSceneLayer( pSceneRenderState, layer, renderLayer.mpRenderQueue, pDebugStats );
 
-                    // Sort the render requests.
-                    pSceneRenderQueue->sort();
-                }
+                // Fetch render requests.
+                SceneRenderQueue::typeRenderRequestVector& sceneRenderRequests = renderLayer.mpRenderQueue->getRenderRequests();
 
-                // Iterate render requests.
+                // Cache any isolated render queues back to the layer.
                 for( SceneRenderQueue::typeRenderRequestVector::iterator renderRequestItr = sceneRenderRequests.begin(); renderRequestItr != sceneRenderRequests.end(); ++renderRequestItr )
                 {
-                     // Debug Profiling.
-                    PROFILE_SCOPE(Scene_RenderSceneRequests);
-
                     // Fetch render request.
                     SceneRenderRequest* pSceneRenderRequest = *renderRequestItr;
 
-                    // Fetch scene render object.
-                    SceneRenderObject* pSceneRenderObject = pSceneRenderRequest->mpSceneRenderObject;
-             
-                    // Flush if the object is not render batched and we're in strict order mode.
-                    if ( !pSceneRenderObject->isBatchRendered() && mBatchRenderer.getStrictOrderMode() )
-                    {
-                        mBatchRenderer.flush( pDebugStats->batchNoBatchFlush );
-                    }
-                    // Flush if the object is batch isolated.
-                    else if ( pSceneRenderObject->getBatchIsolated() )
-                    {
-                        mBatchRenderer.flush( pDebugStats->batchIsolatedFlush );
-                    }
-
-                    // Yes, so is the object batch rendered?
-                    if ( pSceneRenderObject->isBatchRendered() )
-                    {
-                        // Yes, so set the blend mode.
-                        mBatchRenderer.setBlendMode( pSceneRenderRequest );
-
-                        // Set the alpha test mode.
-                        mBatchRenderer.setAlphaTestMode( pSceneRenderRequest );
-                    }
-
-                    // Set batch strict order mode.
-                    // NOTE:    We keep reasserting this because an object is free to change it during rendering.
-                    mBatchRenderer.setStrictOrderMode( pSceneRenderQueue->getStrictOrderMode() );
-
-                    // Is the object batch isolated?
-                    if ( pSceneRenderObject->getBatchIsolated() )
-                    {
-                        // Yes, so fetch isolated render queue.
-                        SceneRenderQueue* pIsolatedRenderQueue = pSceneRenderRequest->mpIsolatedRenderQueue;
-
-                        // Sanity!
-                        AssertFatal( pIsolatedRenderQueue != NULL, "Cannot render batch isolated with an isolated render queue." );
-
-                        // Sort the isolated render requests.
-                        pIsolatedRenderQueue->sort();
-
-                        // Fetch isolated render requests.
-                        SceneRenderQueue::typeRenderRequestVector& isolatedRenderRequests = pIsolatedRenderQueue->getRenderRequests();
-
-                        // Can the object render?
-                        if ( pSceneRenderObject->validRender() )
-                        {
-                            // Yes, so iterate isolated render requests.
-                            for( SceneRenderQueue::typeRenderRequestVector::iterator isolatedRenderRequestItr = isolatedRenderRequests.begin(); isolatedRenderRequestItr != isolatedRenderRequests.end(); ++isolatedRenderRequestItr )
-                            {
-                                pSceneRenderObject->sceneRender( pSceneRenderState, *isolatedRenderRequestItr, &mBatchRenderer );
-                            }
-                        }
-                        else
-                        {
-                            // No, so iterate isolated render requests.
-                            for( SceneRenderQueue::typeRenderRequestVector::iterator isolatedRenderRequestItr = isolatedRenderRequests.begin(); isolatedRenderRequestItr != isolatedRenderRequests.end(); ++isolatedRenderRequestItr )
-                            {
-                                pSceneRenderObject->sceneRenderFallback( pSceneRenderState, *isolatedRenderRequestItr, &mBatchRenderer );
-                            }
-
-                            // Increase render fallbacks.
-                            pDebugStats->renderFallbacks++;
-                        }
-
-                        // Flush isolated batch.
-                        mBatchRenderer.flush( pDebugStats->batchIsolatedFlush );
-                    }
-                    else
-                    {
-                        // No, so can the object render?
-                        if ( pSceneRenderObject->validRender() )
-                        {
-                            // Yes, so render object.
-                            pSceneRenderObject->sceneRender( pSceneRenderState, pSceneRenderRequest, &mBatchRenderer );
-                        }
-                        else
-                        {
-                            // No, so render using fallback.
-                            pSceneRenderObject->sceneRenderFallback( pSceneRenderState, pSceneRenderRequest, &mBatchRenderer );
+                    // Skip if not isolated.
+                    if ( pSceneRenderRequest->mpIsolatedRenderQueue == NULL )
+                        continue;
 
-                            // Increase render fallbacks.
-                            pDebugStats->renderFallbacks++;
-                        }
-                    }
+                    renderLayer.mRenderQueueFactory.cacheObject( pSceneRenderRequest->mpIsolatedRenderQueue );
+                    pSceneRenderRequest->mpIsolatedRenderQueue = NULL;
                 }
 
-                // Flush.
-                // NOTE:    We cannot batch between layers as we adhere to a strict layer render order.
-                mBatchRenderer.flush( pDebugStats->batchLayerFlush );
+                // Cache render queue.
+                SceneRenderQueueFactory.cacheObject( renderLayer.mpRenderQueue );
+                renderLayer.mpRenderQueue = NULL;
+            }
+        }
+        else
+        {
+            // No, so fetch the primary scene render queue.
+            SceneRenderQueue* pSceneRenderQueue = SceneRenderQueueFactory.createObject();      
+
+            // Step through layers.
+            for ( S32 layer = MAX_LAYERS_SUPPORTED-1; layer >= 0 ; layer-- )
+            {
+                // Fetch layer object count.
+                const U32 layerObjectCount = mpWorldQuery->getLayeredQueryResults( layer ).size();
 
-                // Iterate query results.
-                for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
+                // Are there any objects to render in this layer?
+                if ( layerObjectCount > 0 )
                 {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(Scene_RenderObjectOverlays);
+                    // Yes, so increase render picked.
+                    pDebugStats->renderPicked += layerObjectCount;
 
-                    // Fetch scene object.
-                    SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
+                    // Compile the layer.
+                    pDebugStats->renderRequests += compileSceneLayer( pSceneRenderState, layer, pSceneRenderQueue, SceneRenderQueueFactory );
 
-                    // Render object overlay.
-                    pSceneObject->sceneRenderOverlay( pSceneRenderState );
+                    // Render the layer.
+                    renderSceneLayer( pSceneRenderState, layer, pSceneRenderQueue, pDebugStats );
                 }
+
+                // Reset render queue.
+                pSceneRenderQueue->resetState();
             }
 
-            // Reset render queue.
-            pSceneRenderQueue->resetState();
+            // Cache render queue..
+            SceneRenderQueueFactory.cacheObject( pSceneRenderQueue );
         }
-
-        // Cache render queue..
-        SceneRenderQueueFactory.cacheObject( pSceneRenderQueue );
     }
 
     // Draw controllers.
     if ( getDebugMask() & Scene::SCENE_DEBUG_CONTROLLERS )
     {
         // Fetch the controller set.
-        SimSet* pControllerSet = getControllers();
+        SceneControllerSet* pControllerSet = getControllers();
 
         // Do we have any scene controllers?
         if ( pControllerSet != NULL )
@@ -1250,25 +1471,14 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
             // Debug Profiling.
             PROFILE_SCOPE(Scene_RenderControllers);
 
-            // Yes, so fetch scene controller count.
-            const S32 sceneControllerCount = (S32)pControllerSet->size();
-
-            // Iterate scene controllers.
-            for( S32 i = 0; i < sceneControllerCount; i++ )
-            {
-                // Fetch the scene controller.
-                SceneController* pController = dynamic_cast<SceneController*>((*pControllerSet)[i]);
-
-                // Skip if not a controller.
-                if ( pController == NULL )
-                    continue;
-
-                // Render the overlay.
-                pController->renderOverlay( this, pSceneRenderState, &mBatchRenderer );
-            }
+            // Yes, so render the overlays.
+            pControllerSet->renderOverlay( this, pSceneRenderState, &mBatchRenderer );
 
             // Flush isolated batch.
             mBatchRenderer.flush( pDebugStats->batchIsolatedFlush );
+
+            // Restore any retained render state.
+            mBatchRenderer.restoreRenderState();
         }
     }
 
@@ -1297,6 +1507,249 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
 
 //-----------------------------------------------------------------------------
 
+U32 Scene::compileSceneLayer( const SceneRenderState* pSceneRenderState, const U32 layer, SceneRenderQueue* pSceneRenderQueue, FactoryCache<SceneRenderQueue>& isolatedRenderQueueFactory )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_CompileSceneLayer);
+
+    // Fetch layer.
+    typeWorldQueryResultVector& layerResults = mpWorldQuery->getLayeredQueryResults( layer );
+
+    // Reset render request count.
+    U32 renderRequests = 0;
+
+    for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
+    {
+        // Fetch scene object.
+        SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
+
+        // Skip if the object should not render.
+        if ( !pSceneObject->shouldRender() )
+            continue;
+
+        // Can the scene object prepare a render?
+        if ( pSceneObject->canPrepareRender() )
+        {
+            // Yes. so is it batch isolated.
+            if ( pSceneObject->getBatchIsolated() )
+            {
+                // Yes, so create a default render request  on the primary queue.
+                SceneRenderRequest* pIsolatedSceneRenderRequest = Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
+
+                // Create a new isolated render queue.
+                pIsolatedSceneRenderRequest->mpIsolatedRenderQueue = isolatedRenderQueueFactory.createObject();
+                pIsolatedSceneRenderRequest->mpIsolatedRenderQueue->setRenderRequestFactory( pSceneRenderQueue->getRenderRequestFactory() );
+
+                // Prepare in the isolated queue.
+                pSceneObject->scenePrepareRender( pSceneRenderState, pIsolatedSceneRenderRequest->mpIsolatedRenderQueue );
+
+                // Sort the isolated render requests.
+                pIsolatedSceneRenderRequest->mpIsolatedRenderQueue->sort();
+
+                // Increase render request count.
+                renderRequests += (U32)pIsolatedSceneRenderRequest->mpIsolatedRenderQueue->getRenderRequests().size();
+
+                // Adjust for the extra private render request.
+                renderRequests -= 1;
+            }
+            else
+            {
+                // No, so prepare in primary queue.
+                pSceneObject->scenePrepareRender( pSceneRenderState, pSceneRenderQueue );
+            }
+        }
+        else
+        {
+            // No, so create a default render request for it.
+            Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
+        }
+    }
+
+    // Fetch render requests.
+    SceneRenderQueue::typeRenderRequestVector& sceneRenderRequests = pSceneRenderQueue->getRenderRequests();
+
+    // Fetch render request count.
+    const U32 renderRequestCount = (U32)sceneRenderRequests.size();
+
+    // Increase render request count.
+    renderRequests += renderRequestCount;
+
+    // Do we have more than a single render request?
+    if ( renderRequestCount > 1 )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_RenderSceneLayerSorting);
+
+        // Yes, so fetch layer sort mode.
+        SceneRenderQueue::RenderSort& mode = mLayerSortModes[layer];
+
+        // Temporarily switch to normal sort if batch sort but batcher disabled.
+        if ( !mBatchRenderer.getBatchEnabled() && mode == SceneRenderQueue::RENDER_SORT_BATCH )
+            mode = SceneRenderQueue::RENDER_SORT_NEWEST;
+
+        // Set render queue mode.
+        pSceneRenderQueue->setSortMode( mode );
+
+        // Sort the render requests.
+        pSceneRenderQueue->sort();
+    }
+
+    return renderRequests;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::compileRenderLayersJob( void* pContext, const U32 startIndex, const U32 endIndex )
+{
+    // Fetch scene.
+    Scene* pScene = static_cast<Scene*>( pContext );
+
+    // Compile the layers.
+    for ( U32 index = startIndex; index < endIndex; ++index )
+    {
+        // Fetch layer.
+        const U32 layer = pScene->mParallelRenderCompileLayers[index];
+
+        // Fetch the parallel render layer.
+        ParallelRenderLayer& renderLayer = pScene->mParallelRenderLayers[layer];
+
+        // Compile the layer.
+        renderLayer.mRenderRequests = pScene->compileSceneLayer( pScene->mpParallelRenderState, layer, renderLayer.mpRenderQueue, renderLayer.mRenderQueueFactory );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::renderSceneLayer( const SceneRenderState* pSceneRenderState, const U32 layer, SceneRenderQueue* pSceneRenderQueue, DebugStats* pDebugStats )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_RenderSceneLayer);
+
+    // Fetch layer.
+    typeWorldQueryResultVector& layerResults = mpWorldQuery->getLayeredQueryResults( layer );
+
+    // Fetch render requests.
+    SceneRenderQueue::typeRenderRequestVector& sceneRenderRequests = pSceneRenderQueue->getRenderRequests();
+
+    // Iterate render requests.
+    for( SceneRenderQueue::typeRenderRequestVector::iterator renderRequestItr = sceneRenderRequests.begin(); renderRequestItr != sceneRenderRequests.end(); ++renderRequestItr )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_RenderSceneRequests);
+
+        // Fetch render request.
+        SceneRenderRequest* pSceneRenderRequest = *renderRequestItr;
+
+        // Fetch scene render object.
+        SceneRenderObject* pSceneRenderObject = pSceneRenderRequest->mpSceneRenderObject;
+ 
+        // Flush if the object is not render batched and we're in strict order mode.
+        if ( !pSceneRenderObject->isBatchRendered() && mBatchRenderer.getStrictOrderMode() )
+        {
+            mBatchRenderer.flush( pDebugStats->batchNoBatchFlush );
+        }
+        // Flush if the object is batch isolated.
+        else if ( pSceneRenderObject->getBatchIsolated() )
+        {
+            mBatchRenderer.flush( pDebugStats->batchIsolatedFlush );
+        }
+
+        // Yes, so is the object batch rendered?
+        if ( pSceneRenderObject->isBatchRendered() )
+        {
+            // Yes, so set the blend mode.
+            mBatchRenderer.setBlendMode( pSceneRenderRequest );
+
+            // Set the alpha test mode.
+            mBatchRenderer.setAlphaTestMode( pSceneRenderRequest );
+        }
+
+        // Set batch strict order mode.
+        // NOTE:    We keep reasserting this because an object is free to change it during rendering.
+        mBatchRenderer.setStrictOrderMode( pSceneRenderQueue->getStrictOrderMode() );
+
+        // Restore any retained render state if the object renders directly.
+        if ( !pSceneRenderObject->isBatchRendered() )
+            mBatchRenderer.restoreRenderState();
+
+        // Is the object batch isolated?
+        if ( pSceneRenderObject->getBatchIsolated() )
+        {
+            // Yes, so fetch isolated render queue.
+            SceneRenderQueue* pIsolatedRenderQueue = pSceneRenderRequest->mpIsolatedRenderQueue;
+
+            // Sanity!
+            AssertFatal( pIsolatedRenderQueue != NULL, "Cannot render batch isolated with an isolated render queue." );
+
+            // Fetch isolated render requests.
+            SceneRenderQueue::typeRenderRequestVector& isolatedRenderRequests = pIsolatedRenderQueue->getRenderRequests();
+
+            // Can the object render?
+            if ( pSceneRenderObject->validRender() )
+            {
+                // Yes, so iterate isolated render requests.
+                for( SceneRenderQueue::typeRenderRequestVector::iterator isolatedRenderRequestItr = isolatedRenderRequests.begin(); isolatedRenderRequestItr != isolatedRenderRequests.end(); ++isolatedRenderRequestItr )
+                {
+                    pSceneRenderObject->sceneRender( pSceneRenderState, *isolatedRenderRequestItr, &mBatchRenderer );
+                }
+            }
+            else
+            {
+                // No, so iterate isolated render requests.
+                for( SceneRenderQueue::typeRenderRequestVector::iterator isolatedRenderRequestItr = isolatedRenderRequests.begin(); isolatedRenderRequestItr != isolatedRenderRequests.end(); ++isolatedRenderRequestItr )
+                {
+                    pSceneRenderObject->sceneRenderFallback( pSceneRenderState, *isolatedRenderRequestItr, &mBatchRenderer );
+                }
+
+                // Increase render fallbacks.
+                pDebugStats->renderFallbacks++;
+            }
+
+            // Flush isolated batch.
+            mBatchRenderer.flush( pDebugStats->batchIsolatedFlush );
+        }
+        else
+        {
+            // No, so can the object render?
+            if ( pSceneRenderObject->validRender() )
+            {
+                // Yes, so render object.
+                pSceneRenderObject->sceneRender( pSceneRenderState, pSceneRenderRequest, &mBatchRenderer );
+            }
+            else
+            {
+                // No, so render using fallback.
+                pSceneRenderObject->sceneRenderFallback( pSceneRenderState, pSceneRenderRequest, &mBatchRenderer );
+
+                // Increase render fallbacks.
+                pDebugStats->renderFallbacks++;
+            }
+        }
+    }
+
+    // Flush.
+    // NOTE:    We cannot batch between layers as we adhere to a strict layer render order.
+    mBatchRenderer.flush( pDebugStats->batchLayerFlush );
+
+    // Restore any retained render state before the overlays.
+    mBatchRenderer.restoreRenderState();
+
+    // Iterate query results.
+    for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_RenderObjectOverlays);
+
+        // Fetch scene object.
+        SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
+
+        // Render object overlay.
+        pSceneObject->sceneRenderOverlay( pSceneRenderState );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::clearScene( bool deleteObjects )
 {
     while( mSceneObjects.size() > 0 )
@@ -1362,6 +1815,15 @@ void Scene::addToScene( SceneObject* pSceneObject )
     // Register with the scene.
     pSceneObject->OnRegisterScene( this );
 
+    // Update object stats.
+    if ( pSceneObject->isEnabled() )
+        mEnabledSceneObjectCount++;
+    if ( pSceneObject->getVisible() )
+        mVisibleSceneObjectCount++;
+
+    // Update ticking.
+    updateSceneObjectTicking( pSceneObject );
+
     // Perform callback only if properly added to the simulation.
     if ( pSceneObject->isProperlyAdded() )
     {
@@ -1376,6 +1838,101 @@ void Scene::addToScene( SceneObject* pSceneObject )
 
 //-----------------------------------------------------------------------------
 
+void Scene::onSceneObjectEnabledChanged( SceneObject* pSceneObject )
+{
+    // Update object stats.
+    if ( pSceneObject->isEnabled() )
+        mEnabledSceneObjectCount++;
+    else
+        mEnabledSceneObjectCount--;
+
+    // Update ticking.
+    updateSceneObjectTicking( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::onSceneObjectVisibilityChanged( SceneObject* pSceneObject )
+{
+    // Update object stats.
+    if ( pSceneObject->getVisible() )
+        mVisibleSceneObjectCount++;
+    else
+        mVisibleSceneObjectCount--;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::updateSceneObjectTicking( SceneObject* pSceneObject )
+{
+    // Should the object be ticked?
+    // NOTE:-   Objects are ticked if they are enabled, not being deleted and this is a "normal" scene or
+    //          the object is marked as allowing editor ticks.
+    const bool tickable =
+        pSceneObject->getScene() == this &&
+        pSceneObject->isEnabled() &&
+        !pSceneObject->isBeingDeleted() &&
+        ( !getIsEditorScene() || pSceneObject->getIsEditorTickAllowed() );
+
+    // Finish if no change.
+    if ( tickable == (pSceneObject->mTickableIndex != -1) )
+        return;
+
+    // Should the object be ticked?
+    if ( tickable )
+    {
+        // Yes, so add to the tickable objects.
+        pSceneObject->mTickableIndex = mTickableSceneObjects.size();
+        mTickableSceneObjects.push_back( pSceneObject );
+        return;
+    }
+
+    // No, so remove from the tickable objects quickly by moving the last object into its place.
+    const S32 tickableIndex = pSceneObject->mTickableIndex;
+    SceneObject* pLastSceneObject = mTickableSceneObjects.last();
+    mTickableSceneObjects[tickableIndex] = pLastSceneObject;
+    pLastSceneObject->mTickableIndex = tickableIndex;
+    mTickableSceneObjects.pop_back();
+    pSceneObject->mTickableIndex = -1;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setIsEditorScene( const bool status )
+{
+    // Fetch the current editor state.
+    const bool wasEditorScene = getIsEditorScene();
+
+    mIsEditorScene += (status ? 1 : -1);
+
+    // Finish if no change.
+    if ( wasEditorScene == getIsEditorScene() )
+        return;
+
+    // Update ticking for all objects.
+    for ( S32 n = 0; n < mSceneObjects.size(); ++n )
+    {
+        updateSceneObjectTicking( mSceneObjects[n] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setRenderQueryCache( const bool cache )
+{
+    // Finish if no change.
+    if ( mRenderQueryCache == cache )
+        return;
+
+    mRenderQueryCache = cache;
+
+    // Reset the cache so that it stops tracking changes or starts afresh.
+    if ( mpWorldQuery != NULL )
+        mpWorldQuery->resetRenderQueryCache();
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::removeFromScene( SceneObject* pSceneObject )
 {
     if ( pSceneObject == NULL )
@@ -1407,6 +1964,15 @@ void Scene::removeFromScene( SceneObject* pSceneObject )
     // Unregister from scene.
     pSceneObject->OnUnregisterScene( this );
 
+    // Update object stats.
+    if ( pSceneObject->isEnabled() )
+        mEnabledSceneObjectCount--;
+    if ( pSceneObject->getVisible() )
+        mVisibleSceneObjectCount--;
+
+    // Update ticking.
+    updateSceneObjectTicking( pSceneObject );
+
     // Find scene object and remove it quickly.
     for ( S32 n = 0; n < mSceneObjects.size(); ++n )
     {
@@ -3673,6 +4239,9 @@ void Scene::addDeleteRequest( SceneObject* pSceneObject )
 
     // Flag Delete in Progress.
     pSceneObject->mBeingSafeDeleted = true;
+
+    // Stop ticking the object.
+    updateSceneObjectTicking( pSceneObject );
 }
 
 
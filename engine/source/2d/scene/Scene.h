@@ -67,6 +67,18 @@
 #include "2d/scene/SceneRenderObject.h"
 #endif
 
+#ifndef _SCENE_ANIMATION_CLOCK_H_
+#include "2d/scene/SceneAnimationClock.h"
+#endif
+
+#ifndef _SCENE_CONTACT_STREAM_H_
+#include "2d/scene/SceneContactStream.h"
+#endif
+
+#ifndef _SCENE_CONTROLLER_SET_H_
+#include "2d/controllers/core/SceneControllerSet.h"
+#endif
+
 #ifndef _BEHAVIOR_COMPONENT_H_
 #include "component/behaviors/behaviorComponent.h"
 #endif
@@ -163,6 +175,7 @@ class Scene :
     public PhysicsProxy,
     public b2ContactListener,
     public b2DestructionListener,
+    public b2TaskExecutor,
     public virtual Tickable
 {
 public:
@@ -171,6 +184,8 @@ public:
     typedef Vector<tDeleteRequest>              typeDeleteVector;
     typedef Vector<TickContact>                 typeContactVector;
     typedef HashMap<b2Contact*, TickContact>    typeContactHash;
+    typedef Vector<SceneContactEvent>           typeContactEventVector;
+    typedef Vector<SceneContactListener*>       typeContactListenerVector;
     typedef Vector<AssetPtr<AssetBase>*>        typeAssetPtrVector;
 
     /// Scene Debug Options.
@@ -222,7 +237,14 @@ private:
 
     /// Scene occupancy.
     typeSceneObjectVector       mSceneObjects;
+    typeSceneObjectVector       mTickableSceneObjects;
     typeSceneObjectVector       mTickedSceneObjects;
+    U32                         mEnabledSceneObjectCount;
+    U32                         mVisibleSceneObjectCount;
+    typeSceneObjectVector       mParallelSceneObjects;
+
+    /// Animation clock.
+    SceneAnimationClock         mAnimationClock;
 
     /// Joint access.
     typeJointHash               mJoints;
@@ -230,7 +252,7 @@ private:
     S32                         mJointMasterId;
 
     /// Scene controllers.
-    SimObjectPtr<SimSet>	    mControllers;
+    SimObjectPtr<SceneControllerSet> mControllers;
 
     /// Asset pre-loads.
     typeAssetPtrVector          mAssetPreloads;
@@ -247,6 +269,24 @@ private:
     /// Layer sorting and draw order.
     SceneRenderQueue::RenderSort mLayerSortModes[MAX_LAYERS_SUPPORTED];
 
+    /// Parallel render compilation.
+    struct ParallelRenderLayer
+    {
+        ParallelRenderLayer() :
+            mpRenderQueue( NULL ),
+            mRenderRequests( 0 )
+        {
+        }
+
+        SceneRenderQueue*                   mpRenderQueue;
+        U32                                 mRenderRequests;
+        FactoryCache<SceneRenderRequest>    mRenderRequestFactory;
+        FactoryCache<SceneRenderQueue>      mRenderQueueFactory;
+    };
+    ParallelRenderLayer         mParallelRenderLayers[MAX_LAYERS_SUPPORTED];
+    Vector<U32>                 mParallelRenderCompileLayers;
+    const SceneRenderState*     mpParallelRenderState;
+
     /// Batch rendering.
     BatchRender                 mBatchRenderer;
 
@@ -262,17 +302,45 @@ private:
   
     /// Miscellaneous.
     S32                         mIsEditorScene;
+    bool                        mParallelIntegrate;
+    bool                        mParallelRenderCompile;
+    bool                        mParallelSolve;
+    bool                        mParallelCollide;
+    bool                        mRenderQueryCache;
     bool                        mUpdateCallback;
     bool                        mRenderCallback;
+    bool                        mContactStream;
     typeContactHash             mBeginContacts;
     typeContactVector           mEndContacts;
+    typeContactEventVector      mContactEvents;
+    typeContactListenerVector   mContactListeners;
     U32                         mSceneIndex;
 
 private:   
+    /// Integration.
+    void                        integrateSceneObjects( DebugStats* pDebugStats );
+    static void                 integrateSceneObjectsJob( void* pContext, const U32 startIndex, const U32 endIndex );
+
+    /// Rendering.
+    U32                         compileSceneLayer( const SceneRenderState* pSceneRenderState, const U32 layer, SceneRenderQueue* pSceneRenderQueue, FactoryCache<SceneRenderQueue>& isolatedRenderQueueFactory );
+    void                        renderSceneLayer( const SceneRenderState* pSceneRenderState, const U32 layer, SceneRenderQueue* pSceneRenderQueue, DebugStats* pDebugStats );
+    static void                 compileRenderLayersJob( void* pContext, const U32 startIndex, const U32 endIndex );
+
+    /// Physics tasks.
+    struct PhysicsTask
+    {
+        b2TaskFunction          mpTask;
+        void*                   mpContext;
+    };
+    static void                 executePhysicsTaskJob( void* pContext, const U32 startIndex, const U32 endIndex );
+
     /// Contacts.
     void                        forwardContacts( void );
-    void                        dispatchBeginContactCallbacks( void );
-    void                        dispatchEndContactCallbacks( void );
+    void                        buildContactEvents( void );
+    void                        addContactEvent( const TickContact& tickContact, const SceneContactEvent::ContactEventType contactEventType );
+    void                        dispatchContactEvents( void );
+    void                        dispatchBeginContactCallback( const SceneContactEvent& contactEvent );
+    void                        dispatchEndContactCallback( const SceneContactEvent& contactEvent );
 
     /// Joint definition.
     struct CommonJointDefinition
@@ -320,6 +388,19 @@ public:
     const typeContactHash&  getBeginContacts( void ) const              { return mBeginContacts; }
     const typeContactVector& getEndContacts( void ) const               { return mEndContacts; }
 
+    /// Physics task execution.
+    virtual int32           GetThreadCount( void ) const;
+    virtual void            ParallelFor( int32 count, int32 grainSize, b2TaskFunction task, void* pContext );
+
+    /// Contact events.
+    void                    addContactListener( SceneContactListener* pContactListener );
+    void                    removeContactListener( SceneContactListener* pContactListener );
+    inline const typeContactEventVector& getContactEvents( void ) const { return mContactEvents; }
+    inline U32              getContactEventCount( void ) const          { return (U32)mContactEvents.size(); }
+    const SceneContactEvent* getContactEvent( const U32 eventIndex ) const;
+    inline void             setContactStream( const bool contactStream ) { mContactStream = contactStream; }
+    inline bool             getContactStream( void ) const              { return mContactStream; }
+
     /// Integration.
     virtual void            processTick();
     virtual void            interpolateTick( F32 delta );
@@ -354,7 +435,8 @@ public:
 
     void                    mergeScene( const Scene* pScene );
 
-    inline SimSet*			getControllers( void )						{ return mControllers; }
+    inline SceneControllerSet* getControllers( void )                   { return mControllers; }
+    inline SceneAnimationClock& getAnimationClock( void )               { return mAnimationClock; }
 
     inline S32              getAssetPreloadCount( void ) const          { return mAssetPreloads.size(); }
     const AssetPtr<AssetBase>* getAssetPreload( const S32 index ) const;
@@ -644,6 +726,11 @@ public:
     bool                    isSceneWindowAttached( SceneWindow* pSceneWindow2D );
     inline SimSet&          getAttachedSceneWindows( void )             { return mAttachedSceneWindows; }
 
+    /// Scene object state.
+    void                    onSceneObjectEnabledChanged( SceneObject* pSceneObject );
+    void                    onSceneObjectVisibilityChanged( SceneObject* pSceneObject );
+    void                    updateSceneObjectTicking( SceneObject* pSceneObject );
+
     /// Delete requests.
     void                    addDeleteRequest( SceneObject* pSceneObject );
     void                    processDeleteRequests( const bool forceImmediate );
@@ -657,10 +744,22 @@ public:
     /// Miscellaneous.
     inline void             setBatchingEnabled( const bool enabled )    { mBatchRenderer.setBatchEnabled( enabled ); }
     inline bool             getBatchingEnabled( void ) const            { return mBatchRenderer.getBatchEnabled(); }
+    inline void             setBatchingRetained( const bool retained )  { mBatchRenderer.setRetainedMode( retained ); }
+    inline bool             getBatchingRetained( void ) const           { return mBatchRenderer.getRetainedMode(); }
     inline bool             getIsEditorScene( void ) const              { return ((mIsEditorScene > 0) ? true : false); }
-    inline void             setIsEditorScene( bool status )             { mIsEditorScene += (status ? 1 : -1); }
+    void                    setIsEditorScene( const bool status );
     static U32              getGlobalSceneCount( void );
     inline U32              getSceneIndex( void ) const                 { return mSceneIndex; }
+    inline void             setParallelIntegrate( const bool parallel ) { mParallelIntegrate = parallel; }
+    inline bool             getParallelIntegrate( void ) const          { return mParallelIntegrate; }
+    inline void             setParallelRenderCompile( const bool parallel ) { mParallelRenderCompile = parallel; }
+    inline bool             getParallelRenderCompile( void ) const      { return mParallelRenderCompile; }
+    inline void             setParallelSolve( const bool parallel )     { mParallelSolve = parallel; }
+    inline bool             getParallelSolve( void ) const              { return mParallelSolve; }
+    inline void             setParallelCollide( const bool parallel )   { mParallelCollide = parallel; }
+    inline bool             getParallelCollide( void ) const            { return mParallelCollide; }
+    void                    setRenderQueryCache( const bool cache );
+    inline bool             getRenderQueryCache( void ) const           { return mRenderQueryCache; }
     inline void             setUpdateCallback( const bool callback )    { mUpdateCallback = callback; }
     inline bool             getUpdateCallback( void ) const             { return mUpdateCallback; }
     inline void             setRenderCallback( const bool callback )    { mRenderCallback = callback; }
@@ -720,9 +819,17 @@ protected:
         return static_cast<Scene*>(obj)->getLayerSortMode( layer ) != SceneRenderQueue::RENDER_SORT_NEWEST;
     }
 
+    static bool writeParallelIntegrate( void* obj, StringTableEntry pFieldName )    { return static_cast<Scene*>(obj)->getParallelIntegrate(); }
+    static bool writeParallelRenderCompile( void* obj, StringTableEntry pFieldName ) { return static_cast<Scene*>(obj)->getParallelRenderCompile(); }
+    static bool writeParallelSolve( void* obj, StringTableEntry pFieldName )        { return static_cast<Scene*>(obj)->getParallelSolve(); }
+    static bool writeParallelCollide( void* obj, StringTableEntry pFieldName )      { return static_cast<Scene*>(obj)->getParallelCollide(); }
+    static bool setRenderQueryCache( void* obj, const char* data )                  { static_cast<Scene*>(obj)->setRenderQueryCache( dAtob(data) ); return false; }
+    static bool writeRenderQueryCache( void* obj, StringTableEntry pFieldName )     { return static_cast<Scene*>(obj)->getRenderQueryCache(); }
+
     // Callbacks.
     static bool writeUpdateCallback( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getUpdateCallback(); }
     static bool writeRenderCallback( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getRenderCallback(); }
+    static bool writeContactStream( void* obj, StringTableEntry pFieldName )        { return static_cast<Scene*>(obj)->getContactStream(); }
 
 public:
     static SimObjectPtr<Scene> LoadingScene;
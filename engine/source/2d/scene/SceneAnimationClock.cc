@@ -0,0 +1,432 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _SCENE_ANIMATION_CLOCK_H_
+#include "2d/scene/SceneAnimationClock.h"
+#endif
+
+#ifndef _IMAGE_FRAME_PROVIDER_CORE_H
+#include "2d/core/ImageFrameProviderCore.h"
+#endif
+
+#ifndef _DEBUG_STATS_H_
+#include "2d/scene/DebugStats.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+SceneAnimationClock::SceneAnimationClock() :
+    mClockTime( 0.0f ),
+    mProviderCount( 0 )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+SceneAnimationClock::~SceneAnimationClock()
+{
+    // Clear the clock.
+    clear();
+
+    // Delete the free groups.
+    for( typeGroupVector::iterator groupItr = mFreeGroups.begin(); groupItr != mFreeGroups.end(); ++groupItr )
+    {
+        delete *groupItr;
+    }
+    mFreeGroups.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneAnimationClock::integrate( const F32 elapsedTime, DebugStats* pDebugStats )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneAnimationClock_Integrate);
+
+    // Update the clock time.
+    mClockTime += elapsedTime;
+
+    U32 frameChanges = 0;
+
+    // Iterate the groups.
+    // NOTE:-   This is done in reverse as finished groups are removed as we go.
+    for ( S32 groupIndex = mGroups.size()-1; groupIndex >= 0; --groupIndex )
+    {
+        // Fetch the group.
+        SceneAnimationGroup* pGroup = mGroups[groupIndex];
+
+        // Update the current time.
+        pGroup->mCurrentTime += elapsedTime * pGroup->mTimeScale;
+
+        // Check if the animation has finished.
+        bool animationFinished = false;
+        if ( !pGroup->mAnimationCycle && mGreaterThanOrEqual(pGroup->mCurrentTime, pGroup->mTotalIntegrationTime) )
+        {
+            // Animation has finished.
+            animationFinished = true;
+
+            // Fix Animation at end of frames.
+            pGroup->mCurrentTime = pGroup->mTotalIntegrationTime - (pGroup->mFrameIntegrationTime * 0.5f);
+        }
+
+        // Update the current mod time and frame.
+        pGroup->mCurrentModTime = mFmod( pGroup->mCurrentTime, pGroup->mTotalIntegrationTime );
+        const S32 frameIndex = (S32)(pGroup->mCurrentModTime / pGroup->mFrameIntegrationTime);
+
+        // Skip the group if the frame has not changed.
+        if ( frameIndex == pGroup->mCurrentFrameIndex && !animationFinished )
+            continue;
+
+        pGroup->mCurrentFrameIndex = frameIndex;
+
+        // Fetch the group providers.
+        SceneAnimationGroup::typeProviderVector& providers = pGroup->mProviders;
+        const U32 providerCount = providers.size();
+
+        // Update the providers.
+        for ( U32 index = 0; index < providerCount; ++index )
+        {
+            ImageFrameProviderCore* pProvider = providers[index];
+            pProvider->mCurrentTime = pGroup->mCurrentTime;
+            pProvider->mCurrentModTime = pGroup->mCurrentModTime;
+            pProvider->mCurrentFrameIndex = frameIndex;
+            pProvider->mLastFrameIndex = frameIndex;
+        }
+        frameChanges += providerCount;
+
+        // Finish if the animation has NOT finished.
+        if ( !animationFinished )
+            continue;
+
+        // Finish the providers.
+        // NOTE:-   The animation end is notified once all the groups are integrated as it can change the groups.
+        for ( U32 index = 0; index < providerCount; ++index )
+        {
+            ImageFrameProviderCore* pProvider = providers[index];
+            pProvider->mAnimationFinished = true;
+            pProvider->mpAnimationGroup = NULL;
+            mFinishedProviders.push_back( pProvider );
+        }
+        mProviderCount -= providerCount;
+        providers.clear();
+
+        // Destroy the group.
+        destroyGroup( pGroup );
+    }
+
+    // Notify the finished providers.
+    // NOTE:-   Providers detached during a notification are removed from the finished providers.
+    for ( S32 index = 0; index < mFinishedProviders.size(); ++index )
+    {
+        // Fetch the provider.
+        ImageFrameProviderCore* pProvider = mFinishedProviders[index];
+
+        // Skip if detached.
+        if ( pProvider == NULL )
+            continue;
+
+        mFinishedProviders[index] = NULL;
+
+        // Turn-off tick processing.
+        pProvider->setProcessTicks( false );
+
+        // Perform callback.
+        pProvider->onAnimationEnd();
+    }
+    mFinishedProviders.clear();
+
+    // Update the debug stats.
+    if ( pDebugStats != NULL )
+    {
+        pDebugStats->animationGroups = mGroups.size();
+        pDebugStats->animationProviders = mProviderCount;
+        pDebugStats->animationFrameChanges = frameChanges;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneAnimationClock::canAddProvider( const ImageFrameProviderCore* pProvider )
+{
+    // Only providers actively playing a valid animation forwards can be grouped.
+    return
+        !pProvider->mSelfTick &&
+        !pProvider->mStaticProvider &&
+        !pProvider->mAnimationFinished &&
+        !pProvider->mAnimationPaused &&
+        pProvider->mAnimationTimeScale > 0.0f &&
+        pProvider->mTotalIntegrationTime > 0.0f &&
+        pProvider->mFrameIntegrationTime > 0.0f &&
+        pProvider->mpAnimationAsset != NULL &&
+        pProvider->mpAnimationAsset->notNull();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneAnimationClock::addProvider( ImageFrameProviderCore* pProvider )
+{
+    // Sanity!
+    AssertFatal( pProvider != NULL, "SceneAnimationClock::addProvider() - Cannot add a NULL provider." );
+    AssertFatal( pProvider->mpAnimationGroup == NULL, "SceneAnimationClock::addProvider() - Provider is already grouped." );
+    AssertFatal( canAddProvider( pProvider ), "SceneAnimationClock::addProvider() - Provider cannot be grouped." );
+
+    // Calculate the clock time the animation would have started at.
+    const F32 startTime = mClockTime - (pProvider->mCurrentTime / pProvider->mAnimationTimeScale);
+
+    // Find the group or create one.
+    const U32 hash = calculateHash( pProvider, startTime );
+    SceneAnimationGroup* pGroup = findGroup( pProvider, startTime, hash );
+    if ( pGroup == NULL )
+        pGroup = createGroup( pProvider, startTime, hash );
+
+    // Add to the group.
+    pProvider->mpAnimationGroup = pGroup;
+    pProvider->mAnimationGroupIndex = pGroup->mProviders.size();
+    pGroup->mProviders.push_back( pProvider );
+    mProviderCount++;
+
+    // Use the group animation state.
+    pProvider->mCurrentTime = pGroup->mCurrentTime;
+    pProvider->mCurrentModTime = pGroup->mCurrentModTime;
+    pProvider->mCurrentFrameIndex = pGroup->mCurrentFrameIndex;
+    pProvider->mLastFrameIndex = pGroup->mCurrentFrameIndex;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneAnimationClock::removeProvider( ImageFrameProviderCore* pProvider, const bool syncTime )
+{
+    // Sanity!
+    AssertFatal( pProvider != NULL, "SceneAnimationClock::removeProvider() - Cannot remove a NULL provider." );
+
+    // Fetch the group.
+    SceneAnimationGroup* pGroup = pProvider->mpAnimationGroup;
+
+    // Finish if not grouped.
+    if ( pGroup == NULL )
+        return;
+
+    // Sanity!
+    AssertFatal( pGroup->mProviders[pProvider->mAnimationGroupIndex] == pProvider, "SceneAnimationClock::removeProvider() - Provider group index is invalid." );
+
+    // Take the group animation time if requested.
+    if ( syncTime )
+    {
+        pProvider->mCurrentTime = pGroup->mCurrentTime;
+        pProvider->mCurrentModTime = pGroup->mCurrentModTime;
+    }
+
+    // Remove from the group.
+    SceneAnimationGroup::typeProviderVector& providers = pGroup->mProviders;
+    const U32 groupIndex = pProvider->mAnimationGroupIndex;
+    providers.erase_fast( groupIndex );
+    if ( groupIndex < (U32)providers.size() )
+        providers[groupIndex]->mAnimationGroupIndex = groupIndex;
+
+    pProvider->mpAnimationGroup = NULL;
+    mProviderCount--;
+
+    // Destroy the group if it's empty.
+    if ( providers.size() == 0 )
+        destroyGroup( pGroup );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneAnimationClock::detachProvider( ImageFrameProviderCore* pProvider )
+{
+    // Remove from any group.
+    removeProvider( pProvider, true );
+
+    // Remove from the finished providers.
+    for ( S32 index = 0; index < mFinishedProviders.size(); ++index )
+    {
+        if ( mFinishedProviders[index] == pProvider )
+            mFinishedProviders[index] = NULL;
+    }
+
+    // Reset the clock.
+    pProvider->mpAnimationClock = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneAnimationClock::clear( void )
+{
+    // Detach all the providers.
+    // NOTE:-   Owners normally detach their providers before the clock is cleared.
+    while( mGroups.size() > 0 )
+    {
+        SceneAnimationGroup* pGroup = mGroups.last();
+        detachProvider( pGroup->mProviders.last() );
+    }
+
+    // Detach all the finished providers.
+    for ( S32 index = 0; index < mFinishedProviders.size(); ++index )
+    {
+        if ( mFinishedProviders[index] != NULL )
+            mFinishedProviders[index]->mpAnimationClock = NULL;
+    }
+    mFinishedProviders.clear();
+
+    mClockTime = 0.0f;
+}
+
+//-----------------------------------------------------------------------------
+
+SceneAnimationGroup* SceneAnimationClock::findGroup( const ImageFrameProviderCore* pProvider, const F32 startTime, const U32 hash ) const
+{
+    // Find the hash chain.
+    typeGroupHash::const_iterator groupItr = mGroupHash.find( hash );
+    if ( groupItr == mGroupHash.end() )
+        return NULL;
+
+    // Fetch the animation asset.
+    const AnimationAsset* pAnimationAsset = *pProvider->mpAnimationAsset;
+
+    // Search the hash chain for the group.
+    for ( SceneAnimationGroup* pGroup = groupItr->value; pGroup != NULL; pGroup = pGroup->mpNextHashGroup )
+    {
+        if ( pGroup->mpAnimationAsset == pAnimationAsset &&
+            pGroup->mTimeScale == pProvider->mAnimationTimeScale &&
+            pGroup->mStartTime == startTime &&
+            pGroup->mTotalIntegrationTime == pProvider->mTotalIntegrationTime &&
+            pGroup->mFrameIntegrationTime == pProvider->mFrameIntegrationTime &&
+            pGroup->mAnimationCycle == pAnimationAsset->getAnimationCycle() )
+            return pGroup;
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+SceneAnimationGroup* SceneAnimationClock::createGroup( const ImageFrameProviderCore* pProvider, const F32 startTime, const U32 hash )
+{
+    // Fetch a free group or allocate one.
+    SceneAnimationGroup* pGroup;
+    if ( mFreeGroups.size() > 0 )
+    {
+        pGroup = mFreeGroups.last();
+        mFreeGroups.pop_back();
+    }
+    else
+    {
+        pGroup = new SceneAnimationGroup();
+    }
+
+    // Fetch the animation asset.
+    const AnimationAsset* pAnimationAsset = *pProvider->mpAnimationAsset;
+
+    // Set the group key.
+    pGroup->mpAnimationAsset = pAnimationAsset;
+    pGroup->mTimeScale = pProvider->mAnimationTimeScale;
+    pGroup->mStartTime = startTime;
+    pGroup->mTotalIntegrationTime = pProvider->mTotalIntegrationTime;
+    pGroup->mFrameIntegrationTime = pProvider->mFrameIntegrationTime;
+    pGroup->mAnimationCycle = pAnimationAsset->getAnimationCycle();
+    pGroup->mHash = hash;
+
+    // Set the animation state from the provider.
+    pGroup->mCurrentTime = pProvider->mCurrentTime;
+    pGroup->mCurrentModTime = pProvider->mCurrentModTime;
+    pGroup->mCurrentFrameIndex = pProvider->mCurrentFrameIndex;
+
+    // Add to the groups.
+    pGroup->mGroupIndex = mGroups.size();
+    mGroups.push_back( pGroup );
+
+    // Add to the hash chain.
+    typeGroupHash::iterator groupItr = mGroupHash.find( hash );
+    if ( groupItr == mGroupHash.end() )
+    {
+        pGroup->mpNextHashGroup = NULL;
+        mGroupHash.insert( hash, pGroup );
+    }
+    else
+    {
+        pGroup->mpNextHashGroup = groupItr->value;
+        groupItr->value = pGroup;
+    }
+
+    return pGroup;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneAnimationClock::destroyGroup( SceneAnimationGroup* pGroup )
+{
+    // Sanity!
+    AssertFatal( pGroup->mProviders.size() == 0, "SceneAnimationClock::destroyGroup() - Cannot destroy a group with providers." );
+
+    // Remove from the hash chain.
+    typeGroupHash::iterator groupItr = mGroupHash.find( pGroup->mHash );
+    AssertFatal( groupItr != mGroupHash.end(), "SceneAnimationClock::destroyGroup() - Group hash chain is missing." );
+    if ( groupItr->value == pGroup )
+    {
+        if ( pGroup->mpNextHashGroup == NULL )
+            mGroupHash.erase( groupItr );
+        else
+            groupItr->value = pGroup->mpNextHashGroup;
+    }
+    else
+    {
+        SceneAnimationGroup* pPreviousGroup = groupItr->value;
+        while( pPreviousGroup->mpNextHashGroup != pGroup )
+            pPreviousGroup = pPreviousGroup->mpNextHashGroup;
+
+        pPreviousGroup->mpNextHashGroup = pGroup->mpNextHashGroup;
+    }
+
+    // Remove from the groups.
+    const U32 groupIndex = pGroup->mGroupIndex;
+    mGroups.erase_fast( groupIndex );
+    if ( groupIndex < (U32)mGroups.size() )
+        mGroups[groupIndex]->mGroupIndex = groupIndex;
+
+    // Add as a free group.
+    pGroup->mpNextHashGroup = NULL;
+    pGroup->mpAnimationAsset = NULL;
+    mFreeGroups.push_back( pGroup );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 SceneAnimationClock::calculateHash( const ImageFrameProviderCore* pProvider, const F32 startTime )
+{
+    // Fetch the key bits.
+    U32 timeScaleBits;
+    U32 startTimeBits;
+    dMemcpy( &timeScaleBits, &pProvider->mAnimationTimeScale, sizeof(U32) );
+    dMemcpy( &startTimeBits, &startTime, sizeof(U32) );
+
+    // Combine the key.
+    U32 hash = Hash::hash( (const void*)(const AnimationAsset*)*pProvider->mpAnimationAsset );
+    hash = hash * 31 + timeScaleBits;
+    hash = hash * 31 + startTimeBits;
+
+    return hash;
+}
@@ -0,0 +1,114 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _SCENE_ANIMATION_CLOCK_H_
+#define _SCENE_ANIMATION_CLOCK_H_
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+///-----------------------------------------------------------------------------
+
+class AnimationAsset;
+class ImageFrameProviderCore;
+class DebugStats;
+
+///-----------------------------------------------------------------------------
+
+/// A group of frame providers playing the same animation in lock-step.
+struct SceneAnimationGroup
+{
+    typedef Vector<ImageFrameProviderCore*> typeProviderVector;
+
+    /// Group key.
+    const AnimationAsset*   mpAnimationAsset;
+    F32                     mTimeScale;
+    F32                     mStartTime;
+    F32                     mTotalIntegrationTime;
+    F32                     mFrameIntegrationTime;
+    bool                    mAnimationCycle;
+    U32                     mHash;
+
+    /// Shared animation state.
+    F32                     mCurrentTime;
+    F32                     mCurrentModTime;
+    S32                     mCurrentFrameIndex;
+
+    /// Group members.
+    typeProviderVector      mProviders;
+    U32                     mGroupIndex;
+    SceneAnimationGroup*    mpNextHashGroup;
+};
+
+///-----------------------------------------------------------------------------
+
+/// Advances animated frame providers in bulk.
+/// Providers playing the same animation asset with the same time scale and start time are grouped so that
+/// the animation time is integrated once per group and only the providers of groups whose frame actually
+/// changed are touched.
+class SceneAnimationClock
+{
+private:
+    typedef Vector<SceneAnimationGroup*> typeGroupVector;
+    typedef HashMap<U32, SceneAnimationGroup*> typeGroupHash;
+    typedef Vector<ImageFrameProviderCore*> typeProviderVector;
+
+    F32                     mClockTime;
+    typeGroupVector         mGroups;
+    typeGroupHash           mGroupHash;
+    typeGroupVector         mFreeGroups;
+    typeProviderVector      mFinishedProviders;
+    U32                     mProviderCount;
+
+public:
+    SceneAnimationClock();
+    ~SceneAnimationClock();
+
+    /// Integration.
+    void                    integrate( const F32 elapsedTime, DebugStats* pDebugStats );
+
+    /// Providers.
+    static bool             canAddProvider( const ImageFrameProviderCore* pProvider );
+    void                    addProvider( ImageFrameProviderCore* pProvider );
+    void                    removeProvider( ImageFrameProviderCore* pProvider, const bool syncTime );
+    void                    detachProvider( ImageFrameProviderCore* pProvider );
+    void                    clear( void );
+
+    /// Metrics.
+    inline U32              getGroupCount( void ) const                 { return (U32)mGroups.size(); }
+    inline U32              getProviderCount( void ) const              { return mProviderCount; }
+    inline F32              getClockTime( void ) const                  { return mClockTime; }
+
+private:
+    SceneAnimationGroup*    findGroup( const ImageFrameProviderCore* pProvider, const F32 startTime, const U32 hash ) const;
+    SceneAnimationGroup*    createGroup( const ImageFrameProviderCore* pProvider, const F32 startTime, const U32 hash );
+    void                    destroyGroup( SceneAnimationGroup* pGroup );
+    static U32              calculateHash( const ImageFrameProviderCore* pProvider, const F32 startTime );
+};
+
+#endif // _SCENE_ANIMATION_CLOCK_H_
@@ -0,0 +1,78 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _SCENE_CONTACT_STREAM_H_
+#define _SCENE_CONTACT_STREAM_H_
+
+#ifndef BOX2D_H
+#include "Box2D/Box2D.h"
+#endif
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+///-----------------------------------------------------------------------------
+
+class Scene;
+class SceneObject;
+
+///-----------------------------------------------------------------------------
+
+/// A contact that began or ended during a scene tick.
+/// NOTE:-  The normal points from object A to object B.
+struct SceneContactEvent
+{
+    enum ContactEventType
+    {
+        CONTACT_EVENT_BEGIN,
+        CONTACT_EVENT_END,
+    };
+
+    ContactEventType    mType;
+    SceneObject*        mpSceneObjectA;
+    SceneObject*        mpSceneObjectB;
+    SimObjectId         mSceneObjectIdA;
+    SimObjectId         mSceneObjectIdB;
+    S32                 mShapeIndexA;
+    S32                 mShapeIndexB;
+    U32                 mPointCount;
+    b2Vec2              mNormal;
+    b2Vec2              mPoints[b2_maxManifoldPoints];
+    F32                 mNormalImpulses[b2_maxManifoldPoints];
+    F32                 mTangentImpulses[b2_maxManifoldPoints];
+};
+
+///-----------------------------------------------------------------------------
+
+/// Receives all the contact events of a scene tick at once.
+/// The end events always precede the begin events and the events remain valid until the next scene tick.
+class SceneContactListener
+{
+public:
+    virtual ~SceneContactListener() {}
+
+    virtual void onSceneContacts( Scene* pScene, const SceneContactEvent* pContactEvents, const U32 contactEventCount ) = 0;
+};
+
+#endif // _SCENE_CONTACT_STREAM_H_
@@ -59,6 +59,7 @@ private:
     typeRenderRequestVector mRenderRequests;
     RenderSort              mSortMode;
     bool                    mStrictOrderMode;
+    FactoryCache<SceneRenderRequest>* mpRenderRequestFactory;
 
 private:
     static S32 QSORT_CALLBACK layeredNewFrontSort(const void* a, const void* b);
@@ -73,7 +74,8 @@ private:
     static S32 QSORT_CALLBACK layeredInverseYSortPointSort(const void* a, const void* b);
 
 public:
-    SceneRenderQueue()
+    SceneRenderQueue() :
+        mpRenderRequestFactory( &SceneRenderRequestFactory )
     {
         resetState();
     }
@@ -90,10 +92,13 @@ public:
         // Cache request.
         for( typeRenderRequestVector::iterator itr = mRenderRequests.begin(); itr != mRenderRequests.end(); ++itr )
         {
-            SceneRenderRequestFactory.cacheObject( *itr );
+            mpRenderRequestFactory->cacheObject( *itr );
         }
         mRenderRequests.clear();
 
+        // Reset render request factory.
+        mpRenderRequestFactory = &SceneRenderRequestFactory;
+
         // Reset sort mode.
         mSortMode = RENDER_SORT_NEWEST;
 
@@ -107,7 +112,7 @@ public:
         PROFILE_SCOPE(SceneRenderQueue_CreateRenderRequest);
 
         // Create scene render request.
-        SceneRenderRequest* pSceneRenderRequest = SceneRenderRequestFactory.createObject();
+        SceneRenderRequest* pSceneRenderRequest = mpRenderRequestFactory->createObject();
 
         // Queue render request.
         mRenderRequests.push_back( pSceneRenderRequest );
@@ -117,6 +122,10 @@ public:
 
     inline typeRenderRequestVector& getRenderRequests( void ) { return mRenderRequests; }
 
+    // NOTE:    The render request factory reverts to the shared factory when the queue is reset.
+    inline void setRenderRequestFactory( FactoryCache<SceneRenderRequest>* pRenderRequestFactory ) { AssertFatal( pRenderRequestFactory != NULL, "Render request factory cannot be NULL." ); mpRenderRequestFactory = pRenderRequestFactory; }
+    inline FactoryCache<SceneRenderRequest>* getRenderRequestFactory( void ) const { return mpRenderRequestFactory; }
+
     inline void setSortMode( RenderSort sortMode ) { mSortMode = sortMode; }
     inline RenderSort getSortMode( void ) const { return mSortMode; }
 
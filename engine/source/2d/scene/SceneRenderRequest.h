@@ -53,7 +53,7 @@ public:
         resetState();
     }
 
-    ~SceneRenderRequest() {}
+    virtual ~SceneRenderRequest() {}
 
     /// Sets mandatory configuration.
     inline SceneRenderRequest* set(
@@ -3568,6 +3568,375 @@ ConsoleMethodWithDocs(Scene, getBatchingEnabled, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether render batches are streamed through retained buffer objects or not.
+    Retained batching is ignored if the platform does not support buffer objects.
+    @param retained Whether render batches are streamed through retained buffer objects or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setBatchingRetained, ConsoleVoid, 3, 3, ( bool retained ))
+{
+    // Fetch args.
+    const bool retained = dAtob(argv[2]);
+
+    // Sets batching retained.
+    object->setBatchingRetained( retained );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether render batches are streamed through retained buffer objects or not.
+    @return Whether render batches are streamed through retained buffer objects or not.
+*/
+ConsoleMethodWithDocs(Scene, getBatchingRetained, ConsoleBool, 2, 2, ())
+{
+    // Gets batching retained.
+    return object->getBatchingRetained();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether objects that are safe to do so are integrated across multiple threads or not.
+    Any callbacks or delete requests caused by the integration still happen on the main thread in tick order.
+    @param parallel Whether to integrate objects across multiple threads or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setParallelIntegrate, ConsoleVoid, 3, 3, ( bool parallel ))
+{
+    // Fetch args.
+    const bool parallel = dAtob(argv[2]);
+
+    // Sets parallel integration.
+    object->setParallelIntegrate( parallel );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether objects that are safe to do so are integrated across multiple threads or not.
+    @return Whether objects are integrated across multiple threads or not.
+*/
+ConsoleMethodWithDocs(Scene, getParallelIntegrate, ConsoleBool, 2, 2, ())
+{
+    // Gets parallel integration.
+    return object->getParallelIntegrate();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the render requests for each layer are compiled across multiple threads or not.
+    The compiled layers are still submitted for rendering on the main thread in layer order.
+    @param parallel Whether to compile the render requests across multiple threads or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setParallelRenderCompile, ConsoleVoid, 3, 3, ( bool parallel ))
+{
+    // Fetch args.
+    const bool parallel = dAtob(argv[2]);
+
+    // Sets parallel render compilation.
+    object->setParallelRenderCompile( parallel );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the render requests for each layer are compiled across multiple threads or not.
+    @return Whether the render requests are compiled across multiple threads or not.
+*/
+ConsoleMethodWithDocs(Scene, getParallelRenderCompile, ConsoleBool, 2, 2, ())
+{
+    // Gets parallel render compilation.
+    return object->getParallelRenderCompile();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the physics islands are solved across multiple threads or not.
+    Each island is solved exactly as it would be on a single thread so the simulation results are unchanged.
+    @param parallel Whether to solve the physics islands across multiple threads or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setParallelSolve, ConsoleVoid, 3, 3, ( bool parallel ))
+{
+    // Fetch args.
+    const bool parallel = dAtob(argv[2]);
+
+    // Sets parallel solve.
+    object->setParallelSolve( parallel );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the physics islands are solved across multiple threads or not.
+    @return Whether the physics islands are solved across multiple threads or not.
+*/
+ConsoleMethodWithDocs(Scene, getParallelSolve, ConsoleBool, 2, 2, ())
+{
+    // Gets parallel solve.
+    return object->getParallelSolve();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the physics contacts are updated across multiple threads or not.
+    The contact callbacks still happen on the main thread in the same order as a single-threaded update.
+    @param parallel Whether to update the physics contacts across multiple threads or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setParallelCollide, ConsoleVoid, 3, 3, ( bool parallel ))
+{
+    // Fetch args.
+    const bool parallel = dAtob(argv[2]);
+
+    // Sets parallel collide.
+    object->setParallelCollide( parallel );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the physics contacts are updated across multiple threads or not.
+    @return Whether the physics contacts are updated across multiple threads or not.
+*/
+ConsoleMethodWithDocs(Scene, getParallelCollide, ConsoleBool, 2, 2, ())
+{
+    // Gets parallel collide.
+    return object->getParallelCollide();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the visible objects are cached between frames or not.
+    When cached, only the objects that have moved and the area the camera has moved into are queried each frame.
+    Each scene window rendering the scene keeps its own cache (up to four) matched by its camera area.
+    @param cache Whether to cache the visible objects between frames or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setRenderQueryCache, ConsoleVoid, 3, 3, ( bool cache ))
+{
+    // Fetch args.
+    const bool cache = dAtob(argv[2]);
+
+    // Sets render query cache.
+    object->setRenderQueryCache( cache );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the visible objects are cached between frames or not.
+    @return Whether the visible objects are cached between frames or not.
+*/
+ConsoleMethodWithDocs(Scene, getRenderQueryCache, ConsoleBool, 2, 2, ())
+{
+    // Gets render query cache.
+    return object->getRenderQueryCache();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the contacts are delivered with a single 'onSceneContacts' callback each tick instead of a collision callback per contact.
+    The callback receives the contact event count and the contact events are read with the 'getContactEvent*' methods.
+    The 'onSceneCollision', 'onSceneEndCollision', 'onCollision' and 'onEndCollision' callbacks are not performed whilst streaming.
+    @param contactStream Whether to stream the contacts or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setContactStream, ConsoleVoid, 3, 3, ( bool contactStream ))
+{
+    // Fetch args.
+    const bool contactStream = dAtob(argv[2]);
+
+    // Sets contact stream.
+    object->setContactStream( contactStream );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the contacts are delivered with a single 'onSceneContacts' callback each tick or not.
+    @return Whether the contacts are streamed or not.
+*/
+ConsoleMethodWithDocs(Scene, getContactStream, ConsoleBool, 2, 2, ())
+{
+    // Gets contact stream.
+    return object->getContactStream();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of contact events for the last scene tick.
+    The end contact events always precede the begin contact events.
+    @return The number of contact events.
+*/
+ConsoleMethodWithDocs(Scene, getContactEventCount, ConsoleInt, 2, 2, ())
+{
+    return object->getContactEventCount();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the contact event is a contact beginning or ending.
+    @param eventIndex The contact event index.
+    @return "begin", "end" or nothing if the contact event index is invalid.
+*/
+ConsoleMethodWithDocs(Scene, getContactEventType, ConsoleString, 3, 3, ( eventIndex ))
+{
+    // Fetch contact event.
+    const SceneContactEvent* pContactEvent = object->getContactEvent( dAtoi(argv[2]) );
+
+    if ( pContactEvent == NULL )
+        return StringTable->EmptyString;
+
+    return pContactEvent->mType == SceneContactEvent::CONTACT_EVENT_BEGIN ? "begin" : "end";
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the first scene object of the contact event.
+    @param eventIndex The contact event index.
+    @return The scene object Id or zero if the contact event index is invalid.
+*/
+ConsoleMethodWithDocs(Scene, getContactEventObjectA, ConsoleInt, 3, 3, ( eventIndex ))
+{
+    // Fetch contact event.
+    const SceneContactEvent* pContactEvent = object->getContactEvent( dAtoi(argv[2]) );
+
+    return pContactEvent == NULL ? 0 : pContactEvent->mSceneObjectIdA;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the second scene object of the contact event.
+    @param eventIndex The contact event index.
+    @return The scene object Id or zero if the contact event index is invalid.
+*/
+ConsoleMethodWithDocs(Scene, getContactEventObjectB, ConsoleInt, 3, 3, ( eventIndex ))
+{
+    // Fetch contact event.
+    const SceneContactEvent* pContactEvent = object->getContactEvent( dAtoi(argv[2]) );
+
+    return pContactEvent == NULL ? 0 : pContactEvent->mSceneObjectIdB;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the collision shape index on the first scene object of the contact event.
+    @param eventIndex The contact event index.
+    @return The collision shape index or -1 if the contact event index is invalid.
+*/
+ConsoleMethodWithDocs(Scene, getContactEventShapeA, ConsoleInt, 3, 3, ( eventIndex ))
+{
+    // Fetch contact event.
+    const SceneContactEvent* pContactEvent = object->getContactEvent( dAtoi(argv[2]) );
+
+    return pContactEvent == NULL ? -1 : pContactEvent->mShapeIndexA;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the collision shape index on the second scene object of the contact event.
+    @param eventIndex The contact event index.
+    @return The collision shape index or -1 if the contact event index is invalid.
+*/
+ConsoleMethodWithDocs(Scene, getContactEventShapeB, ConsoleInt, 3, 3, ( eventIndex ))
+{
+    // Fetch contact event.
+    const SceneContactEvent* pContactEvent = object->getContactEvent( dAtoi(argv[2]) );
+
+    return pContactEvent == NULL ? -1 : pContactEvent->mShapeIndexB;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the contact normal of the contact event pointing from the first to the second scene object.
+    @param eventIndex The contact event index.
+    @return The contact normal formatted as "x y" or nothing if the contact event index is invalid.
+*/
+ConsoleMethodWithDocs(Scene, getContactEventNormal, ConsoleString, 3, 3, ( eventIndex ))
+{
+    // Fetch contact event.
+    const SceneContactEvent* pContactEvent = object->getContactEvent( dAtoi(argv[2]) );
+
+    if ( pContactEvent == NULL )
+        return StringTable->EmptyString;
+
+    return Vector2(pContactEvent->mNormal).scriptThis();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of contact points of the contact event.
+    @param eventIndex The contact event index.
+    @return The number of contact points (0, 1 or 2).
+*/
+ConsoleMethodWithDocs(Scene, getContactEventPointCount, ConsoleInt, 3, 3, ( eventIndex ))
+{
+    // Fetch contact event.
+    const SceneContactEvent* pContactEvent = object->getContactEvent( dAtoi(argv[2]) );
+
+    return pContactEvent == NULL ? 0 : pContactEvent->mPointCount;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets a contact point of the contact event.
+    @param eventIndex The contact event index.
+    @param pointIndex The contact point index.
+    @return The contact point formatted as "x y" or nothing if either index is invalid.
+*/
+ConsoleMethodWithDocs(Scene, getContactEventPoint, ConsoleString, 4, 4, ( eventIndex, pointIndex ))
+{
+    // Fetch contact event.
+    const SceneContactEvent* pContactEvent = object->getContactEvent( dAtoi(argv[2]) );
+
+    // Fetch point index.
+    const U32 pointIndex = dAtoi(argv[3]);
+
+    if ( pContactEvent == NULL || pointIndex >= pContactEvent->mPointCount )
+        return StringTable->EmptyString;
+
+    return Vector2(pContactEvent->mPoints[pointIndex]).scriptThis();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the normal impulse at a contact point of the contact event.
+    @param eventIndex The contact event index.
+    @param pointIndex The contact point index.
+    @return The normal impulse or zero if either index is invalid.
+*/
+ConsoleMethodWithDocs(Scene, getContactEventNormalImpulse, ConsoleFloat, 4, 4, ( eventIndex, pointIndex ))
+{
+    // Fetch contact event.
+    const SceneContactEvent* pContactEvent = object->getContactEvent( dAtoi(argv[2]) );
+
+    // Fetch point index.
+    const U32 pointIndex = dAtoi(argv[3]);
+
+    if ( pContactEvent == NULL || pointIndex >= pContactEvent->mPointCount )
+        return 0.0f;
+
+    return pContactEvent->mNormalImpulses[pointIndex];
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the tangent impulse at a contact point of the contact event.
+    @param eventIndex The contact event index.
+    @param pointIndex The contact point index.
+    @return The tangent impulse or zero if either index is invalid.
+*/
+ConsoleMethodWithDocs(Scene, getContactEventTangentImpulse, ConsoleFloat, 4, 4, ( eventIndex, pointIndex ))
+{
+    // Fetch contact event.
+    const SceneContactEvent* pContactEvent = object->getContactEvent( dAtoi(argv[2]) );
+
+    // Fetch point index.
+    const U32 pointIndex = dAtoi(argv[3]);
+
+    if ( pContactEvent == NULL || pointIndex >= pContactEvent->mPointCount )
+        return 0.0f;
+
+    return pContactEvent->mTangentImpulses[pointIndex];
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether this is an editor scene.
     @return No return value.
 */
@@ -3589,4 +3958,327 @@ ConsoleMethodWithDocs(Scene, create, ConsoleString, 3, 3, (type))
     return pSceneObject == NULL ? NULL : pSceneObject->getIdString();
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Loads a scene from a Taml file and renders it for the specified number of frames, reporting the render cost.
+    The null GL dispatch is used for the duration of the benchmark (where supported) so no GL context is required.
+    Only the scene render is timed; the scene tick between frames is timed separately.
+    @param sceneFile The Taml file containing the scene to render.
+    @param frameCount The number of frames to render.  Optional: Defaults to 300.
+    @param renderArea The scene area to render formatted as "x1 y1 x2 y2".  Optional: Defaults to "-50 -37.5 50 37.5".
+    @return The average render time per frame in milliseconds or -1 if the scene could not be loaded.
+*/
+ConsoleFunctionWithDocs( benchmarkSceneRender, ConsoleFloat, 2, 4, (sceneFile, [frameCount]?, [renderArea]?))
+{
+    // Fetch the scene file.
+    const char* pSceneFile = argv[1];
+
+    // Fetch the frame count.
+    const U32 frameCount = argc > 2 ? getMax( dAtoi(argv[2]), 1 ) : 300;
+
+    // Fetch the render area.
+    RectF renderArea( -50.0f, -37.5f, 100.0f, 75.0f );
+    if ( argc > 3 )
+    {
+        if ( Utility::mGetStringElementCount(argv[3]) != 4 )
+        {
+            Con::warnf( "benchmarkSceneRender() - Invalid render area '%s'.", argv[3] );
+            return -1.0f;
+        }
+
+        const Vector2 lower = Utility::mGetStringElementVector( argv[3], 0 );
+        const Vector2 upper = Utility::mGetStringElementVector( argv[3], 2 );
+        renderArea = RectF( lower.x, lower.y, upper.x - lower.x, upper.y - lower.y );
+    }
+
+    // Read the scene.
+    Taml taml;
+    SimObject* pSimObject = taml.read( pSceneFile );
+    Scene* pScene = dynamic_cast<Scene*>( pSimObject );
+
+    if ( pScene == NULL )
+    {
+        Con::warnf( "benchmarkSceneRender() - Could not read a scene from file '%s'.", pSceneFile );
+
+        if ( pSimObject != NULL )
+            pSimObject->deleteObject();
+
+        return -1.0f;
+    }
+
+    // Use the null GL dispatch if it is not already active.
+    const bool nullDispatch = !GLNull::isEnabled() && GLNull::enable();
+
+    // Create the scene render state.
+    DebugStats& debugStats = pScene->getDebugStats();
+    SceneRenderState sceneRenderState(
+        renderArea,
+        renderArea.centre(),
+        0.0f,
+        MASK_ALL,
+        MASK_ALL,
+        Vector2::getOne(),
+        &debugStats,
+        pScene );
+
+    U32 drawCalls = 0;
+    U32 renderRequests = 0;
+    F32 tickTime = 0.0f;
+    F32 renderTime = 0.0f;
+    F32 minimumRenderTime = F32_MAX;
+    F32 maximumRenderTime = 0.0f;
+
+    GLNull::resetMetrics();
+
+    for ( U32 frame = 0; frame < frameCount; ++frame )
+    {
+        // Advance the scene.
+        b2Timer tickTimer;
+        pScene->processTick();
+        pScene->interpolateTick( 0.0f );
+        tickTime += tickTimer.GetMilliseconds();
+
+        // Render the scene.
+        b2Timer renderTimer;
+        pScene->sceneRender( &sceneRenderState );
+        const F32 frameRenderTime = renderTimer.GetMilliseconds();
+
+        renderTime += frameRenderTime;
+        minimumRenderTime = getMin( minimumRenderTime, frameRenderTime );
+        maximumRenderTime = getMax( maximumRenderTime, frameRenderTime );
+
+        drawCalls += debugStats.batchDrawCallsStrict + debugStats.batchDrawCallsSorted;
+        renderRequests += debugStats.renderRequests;
+    }
+
+    const GLNullMetrics& metrics = GLNull::getMetrics();
+    const F32 averageRenderTime = renderTime / (F32)frameCount;
+
+    Con::printf( "Scene Render Benchmark: %s", pSceneFile );
+    Con::printf( "  Frames: %d", frameCount );
+    Con::printf( "  Render: Average %0.3fms, Min %0.3fms, Max %0.3fms", averageRenderTime, minimumRenderTime, maximumRenderTime );
+    Con::printf( "  Tick: Average %0.3fms", tickTime / (F32)frameCount );
+    Con::printf( "  RenderRequests/Frame: %0.1f", (F32)renderRequests / (F32)frameCount );
+    Con::printf( "  BatchDrawCalls/Frame: %0.1f", (F32)drawCalls / (F32)frameCount );
+
+    if ( GLNull::isEnabled() )
+    {
+        Con::printf( "  GLCalls/Frame: %0.1f", (F32)metrics.mCalls / (F32)frameCount );
+        Con::printf( "  GLDrawCalls/Frame: %0.1f", (F32)metrics.mDrawCalls / (F32)frameCount );
+        Con::printf( "  GLStateChanges/Frame: %0.1f", (F32)metrics.mStateChanges / (F32)frameCount );
+        Con::printf( "  GLBytes/Frame: %0.1f", (F32)(metrics.mTextureBytes + metrics.mBufferBytes + metrics.mIndexBytes) / (F32)frameCount );
+    }
+
+    // Restore the GL dispatch.
+    if ( nullDispatch )
+        GLNull::disable();
+
+    // Remove the scene.
+    pScene->deleteObject();
+
+    return averageRenderTime;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Builds a scene of bodies with many collision shapes piled onto a ground, steps it and reports the contact shape lookup cost.
+    Each body is a ring of box collision shapes so every contact maps fixtures on bodies with many shapes to their collision shape indices.
+    @param bodyCount The number of bodies to create.  Optional: Defaults to 200.
+    @param shapeCount The number of collision shapes on each body.  Optional: Defaults to 32.
+    @param tickCount The number of scene ticks to run.  Optional: Defaults to 300.
+    @return The average time per tick spent mapping the contact fixtures to their collision shape indices in milliseconds.
+*/
+ConsoleFunctionWithDocs( benchmarkSceneContacts, ConsoleFloat, 1, 4, ([bodyCount]?, [shapeCount]?, [tickCount]?))
+{
+    // Fetch the benchmark configuration.
+    const U32 bodyCount = argc > 1 ? getMax( dAtoi(argv[1]), 1 ) : 200;
+    const U32 shapeCount = argc > 2 ? getMax( dAtoi(argv[2]), 1 ) : 32;
+    const U32 tickCount = argc > 3 ? getMax( dAtoi(argv[3]), 1 ) : 300;
+
+    // Create the scene.
+    Scene* pScene = new Scene();
+    if ( !pScene->registerObject() )
+    {
+        Con::warnf( "benchmarkSceneContacts() - Could not register the scene." );
+        delete pScene;
+        return -1.0f;
+    }
+
+    // Calculate the body layout.
+    const F32 ringRadius = getMax( 1.0f, (F32)shapeCount * 0.25f / M_2PI_F );
+    const F32 bodySpacing = ringRadius * 2.0f + 0.5f;
+    const U32 columnCount = (U32)mCeil( mSqrt( (F32)bodyCount ) );
+    const F32 groundWidth = (F32)columnCount * bodySpacing * 2.0f;
+
+    // Create the ground.
+    SceneObject* pGround = new SceneObject();
+    pGround->registerObject();
+    pGround->setBodyType( b2_staticBody );
+    pGround->createEdgeCollisionShape( b2Vec2( -groundWidth, 0.0f ), b2Vec2( groundWidth, 0.0f ) );
+    pScene->addToScene( pGround );
+
+    // Create the bodies.
+    for ( U32 bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex )
+    {
+        SceneObject* pSceneObject = new SceneObject();
+        pSceneObject->registerObject();
+        pSceneObject->setPosition( Vector2(
+            ((F32)(bodyIndex % columnCount) - (F32)columnCount * 0.5f) * bodySpacing,
+            ((F32)(bodyIndex / columnCount) + 1.0f) * bodySpacing ) );
+        pSceneObject->setCollisionCallback( true );
+
+        // Create a ring of collision shapes.
+        for ( U32 shapeIndex = 0; shapeIndex < shapeCount; ++shapeIndex )
+        {
+            const F32 angle = M_2PI_F * (F32)shapeIndex / (F32)shapeCount;
+            pSceneObject->createPolygonBoxCollisionShape( 0.25f, 0.5f, b2Vec2( mCos(angle) * ringRadius, mSin(angle) * ringRadius ), angle );
+        }
+
+        pScene->addToScene( pSceneObject );
+    }
+
+    F32 tickTime = 0.0f;
+    F32 lookupTime = 0.0f;
+    U32 contactCount = 0;
+
+    for ( U32 tick = 0; tick < tickCount; ++tick )
+    {
+        // Advance the scene.
+        b2Timer tickTimer;
+        pScene->processTick();
+        tickTime += tickTimer.GetMilliseconds();
+
+        // Map the contact fixtures to their collision shape indices as the contact dispatch does.
+        const Scene::typeContactHash& beginContacts = pScene->getBeginContacts();
+        b2Timer lookupTimer;
+        for ( Scene::typeContactHash::const_iterator contactItr = beginContacts.begin(); contactItr != beginContacts.end(); ++contactItr )
+        {
+            const TickContact& tickContact = contactItr->value;
+            const S32 shapeIndexA = tickContact.mpSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
+            const S32 shapeIndexB = tickContact.mpSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
+
+            // Sanity!
+            AssertFatal( shapeIndexA >= 0 && shapeIndexB >= 0, "benchmarkSceneContacts() - Cannot find shape index reported on physics proxy of a fixture." );
+        }
+        lookupTime += lookupTimer.GetMilliseconds();
+        contactCount += beginContacts.size();
+    }
+
+    const F32 averageLookupTime = lookupTime / (F32)tickCount;
+
+    Con::printf( "Scene Contact Benchmark: %d bodies with %d shapes", bodyCount, shapeCount );
+    Con::printf( "  Ticks: %d", tickCount );
+    Con::printf( "  Tick: Average %0.3fms", tickTime / (F32)tickCount );
+    Con::printf( "  ShapeIndexLookup: Average %0.4fms", averageLookupTime );
+    Con::printf( "  BeginContacts/Tick: %0.1f", (F32)contactCount / (F32)tickCount );
+
+    // Remove the scene.
+    pScene->deleteObject();
+
+    return averageLookupTime;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Builds a scene of objects spread over a large area, queries many small scattered regions and reports the region query cost.
+    The regions are queried combined, per-region and with the default scatter ratio that selects between the two as the scene controllers do.
+    @param regionCount The number of regions to query.  Optional: Defaults to 64.
+    @param objectCount The number of objects to create.  Optional: Defaults to 10000.
+    @param queryCount The number of region queries to run for each mode.  Optional: Defaults to 100.
+    @return The average time per region query using the default scatter ratio in milliseconds.
+*/
+ConsoleFunctionWithDocs( benchmarkSceneRegions, ConsoleFloat, 1, 4, ([regionCount]?, [objectCount]?, [queryCount]?))
+{
+    // Fetch the benchmark configuration.
+    const U32 regionCount = argc > 1 ? getMax( dAtoi(argv[1]), 1 ) : 64;
+    const U32 objectCount = argc > 2 ? getMax( dAtoi(argv[2]), 1 ) : 10000;
+    const U32 queryCount = argc > 3 ? getMax( dAtoi(argv[3]), 1 ) : 100;
+
+    // Create the scene.
+    Scene* pScene = new Scene();
+    if ( !pScene->registerObject() )
+    {
+        Con::warnf( "benchmarkSceneRegions() - Could not register the scene." );
+        delete pScene;
+        return -1.0f;
+    }
+
+    // Calculate the object layout.
+    const F32 objectSpacing = 2.0f;
+    const U32 objectColumnCount = (U32)mCeil( mSqrt( (F32)objectCount ) );
+    const F32 worldSize = (F32)objectColumnCount * objectSpacing;
+
+    // Create the objects.
+    for ( U32 objectIndex = 0; objectIndex < objectCount; ++objectIndex )
+    {
+        SceneObject* pSceneObject = new SceneObject();
+        pSceneObject->registerObject();
+        pSceneObject->setBodyType( b2_staticBody );
+        pSceneObject->setPosition( Vector2( (F32)(objectIndex % objectColumnCount) * objectSpacing, (F32)(objectIndex / objectColumnCount) * objectSpacing ) );
+        pSceneObject->setSize( 1.0f, 1.0f );
+        pScene->addToScene( pSceneObject );
+    }
+
+    // Scatter the regions evenly over the objects.
+    // NOTE:    Each region covers a few objects only so the combined region covers the whole scene.
+    const U32 regionColumnCount = (U32)mCeil( mSqrt( (F32)regionCount ) );
+    const F32 regionSpacing = worldSize / (F32)regionColumnCount;
+    const F32 regionSize = objectSpacing * 2.0f;
+    Vector<b2AABB> regions;
+    Vector<WorldQueryFilter> regionQueryFilters;
+    for ( U32 regionIndex = 0; regionIndex < regionCount; ++regionIndex )
+    {
+        b2AABB region;
+        region.lowerBound.Set( (F32)(regionIndex % regionColumnCount) * regionSpacing, (F32)(regionIndex / regionColumnCount) * regionSpacing );
+        region.upperBound = region.lowerBound + b2Vec2( regionSize, regionSize );
+        regions.push_back( region );
+        regionQueryFilters.push_back( WorldQueryFilter() );
+    }
+
+    // Query the regions combined, per-region and with the default scatter ratio.
+    const char* modeNames[3] = { "Combined", "PerRegion", "Default" };
+    const F32 scatterRatios[3] = { F32_MAX, 0.0f, WORLD_QUERY_REGION_SCATTER_RATIO };
+    F32 averageQueryTimes[3];
+    U32 resultCounts[3];
+    Vector<typeWorldQueryResultVector> regionResults;
+    WorldQuery* pWorldQuery = pScene->getWorldQuery();
+    for ( U32 mode = 0; mode < 3; ++mode )
+    {
+        F32 queryTime = 0.0f;
+        for ( U32 query = 0; query < queryCount; ++query )
+        {
+            b2Timer queryTimer;
+            pWorldQuery->anyQueryRegions( regions, regionQueryFilters, regionResults, scatterRatios[mode] );
+            queryTime += queryTimer.GetMilliseconds();
+        }
+
+        // Count the region results.
+        resultCounts[mode] = 0;
+        for ( U32 regionIndex = 0; regionIndex < regionCount; ++regionIndex )
+        {
+            resultCounts[mode] += regionResults[regionIndex].size();
+        }
+
+        averageQueryTimes[mode] = queryTime / (F32)queryCount;
+    }
+
+    Con::printf( "Scene Region Benchmark: %d regions over %d objects", regionCount, objectCount );
+    Con::printf( "  Queries: %d", queryCount );
+    for ( U32 mode = 0; mode < 3; ++mode )
+    {
+        Con::printf( "  %s: Average %0.3fms, Results %d", modeNames[mode], averageQueryTimes[mode], resultCounts[mode] );
+
+        // Sanity!
+        if ( resultCounts[mode] != resultCounts[0] )
+            Con::warnf( "benchmarkSceneRegions() - %s query returned %d results but the combined query returned %d.", modeNames[mode], resultCounts[mode], resultCounts[0] );
+    }
+
+    // Remove the scene.
+    pScene->deleteObject();
+
+    return averageQueryTimes[2];
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleMethodGroupEndWithDocs(Scene)
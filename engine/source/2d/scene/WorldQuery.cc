@@ -42,7 +42,15 @@ WorldQuery::WorldQuery( Scene* pScene ) :
         mCheckPoint(false),
         mCheckAABB(false),
         mCheckOOBB(false),
-        mCheckCircle(false)
+        mCheckCircle(false),
+        mCheckRenderQueryCache(false),
+        mRenderQueryCacheSlot(0),
+        mRenderQueryKey(0),
+        mRenderQueryCacheValid(false),
+        mRenderQueryMovedBase(0),
+        mRenderQueryMovedConsumed(0),
+        mRenderQueryCacheHits(0),
+        mRenderQueryCacheMisses(0)
 {
     // Set debug associations.
     for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; n++ )
@@ -50,6 +58,20 @@ WorldQuery::WorldQuery( Scene* pScene ) :
         VECTOR_SET_ASSOCIATION( mLayeredQueryResults[n] );
     }
     VECTOR_SET_ASSOCIATION( mQueryResults );
+    VECTOR_SET_ASSOCIATION( mRenderQueryMoved );
+    VECTOR_SET_ASSOCIATION( mRegionProxies );
+    VECTOR_SET_ASSOCIATION( mRegionShapes );
+    VECTOR_SET_ASSOCIATION( mRegionOverlaps );
+
+    // Initialize the render query caches.
+    for ( U32 cacheSlot = 0; cacheSlot < WORLD_QUERY_RENDER_QUERY_CACHES; ++cacheSlot )
+    {
+        RenderQueryCache& renderQueryCache = mRenderQueryCaches[cacheSlot];
+        VECTOR_SET_ASSOCIATION( renderQueryCache.mProxies );
+        renderQueryCache.mValid = false;
+        renderQueryCache.mMovedPosition = 0;
+        renderQueryCache.mQueryKey = 0;
+    }
 
     // Clear the query.
     clearQuery();
@@ -62,7 +84,13 @@ S32 WorldQuery::add( SceneObject* pSceneObject )
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_Add);
 
-    return CreateProxy( pSceneObject->getAABB(), static_cast<PhysicsProxy*>(pSceneObject) );
+    // Create proxy.
+    const S32 proxyId = CreateProxy( pSceneObject->getAABB(), static_cast<PhysicsProxy*>(pSceneObject) );
+
+    // Flag the new proxy in the render query cache.
+    markRenderQueryCache( pSceneObject );
+
+    return proxyId;
 }
 
 //-----------------------------------------------------------------------------
@@ -72,6 +100,13 @@ void WorldQuery::remove( SceneObject* pSceneObject )
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_Remove);
 
+    // Remove from the render query caches.
+    for ( U32 cacheSlot = 0; cacheSlot < WORLD_QUERY_RENDER_QUERY_CACHES; ++cacheSlot )
+    {
+        removeRenderQueryCache( pSceneObject, cacheSlot );
+    }
+    unmarkRenderQueryCache( pSceneObject );
+
     DestroyProxy( pSceneObject->getWorldProxy() );
 }
 
@@ -82,7 +117,14 @@ bool WorldQuery::update( SceneObject* pSceneObject, const b2AABB& aabb, const b2
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_Update);
 
-    return MoveProxy( pSceneObject->getWorldProxy(), aabb, displacement );
+    // Move proxy.
+    const bool proxyMoved = MoveProxy( pSceneObject->getWorldProxy(), aabb, displacement );
+
+    // Flag the proxy in the render query cache if its fat AABB changed.
+    if ( proxyMoved )
+        markRenderQueryCache( pSceneObject );
+
+    return proxyMoved;
 }
 
 //-----------------------------------------------------------------------------
@@ -527,6 +569,645 @@ U32 WorldQuery::anyQueryCircle( const Vector2& centroid, const F32 radius )
 
 //-----------------------------------------------------------------------------
 
+struct WorldQueryRegionCallback
+{
+    WorldQueryRegionCallback( const b2DynamicTree* pRegionTree, Vector<U32>* pRegionOverlaps ) :
+        mpRegionTree( pRegionTree ),
+        mpRegionOverlaps( pRegionOverlaps )
+    {
+    }
+
+    bool QueryCallback( S32 proxyId )
+    {
+        // Add the overlapping region index.
+        mpRegionOverlaps->push_back( (U32)(size_t)mpRegionTree->GetUserData( proxyId ) );
+        return true;
+    }
+
+    const b2DynamicTree*    mpRegionTree;
+    Vector<U32>*            mpRegionOverlaps;
+};
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::anyQueryRegions( const Vector<b2AABB>& regions, const Vector<WorldQueryFilter>& queryFilters, Vector<typeWorldQueryResultVector>& regionResults, const F32 scatterRatio )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_AnyQueryRegions);
+
+    // Sanity!
+    AssertFatal( regions.size() == queryFilters.size(), "WorldQuery::anyQueryRegions() - Region and query filter counts differ." );
+
+    // Fetch the region count.
+    const U32 regionCount = (U32)regions.size();
+
+    // Clear the region results.
+    regionResults.setSize( regionCount );
+    for ( U32 n = 0; n < regionCount; ++n )
+    {
+        regionResults[n].clear();
+    }
+
+    // Remove the previous region proxies.
+    for ( U32 n = 0; n < (U32)mRegionProxies.size(); ++n )
+    {
+        mRegionTree.DestroyProxy( mRegionProxies[n] );
+    }
+    mRegionProxies.clear();
+
+    // Finish if no regions.
+    if ( regionCount == 0 )
+        return;
+
+    // Combine the regions and their filters.
+    // NOTE:    The combined filter only rejects what every region filter rejects so the combined query results are
+    //          a superset of the results of each region.
+    b2AABB combinedRegion = regions[0];
+    WorldQueryFilter combinedFilter = queryFilters[0];
+    F32 totalRegionArea = 0.0f;
+    for ( U32 n = 0; n < regionCount; ++n )
+    {
+        const b2AABB& region = regions[n];
+        const WorldQueryFilter& queryFilter = queryFilters[n];
+
+        // Combine the region.
+        combinedRegion.Combine( region );
+        const b2Vec2 regionExtent = region.upperBound - region.lowerBound;
+        totalRegionArea += regionExtent.x * regionExtent.y;
+
+        // Combine the filter.
+        combinedFilter.mSceneLayerMask |= queryFilter.mSceneLayerMask;
+        combinedFilter.mSceneGroupMask |= queryFilter.mSceneGroupMask;
+        combinedFilter.mEnabledFilter &= queryFilter.mEnabledFilter;
+        combinedFilter.mVisibleFilter &= queryFilter.mVisibleFilter;
+        combinedFilter.mPickingAllowedFilter &= queryFilter.mPickingAllowedFilter;
+        combinedFilter.mAlwaysInScopeFilter &= queryFilter.mAlwaysInScopeFilter;
+    }
+
+    // Are the regions scattered?
+    // NOTE:    The combined region also covers the space between the regions so, when that space is much larger than the
+    //          regions themselves, querying each region on its own visits far fewer proxies.
+    const b2Vec2 combinedExtent = combinedRegion.upperBound - combinedRegion.lowerBound;
+    if ( regionCount > 1 && combinedExtent.x * combinedExtent.y > totalRegionArea * scatterRatio )
+    {
+        // Yes, so query each region with its own filter.
+        for ( U32 n = 0; n < regionCount; ++n )
+        {
+            clearQuery();
+            setQueryFilter( queryFilters[n] );
+            anyQueryAABB( regions[n] );
+
+            typeWorldQueryResultVector& results = regionResults[n];
+            const U32 resultCount = getQueryResultsCount();
+            for ( U32 i = 0; i < resultCount; ++i )
+            {
+                results.push_back( mQueryResults[i] );
+            }
+        }
+
+        return;
+    }
+
+    // Add the regions.
+    mRegionShapes.setSize( regionCount );
+    for ( U32 n = 0; n < regionCount; ++n )
+    {
+        const b2AABB& region = regions[n];
+
+        // Set the region shape.
+        b2Vec2 verts[4];
+        verts[0].Set( region.lowerBound.x, region.lowerBound.y );
+        verts[1].Set( region.upperBound.x, region.lowerBound.y );
+        verts[2].Set( region.upperBound.x, region.upperBound.y );
+        verts[3].Set( region.lowerBound.x, region.upperBound.y );
+        mRegionShapes[n].Set( verts, 4 );
+
+        // Add the region proxy.
+        mRegionProxies.push_back( mRegionTree.CreateProxy( region, (void*)(size_t)n ) );
+    }
+
+    // Query for candidate objects.
+    clearQuery();
+    setQueryFilter( combinedFilter );
+    anyQueryAABB( combinedRegion );
+
+    // Fetch the candidate count.
+    const U32 candidateCount = getQueryResultsCount();
+
+    WorldQueryRegionCallback regionCallback( &mRegionTree, &mRegionOverlaps );
+
+    // Assign the candidates to the regions.
+    for ( U32 n = 0; n < candidateCount; ++n )
+    {
+        // Fetch the candidate.
+        const WorldQueryResult& queryResult = mQueryResults[n];
+        SceneObject* pSceneObject = queryResult.mpSceneObject;
+
+        mRegionOverlaps.clear();
+
+        // Is the object always in scope?
+        if ( pSceneObject->getIsAlwaysInScope() )
+        {
+            // Yes, so it can be in any region.
+            for ( U32 regionIndex = 0; regionIndex < regionCount; ++regionIndex )
+            {
+                mRegionOverlaps.push_back( regionIndex );
+            }
+        }
+        else
+        {
+            // No, so calculate the extent of the render OOBB and the collision shapes.
+            b2AABB extent = pSceneObject->getAABB();
+            const b2Body* pBody = pSceneObject->getBody();
+            if ( pBody->IsActive() )
+            {
+                for ( const b2Fixture* pFixture = pBody->GetFixtureList(); pFixture != NULL; pFixture = pFixture->GetNext() )
+                {
+                    const S32 childCount = pFixture->GetShape()->GetChildCount();
+                    for ( S32 childIndex = 0; childIndex < childCount; ++childIndex )
+                    {
+                        extent.Combine( pFixture->GetAABB( childIndex ) );
+                    }
+                }
+            }
+
+            // Find the regions overlapping the extent.
+            mRegionTree.Query( &regionCallback, extent );
+        }
+
+        // Add the candidate to the regions it is in.
+        for ( U32 i = 0; i < (U32)mRegionOverlaps.size(); ++i )
+        {
+            const U32 regionIndex = mRegionOverlaps[i];
+            if ( testQueryRegion( pSceneObject, regions[regionIndex], regionIndex, queryFilters[regionIndex] ) )
+                regionResults[regionIndex].push_back( queryResult );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 WorldQuery::renderQueryAABB( const b2AABB& aabb )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_RenderQueryAABB);
+
+    mMasterQueryKey++;
+
+    // Flag as not a ray-cast query result.
+    mIsRaycastQueryResult = false;
+
+    // Find the cache for the render view.
+    mRenderQueryCacheSlot = findRenderQueryCache( aabb );
+    RenderQueryCache& renderQueryCache = mRenderQueryCaches[mRenderQueryCacheSlot];
+    renderQueryCache.mQueryKey = ++mRenderQueryKey;
+
+    // Is the cache valid and does the query overlap the cached query?
+    if ( renderQueryCache.mValid && b2TestOverlap( renderQueryCache.mAABB, aabb ) )
+    {
+        // Yes, so fetch the proxies that have moved since the cache was last used.
+        const U32 movedStart = renderQueryCache.mMovedPosition - mRenderQueryMovedBase;
+        const U32 movedEnd = (U32)mRenderQueryMoved.size();
+
+        // Remove any proxies that have moved.
+        for ( U32 movedIndex = movedStart; movedIndex < movedEnd; ++movedIndex )
+        {
+            SceneObject* pSceneObject = mRenderQueryMoved[movedIndex];
+            if ( pSceneObject != NULL )
+                removeRenderQueryCache( pSceneObject, mRenderQueryCacheSlot );
+        }
+
+        // Has the query moved?
+        const bool queryMoved = !(aabb.lowerBound == renderQueryCache.mAABB.lowerBound && aabb.upperBound == renderQueryCache.mAABB.upperBound);
+        if ( queryMoved )
+        {
+            // Yes, so remove any proxies the query has moved away from.
+            for ( S32 index = renderQueryCache.mProxies.size()-1; index >= 0; --index )
+            {
+                // Fetch scene object.
+                SceneObject* pSceneObject = renderQueryCache.mProxies[index];
+
+                // Remove if no longer overlapping the query.
+                if ( !b2TestOverlap( GetFatAABB( pSceneObject->getWorldProxy() ), aabb ) )
+                    removeRenderQueryCache( pSceneObject, mRenderQueryCacheSlot );
+            }
+        }
+
+        // The remaining proxies are cache hits.
+        mRenderQueryCacheHits = renderQueryCache.mProxies.size();
+        mRenderQueryCacheMisses = 0;
+
+        // Add back any proxies that have moved but still overlap the query.
+        for ( U32 movedIndex = movedStart; movedIndex < movedEnd; ++movedIndex )
+        {
+            // Fetch scene object.
+            SceneObject* pSceneObject = mRenderQueryMoved[movedIndex];
+
+            // Skip if removed.
+            if ( pSceneObject == NULL )
+                continue;
+
+            // Add if overlapping the query.
+            if ( b2TestOverlap( GetFatAABB( pSceneObject->getWorldProxy() ), aabb ) )
+                addRenderQueryCache( pSceneObject );
+
+            mRenderQueryCacheMisses++;
+        }
+
+        // Query the area the query has moved into.
+        if ( queryMoved )
+        {
+            const b2AABB& cachedAABB = renderQueryCache.mAABB;
+            const F32 innerLowerX = getMax( aabb.lowerBound.x, cachedAABB.lowerBound.x );
+            const F32 innerUpperX = getMin( aabb.upperBound.x, cachedAABB.upperBound.x );
+            b2AABB deltaAABB;
+
+            mCheckRenderQueryCache = true;
+
+            // Left.
+            if ( aabb.lowerBound.x < cachedAABB.lowerBound.x )
+            {
+                deltaAABB.lowerBound.Set( aabb.lowerBound.x, aabb.lowerBound.y );
+                deltaAABB.upperBound.Set( cachedAABB.lowerBound.x, aabb.upperBound.y );
+                Query( this, deltaAABB );
+            }
+
+            // Right.
+            if ( aabb.upperBound.x > cachedAABB.upperBound.x )
+            {
+                deltaAABB.lowerBound.Set( cachedAABB.upperBound.x, aabb.lowerBound.y );
+                deltaAABB.upperBound.Set( aabb.upperBound.x, aabb.upperBound.y );
+                Query( this, deltaAABB );
+            }
+
+            // Bottom.
+            if ( aabb.lowerBound.y < cachedAABB.lowerBound.y )
+            {
+                deltaAABB.lowerBound.Set( innerLowerX, aabb.lowerBound.y );
+                deltaAABB.upperBound.Set( innerUpperX, cachedAABB.lowerBound.y );
+                Query( this, deltaAABB );
+            }
+
+            // Top.
+            if ( aabb.upperBound.y > cachedAABB.upperBound.y )
+            {
+                deltaAABB.lowerBound.Set( innerLowerX, cachedAABB.upperBound.y );
+                deltaAABB.upperBound.Set( innerUpperX, aabb.upperBound.y );
+                Query( this, deltaAABB );
+            }
+
+            mCheckRenderQueryCache = false;
+        }
+    }
+    else
+    {
+        // No, so reset the cache.
+        resetRenderQueryCache( mRenderQueryCacheSlot );
+
+        // Query the whole area.
+        mRenderQueryCacheHits = 0;
+        mRenderQueryCacheMisses = 0;
+        mCheckRenderQueryCache = true;
+        Query( this, aabb );
+        mCheckRenderQueryCache = false;
+
+        // Flag the cache as valid.
+        renderQueryCache.mValid = true;
+    }
+
+    // Update the cached query.
+    renderQueryCache.mAABB = aabb;
+
+    // The cache has now seen every moved proxy.
+    renderQueryCache.mMovedPosition = mRenderQueryMovedBase + mRenderQueryMoved.size();
+    trimRenderQueryMoved();
+
+    // Filter the cached proxies.
+    for( typeSceneObjectVector::iterator itr = renderQueryCache.mProxies.begin(); itr != renderQueryCache.mProxies.end(); ++itr )
+    {
+        // Fetch scene object.
+        SceneObject* pSceneObject = (*itr);
+
+        // Enabled filter.
+        if ( mQueryFilter.mEnabledFilter && !pSceneObject->isEnabled() )
+            continue;
+
+        // Visible filter.  If an object has a size x or y value of zero then they are treated here as invisible.
+        if (mQueryFilter.mVisibleFilter && (!pSceneObject->getVisible() || pSceneObject->getSize().isXZero() || pSceneObject->getSize().isYZero()))
+            continue;
+
+        // Picking allowed filter.
+        if ( mQueryFilter.mPickingAllowedFilter && !pSceneObject->getPickingAllowed() )
+            continue;
+
+        // Fetch layer and group masks.
+        const U32 sceneLayerMask = pSceneObject->getSceneLayerMask();
+        const U32 sceneGroupMask = pSceneObject->getSceneGroupMask();
+
+        // Compare masks and report.
+        if ( (mQueryFilter.mSceneLayerMask & sceneLayerMask) != 0 && (mQueryFilter.mSceneGroupMask & sceneGroupMask) != 0 )
+        {
+            WorldQueryResult queryResult( pSceneObject );
+            mLayeredQueryResults[pSceneObject->getSceneLayer()].push_back( queryResult );
+            mQueryResults.push_back( queryResult );
+
+            // Tag with world query key.
+            pSceneObject->setWorldQueryKey( mMasterQueryKey );
+        }
+    }
+
+    // Inject always-in-scope.
+    injectAlwaysInScope();
+
+    return getQueryResultsCount();
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::resetRenderQueryCache( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_ResetRenderQueryCache);
+
+    // Reset the caches.
+    for ( U32 cacheSlot = 0; cacheSlot < WORLD_QUERY_RENDER_QUERY_CACHES; ++cacheSlot )
+    {
+        resetRenderQueryCache( cacheSlot );
+    }
+
+    // Reset the moved proxies.
+    trimRenderQueryMoved();
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::resetRenderQueryCache( const U32 cacheSlot )
+{
+    // Fetch the cache.
+    RenderQueryCache& renderQueryCache = mRenderQueryCaches[cacheSlot];
+
+    // Reset the cached proxies.
+    for( typeSceneObjectVector::iterator itr = renderQueryCache.mProxies.begin(); itr != renderQueryCache.mProxies.end(); ++itr )
+    {
+        (*itr)->mRenderQueryCacheIndex[cacheSlot] = -1;
+    }
+    renderQueryCache.mProxies.clear();
+
+    // The cache does not need any of the proxies that have already moved.
+    renderQueryCache.mMovedPosition = mRenderQueryMovedBase + mRenderQueryMoved.size();
+
+    // Flag the cache as invalid.
+    renderQueryCache.mValid = false;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 WorldQuery::findRenderQueryCache( const b2AABB& aabb ) const
+{
+    U32 matchSlot = 0;
+    F32 matchRatio = WORLD_QUERY_RENDER_QUERY_CACHE_MATCH;
+    bool matchFound = false;
+    U32 spareSlot = 0;
+    U32 spareQueryKey = U32_MAX;
+
+    for ( U32 cacheSlot = 0; cacheSlot < WORLD_QUERY_RENDER_QUERY_CACHES; ++cacheSlot )
+    {
+        // Fetch the cache.
+        const RenderQueryCache& renderQueryCache = mRenderQueryCaches[cacheSlot];
+
+        // Use an invalid cache as the spare in preference to the least recently used one.
+        if ( !renderQueryCache.mValid )
+        {
+            if ( spareQueryKey != 0 )
+            {
+                spareSlot = cacheSlot;
+                spareQueryKey = 0;
+            }
+            continue;
+        }
+
+        if ( renderQueryCache.mQueryKey < spareQueryKey )
+        {
+            spareSlot = cacheSlot;
+            spareQueryKey = renderQueryCache.mQueryKey;
+        }
+
+        // Skip if the cached query does not overlap the query.
+        const b2AABB& cachedAABB = renderQueryCache.mAABB;
+        if ( !b2TestOverlap( cachedAABB, aabb ) )
+            continue;
+
+        // Calculate how well the cached query matches the query as the intersection over the union.
+        const F32 intersectionArea =
+            (getMin( aabb.upperBound.x, cachedAABB.upperBound.x ) - getMax( aabb.lowerBound.x, cachedAABB.lowerBound.x )) *
+            (getMin( aabb.upperBound.y, cachedAABB.upperBound.y ) - getMax( aabb.lowerBound.y, cachedAABB.lowerBound.y ));
+        const F32 queryArea = (aabb.upperBound.x - aabb.lowerBound.x) * (aabb.upperBound.y - aabb.lowerBound.y);
+        const F32 cachedArea = (cachedAABB.upperBound.x - cachedAABB.lowerBound.x) * (cachedAABB.upperBound.y - cachedAABB.lowerBound.y);
+        const F32 unionArea = queryArea + cachedArea - intersectionArea;
+        const F32 ratio = unionArea > 0.0f ? intersectionArea / unionArea : 1.0f;
+
+        if ( ratio >= matchRatio )
+        {
+            matchSlot = cacheSlot;
+            matchRatio = ratio;
+            matchFound = true;
+        }
+    }
+
+    return matchFound ? matchSlot : spareSlot;
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::addRenderQueryCache( SceneObject* pSceneObject )
+{
+    // Fetch the cache index.
+    S32& cacheIndex = pSceneObject->mRenderQueryCacheIndex[mRenderQueryCacheSlot];
+
+    // Finish if already cached.
+    if ( cacheIndex != -1 )
+        return;
+
+    typeSceneObjectVector& cachedProxies = mRenderQueryCaches[mRenderQueryCacheSlot].mProxies;
+    cacheIndex = cachedProxies.size();
+    cachedProxies.push_back( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::removeRenderQueryCache( SceneObject* pSceneObject, const U32 cacheSlot )
+{
+    // Fetch the cache index.
+    const S32 cacheIndex = pSceneObject->mRenderQueryCacheIndex[cacheSlot];
+
+    // Finish if not cached.
+    if ( cacheIndex == -1 )
+        return;
+
+    // Move the last cached proxy into the removed slot.
+    typeSceneObjectVector& cachedProxies = mRenderQueryCaches[cacheSlot].mProxies;
+    SceneObject* pLastSceneObject = cachedProxies.last();
+    cachedProxies[cacheIndex] = pLastSceneObject;
+    pLastSceneObject->mRenderQueryCacheIndex[cacheSlot] = cacheIndex;
+    cachedProxies.pop_back();
+
+    pSceneObject->mRenderQueryCacheIndex[cacheSlot] = -1;
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::markRenderQueryCache( SceneObject* pSceneObject )
+{
+    // Finish if no cache is valid.
+    if ( !mRenderQueryCacheValid )
+        return;
+
+    // Finish if the proxy is already marked and no cache has seen it yet.
+    const U32 movedPosition = pSceneObject->mRenderQueryMovedPosition;
+    if ( movedPosition != U32_MAX && movedPosition - mRenderQueryMovedBase >= mRenderQueryMovedConsumed - mRenderQueryMovedBase )
+        return;
+
+    // Remove the proxy from where it was previously marked.
+    unmarkRenderQueryCache( pSceneObject );
+
+    // Mark the proxy as moved.
+    pSceneObject->mRenderQueryMovedPosition = mRenderQueryMovedBase + mRenderQueryMoved.size();
+    mRenderQueryMoved.push_back( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::unmarkRenderQueryCache( SceneObject* pSceneObject )
+{
+    // Fetch the moved position.
+    const U32 movedPosition = pSceneObject->mRenderQueryMovedPosition;
+
+    // Finish if the proxy is not marked.
+    if ( movedPosition == U32_MAX )
+        return;
+
+    // Clear the moved proxy.
+    // NOTE: The entry is trimmed once every cache has moved past it.
+    mRenderQueryMoved[movedPosition - mRenderQueryMovedBase] = NULL;
+    pSceneObject->mRenderQueryMovedPosition = U32_MAX;
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::trimRenderQueryMoved( void )
+{
+    const U32 movedCount = mRenderQueryMoved.size();
+
+    // Find the range of moved proxies the valid caches have seen.
+    U32 trimCount = movedCount;
+    U32 consumedCount = 0;
+    mRenderQueryCacheValid = false;
+    for ( U32 cacheSlot = 0; cacheSlot < WORLD_QUERY_RENDER_QUERY_CACHES; ++cacheSlot )
+    {
+        RenderQueryCache& renderQueryCache = mRenderQueryCaches[cacheSlot];
+        if ( !renderQueryCache.mValid )
+            continue;
+
+        // Reset the cache if its render view has stopped rendering so the moved proxies do not accumulate.
+        if ( mRenderQueryKey - renderQueryCache.mQueryKey > WORLD_QUERY_RENDER_QUERY_CACHE_EXPIRY )
+        {
+            resetRenderQueryCache( cacheSlot );
+            continue;
+        }
+
+        const U32 cacheMovedCount = renderQueryCache.mMovedPosition - mRenderQueryMovedBase;
+        trimCount = getMin( trimCount, cacheMovedCount );
+        consumedCount = getMax( consumedCount, cacheMovedCount );
+        mRenderQueryCacheValid = true;
+    }
+
+    // Unmark the moved proxies every valid cache has seen.
+    for ( U32 movedIndex = 0; movedIndex < trimCount; ++movedIndex )
+    {
+        SceneObject* pSceneObject = mRenderQueryMoved[movedIndex];
+        if ( pSceneObject != NULL )
+            pSceneObject->mRenderQueryMovedPosition = U32_MAX;
+    }
+
+    // Remove them.
+    if ( trimCount > 0 )
+    {
+        const U32 remainingCount = movedCount - trimCount;
+        if ( remainingCount > 0 )
+            dMemmove( mRenderQueryMoved.address(), mRenderQueryMoved.address() + trimCount, remainingCount * sizeof(SceneObject*) );
+        mRenderQueryMoved.setSize( remainingCount );
+        mRenderQueryMovedBase += trimCount;
+    }
+
+    // Note the furthest position seen by any cache.
+    mRenderQueryMovedConsumed = mRenderQueryMovedBase + (consumedCount - trimCount);
+}
+
+//-----------------------------------------------------------------------------
+
+bool WorldQuery::testQueryRegion( SceneObject* pSceneObject, const b2AABB& region, const U32 regionIndex, const WorldQueryFilter& queryFilter )
+{
+    // Enabled filter.
+    if ( queryFilter.mEnabledFilter && !pSceneObject->isEnabled() )
+        return false;
+
+    // Picking allowed filter.
+    if ( queryFilter.mPickingAllowedFilter && !pSceneObject->getPickingAllowed() )
+        return false;
+
+    // Compare masks.
+    if ( (queryFilter.mSceneLayerMask & pSceneObject->getSceneLayerMask()) == 0 || (queryFilter.mSceneGroupMask & pSceneObject->getSceneGroupMask()) == 0 )
+        return false;
+
+    // Fetch visibility.
+    const bool visible = !queryFilter.mVisibleFilter || pSceneObject->getVisible();
+
+    // Always-in-scope.
+    if ( visible && !queryFilter.mAlwaysInScopeFilter && pSceneObject->getIsAlwaysInScope() )
+        return true;
+
+    // Fetch the region shape.
+    const b2PolygonShape& regionShape = mRegionShapes[regionIndex];
+    b2Transform identityTransform;
+    identityTransform.SetIdentity();
+
+    // Check OOBB.  If an object has a size x or y value of zero then they are treated here as invisible.
+    if ( !queryFilter.mVisibleFilter || ( visible && !pSceneObject->getSize().isXZero() && !pSceneObject->getSize().isYZero() ) )
+    {
+        // Fetch the shapes render OOBB.
+        b2PolygonShape oobb;
+        oobb.Set( pSceneObject->getRenderOOBB(), 4 );
+
+        if ( b2TestOverlap( &regionShape, 0, &oobb, 0, identityTransform, identityTransform ) )
+            return true;
+    }
+
+    // Finish if not visible.
+    if ( !visible )
+        return false;
+
+    // Finish if the collision shapes are not in the world.
+    const b2Body* pBody = pSceneObject->getBody();
+    if ( !pBody->IsActive() )
+        return false;
+
+    // Check collision shapes.
+    for ( const b2Fixture* pFixture = pBody->GetFixtureList(); pFixture != NULL; pFixture = pFixture->GetNext() )
+    {
+        const S32 childCount = pFixture->GetShape()->GetChildCount();
+        for ( S32 childIndex = 0; childIndex < childCount; ++childIndex )
+        {
+            if ( b2TestOverlap( pFixture->GetAABB( childIndex ), region ) &&
+                 b2TestOverlap( &regionShape, 0, pFixture->GetShape(), 0, identityTransform, pBody->GetTransform() ) )
+                return true;
+        }
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
 void WorldQuery::clearQuery( void )
 {
     // Debug Profiling.
@@ -711,6 +1392,20 @@ bool WorldQuery::QueryCallback( S32 proxyId )
     // Fetch scene object.
     SceneObject* pSceneObject = static_cast<SceneObject*>(pPhysicsProxy);
 
+    // Render query cache.
+    // NOTE:    Filtering is performed when the cache is used so only the overlap is cached here.
+    if ( mCheckRenderQueryCache )
+    {
+        // Add to the cache if not already cached.
+        if ( pSceneObject->mRenderQueryCacheIndex[mRenderQueryCacheSlot] == -1 )
+        {
+            addRenderQueryCache( pSceneObject );
+            mRenderQueryCacheMisses++;
+        }
+
+        return true;
+    }
+
     // Ignore if already tagged with the world query key.
     if ( pSceneObject->getWorldQueryKey() == mMasterQueryKey )
         return true;
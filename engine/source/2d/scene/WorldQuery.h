@@ -33,6 +33,13 @@
 
 ///-----------------------------------------------------------------------------
 
+#define WORLD_QUERY_RENDER_QUERY_CACHES         4
+#define WORLD_QUERY_RENDER_QUERY_CACHE_MATCH    0.25f
+#define WORLD_QUERY_RENDER_QUERY_CACHE_EXPIRY   16
+#define WORLD_QUERY_REGION_SCATTER_RATIO        4.0f
+
+///-----------------------------------------------------------------------------
+
 class Scene;
 
 ///-----------------------------------------------------------------------------
@@ -80,6 +87,22 @@ public:
     U32             anyQueryPoint( const Vector2& point );
     U32             anyQueryCircle( const Vector2& centroid, const F32 radius );
 
+    /// Region queries.
+    /// NOTE:   A single "any" query is performed over the combined regions and each result is then assigned to the regions it
+    ///         overlaps so that every region receives the same results as its own "any" query with its own filter.
+    ///         If the combined region area exceeds the total region area by the scatter ratio then the regions are scattered
+    ///         and each region is queried on its own instead.
+    void            anyQueryRegions( const Vector<b2AABB>& regions, const Vector<WorldQueryFilter>& queryFilters, Vector<typeWorldQueryResultVector>& regionResults, const F32 scatterRatio = WORLD_QUERY_REGION_SCATTER_RATIO );
+
+    /// Render queries.
+    /// NOTE:   Each render query cache holds the proxies that overlapped the previous render query of a render view so that
+    ///         only the proxies that have moved and the area the query has moved into need querying.  A render query uses
+    ///         the cache whose previous query it overlaps the most so each render view keeps its own cache.
+    U32             renderQueryAABB( const b2AABB& aabb );
+    void            resetRenderQueryCache( void );
+    inline U32      getRenderQueryCacheHits( void ) const { return mRenderQueryCacheHits; }
+    inline U32      getRenderQueryCacheMisses( void ) const { return mRenderQueryCacheMisses; }
+
     /// Filtering.
     inline void     setQueryFilter( const WorldQueryFilter& queryFilter ) { mQueryFilter = queryFilter; }
    
@@ -98,7 +121,25 @@ public:
     F32             RayCastCallback( const b2RayCastInput& input, S32 proxyId );
 
 private:
+    /// Render query cache for a single render view.
+    struct RenderQueryCache
+    {
+        typeSceneObjectVector   mProxies;
+        b2AABB                  mAABB;
+        bool                    mValid;
+        U32                     mMovedPosition;
+        U32                     mQueryKey;
+    };
+
     void            injectAlwaysInScope( void );
+    U32             findRenderQueryCache( const b2AABB& aabb ) const;
+    void            resetRenderQueryCache( const U32 cacheSlot );
+    void            addRenderQueryCache( SceneObject* pSceneObject );
+    void            removeRenderQueryCache( SceneObject* pSceneObject, const U32 cacheSlot );
+    void            markRenderQueryCache( SceneObject* pSceneObject );
+    void            unmarkRenderQueryCache( SceneObject* pSceneObject );
+    void            trimRenderQueryMoved( void );
+    bool            testQueryRegion( SceneObject* pSceneObject, const b2AABB& region, const U32 regionIndex, const WorldQueryFilter& queryFilter );
     static S32      QSORT_CALLBACK rayCastFractionSort(const void* a, const void* b);
 
 private:
@@ -113,11 +154,25 @@ private:
     bool                        mCheckAABB;
     bool                        mCheckOOBB;
     bool                        mCheckCircle;
+    bool                        mCheckRenderQueryCache;
     typeWorldQueryResultVector  mLayeredQueryResults[MAX_LAYERS_SUPPORTED];
     typeWorldQueryResultVector  mQueryResults;
     bool                        mIsRaycastQueryResult;
     typeSceneObjectVector       mAlwaysInScopeSet;
     U32                         mMasterQueryKey;
+    RenderQueryCache            mRenderQueryCaches[WORLD_QUERY_RENDER_QUERY_CACHES];
+    U32                         mRenderQueryCacheSlot;
+    U32                         mRenderQueryKey;
+    bool                        mRenderQueryCacheValid;
+    typeSceneObjectVector       mRenderQueryMoved;
+    U32                         mRenderQueryMovedBase;
+    U32                         mRenderQueryMovedConsumed;
+    U32                         mRenderQueryCacheHits;
+    U32                         mRenderQueryCacheMisses;
+    b2DynamicTree               mRegionTree;
+    Vector<S32>                 mRegionProxies;
+    Vector<b2PolygonShape>      mRegionShapes;
+    Vector<U32>                 mRegionOverlaps;
 };
 
 #endif // _WORLD_QUERY_H_
\ No newline at end of file
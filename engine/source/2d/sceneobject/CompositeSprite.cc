@@ -109,6 +109,8 @@ void CompositeSprite::initPersistFields()
     addProtectedField( "DefaultSpriteAngle", TypeF32, Offset(mDefaultSpriteSize, CompositeSprite), &setDefaultSpriteAngle, &getDefaultSpriteAngle, &writeDefaultSpriteAngle, "");
     addProtectedField( "BatchLayout", TypeEnum, Offset(mBatchLayoutType, CompositeSprite), &setBatchLayout, &defaultProtectedGetFn, &writeBatchLayout, 1, &batchLayoutTypeTable, "");
     addProtectedField( "BatchCulling", TypeBool, Offset(mBatchCulling, CompositeSprite), &setBatchCulling, &defaultProtectedGetFn, &writeBatchCulling, "");
+    addProtectedField( "BatchChunkSize", TypeF32, Offset(mBatchChunkSize, CompositeSprite), &setBatchChunkSize, &defaultProtectedGetFn, &writeBatchChunkSize, "");
+    addProtectedField( "BatchChunking", TypeBool, Offset(mBatchChunking, CompositeSprite), &setBatchChunking, &defaultProtectedGetFn, &writeBatchChunking, "");
     addField( "BatchIsolated", TypeBool, Offset(mBatchIsolated, CompositeSprite), &writeBatchIsolated, "");
     addField( "BatchSortMode", TypeEnum, Offset(mBatchSortMode, CompositeSprite), &writeBatchSortMode, 1, &SceneRenderQueue::renderSortTable, "");
 }
@@ -192,6 +194,64 @@ void CompositeSprite::interpolateObject( const F32 timeDelta )
 
 //-----------------------------------------------------------------------------
 
+void CompositeSprite::OnRegisterScene( Scene* pScene )
+{
+    // Call parent.
+    Parent::OnRegisterScene( pScene );
+
+    // Update the scene animation clock for the sprites.
+    updateSceneAnimationClock();
+}
+
+//-----------------------------------------------------------------------------
+
+void CompositeSprite::OnUnregisterScene( Scene* pScene )
+{
+    // Stop using the scene animation clock for the sprites.
+    setAnimationClock( NULL );
+
+    // Call parent.
+    Parent::OnUnregisterScene( pScene );
+}
+
+//-----------------------------------------------------------------------------
+
+void CompositeSprite::setEnabled( const bool enabled )
+{
+    // Call parent.
+    Parent::setEnabled( enabled );
+
+    // Update the scene animation clock for the sprites.
+    updateSceneAnimationClock();
+}
+
+//-----------------------------------------------------------------------------
+
+void CompositeSprite::onSpriteTicking( const bool ticking )
+{
+    // Only integrate whilst any sprites need ticking.
+    setActiveTickInterest( TICK_INTEREST_ANIMATION, ticking );
+}
+
+//-----------------------------------------------------------------------------
+
+void CompositeSprite::updateSceneAnimationClock( void )
+{
+    // Fetch the scene.
+    Scene* pScene = getScene();
+
+    // Finish if not in a scene.
+    // NOTE:-   Leaving the scene stops using the scene animation clock explicitly.
+    if ( pScene == NULL )
+        return;
+
+    // Use the scene animation clock for the sprites whilst enabled unless it's an editor scene where ticking is per-object.
+    // NOTE:-   Disabled objects are not ticked so leaving the clock (keeping the animation time) freezes the sprite animations.
+    setAnimationClock( isEnabled() && !pScene->getIsEditorScene() ? &pScene->getAnimationClock() : NULL );
+}
+
+//-----------------------------------------------------------------------------
+
 void CompositeSprite::scenePrepareRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue )
 {
     // Prepare render.
@@ -66,6 +66,11 @@ public:
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void interpolateObject( const F32 timeDelta );
 
+    virtual void OnRegisterScene( Scene* pScene );
+    virtual void OnUnregisterScene( Scene* pScene );
+
+    virtual void setEnabled( const bool enabled );
+
     virtual inline void setSpatialDirty(void) { mSpatialDirty = true; }
 
     virtual bool canPrepareRender( void ) const { return true; }
@@ -90,6 +95,9 @@ protected:
     virtual SpriteBatchItem* createSpriteIsometricLayout( const SpriteBatchItem::LogicalPosition& logicalPosition );
     virtual SpriteBatchItem* createCustomLayout( const SpriteBatchItem::LogicalPosition& logicalPosition );
 
+    virtual void onSpriteTicking( const bool ticking );
+    void updateSceneAnimationClock( void );
+
     virtual void onTamlCustomWrite( TamlCustomNodes& customNodes );
     virtual void onTamlCustomRead( const TamlCustomNodes& customNodes );
 
@@ -106,6 +114,10 @@ protected:
     static bool         writeBatchLayout( void* obj, StringTableEntry pFieldName )          { return static_cast<CompositeSprite*>(obj)->getBatchLayout() != CompositeSprite::NO_LAYOUT; }
     static bool         setBatchCulling(void* obj, const char* data)                        { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchCulling(dAtob(data)); return false; }
     static bool         writeBatchCulling( void* obj, StringTableEntry pFieldName )         { return !static_cast<CompositeSprite*>(obj)->getBatchCulling(); }
+    static bool         setBatchChunking(void* obj, const char* data)                       { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchChunking(dAtob(data)); return false; }
+    static bool         writeBatchChunking( void* obj, StringTableEntry pFieldName )        { return static_cast<CompositeSprite*>(obj)->getBatchChunking(); }
+    static bool         setBatchChunkSize(void* obj, const char* data)                      { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchChunkSize(dAtof(data)); return false; }
+    static bool         writeBatchChunkSize( void* obj, StringTableEntry pFieldName )       { return mNotEqual( static_cast<CompositeSprite*>(obj)->getBatchChunkSize(), SPRITE_BATCH_DEFAULT_CHUNK_SIZE ); }
 };
 
 #endif // _COMPOSITE_SPRITE_H_
@@ -151,6 +151,64 @@ ConsoleMethodWithDocs(CompositeSprite, getBatchCulling, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether static sprites are grouped into chunks whose vertices are cached.
+    Each chunk is only rebuilt when one of its sprites changes so rendering scales with the visible chunks rather than the sprites.
+    Only static images using the default blending, alpha-test, render group and depth are chunked, all other sprites are rendered individually.
+    Sprites within a chunk are drawn in creation order and each chunk is sorted as a single render request so the batch sort mode only orders chunks and unchunked sprites.
+    This is best suited to large static composites such as tile-maps.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(CompositeSprite, setBatchChunking, ConsoleVoid, 3, 3, (bool batchChunking))
+{
+    // Fetch batch chunking.
+    const bool batchChunking = dAtob(argv[2]);
+
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchChunking( batchChunking );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether static sprites are grouped into cached chunks or not.
+    @return Whether static sprites are grouped into cached chunks or not.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchChunking, ConsoleBool, 2, 2, ())
+{
+    return object->getBatchChunking();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the local size of each chunk when batch chunking.
+    @param chunkSize The local size of each (square) chunk.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(CompositeSprite, setBatchChunkSize, ConsoleVoid, 3, 3, (float chunkSize))
+{
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchChunkSize( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the local size of each chunk when batch chunking.
+    @return The local size of each chunk.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchChunkSize, ConsoleFloat, 2, 2, ())
+{
+    return object->getBatchChunkSize();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of chunks when batch chunking.
+    @return The number of chunks.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchChunkCount, ConsoleInt, 2, 2, ())
+{
+    return object->getBatchChunkCount();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets the batch render sort mode.
     The render sort mode is used when isolated batch mode is on.
     @return No return value.
@@ -308,11 +366,33 @@ ConsoleMethodWithDocs(CompositeSprite, getDefaultSpriteAngle, ConsoleFloat, 3, 3
 //-----------------------------------------------------------------------------
 
 /*! Selects a sprite at the specified logical position.
+    Integer logical positions such as those of rectilinear and isometric layouts are selected directly from the sprite grid.
+    These can also be specified as two separate arguments i.e. selectSprite(x, y).
     @param a b c d e f Logical positions #1 & #2 and four additional and optional arguments.
     @return Whether the sprite was selected or not.
 */
-ConsoleMethodWithDocs(CompositeSprite, selectSprite, ConsoleBool, 3, 3, ( a b [c] [d] [e] [f] ))
+ConsoleMethodWithDocs(CompositeSprite, selectSprite, ConsoleBool, 3, 4, ( a b [c] [d] [e] [f] ))
 {
+    S32 cellX;
+    S32 cellY;
+
+    // Were two arguments specified?
+    if ( argc == 4 )
+    {
+        // Yes, so select the cell if both are integers.
+        if ( SpriteBatchItem::LogicalPosition::getCellArg( argv[2], cellX ) && SpriteBatchItem::LogicalPosition::getCellArg( argv[3], cellY ) )
+            return object->selectSpriteCell( cellX, cellY );
+
+        // Select the logical position.
+        char logicalPositionBuffer[64];
+        dSprintf( logicalPositionBuffer, sizeof(logicalPositionBuffer), "%s %s", argv[2], argv[3] );
+        return object->selectSprite( SpriteBatchItem::LogicalPosition(logicalPositionBuffer) );
+    }
+
+    // Select the cell if the logical position is one.
+    if ( SpriteBatchItem::LogicalPosition::getCell( argv[2], cellX, cellY ) )
+        return object->selectSpriteCell( cellX, cellY );
+
     return object->selectSprite( SpriteBatchItem::LogicalPosition(argv[2]) );
 }
 
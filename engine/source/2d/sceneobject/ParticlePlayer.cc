@@ -28,42 +28,51 @@
 
 //------------------------------------------------------------------------------
 
-ParticleSystem::ParticleNode* ParticlePlayer::EmitterNode::createParticle( void )
+U32 ParticlePlayer::EmitterNode::createParticle( void )
 {
     // Sanity!
     AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::createParticle() - Cannot create a particle with a NULL owner." );
   
-    // Fetch a free node,
-    ParticleSystem::ParticleNode* pFreeParticleNode = ParticleSystem::Instance->createParticle();
+    // Append a particle to the store.
+    const U32 particleIndex = mParticles.createParticle();
 
-    // Insert node into emitter chain.
-    pFreeParticleNode->mNextNode        = mParticleNodeHead.mNextNode;
-    pFreeParticleNode->mPreviousNode    = &mParticleNodeHead;
-    mParticleNodeHead.mNextNode         = pFreeParticleNode;
-    pFreeParticleNode->mNextNode->mPreviousNode = pFreeParticleNode;
+    // Refill the free frame providers if required.
+    if ( mFreeFrameProviders.size() == 0 )
+        ParticleSystem::Instance->acquireParticles( mFreeFrameProviders, PARTICLE_PLAYER_FREE_LIST_BLOCK_SIZE );
 
-    // Configure the node.
-    mOwner->configureParticle( this, pFreeParticleNode );
+    // Fetch a free frame provider.
+    mParticles.mFrameProvider[particleIndex] = mFreeFrameProviders.last();
+    mFreeFrameProviders.pop_back();
 
-    return pFreeParticleNode;
+    // Configure the particle.
+    mOwner->configureParticle( this, particleIndex );
+
+    return particleIndex;
 }
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::EmitterNode::freeParticle( ParticleSystem::ParticleNode* pParticleNode )
+void ParticlePlayer::EmitterNode::releaseParticle( const U32 particleIndex )
 {
     // Sanity!
-    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeParticle() - Cannot free a particle with a NULL owner." );
+    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::releaseParticle() - Cannot release a particle with a NULL owner." );
+
+    // Fetch the frame provider.
+    ImageFrameProviderCore* pFrameProvider = mParticles.mFrameProvider[particleIndex];
 
     // Deallocate the assets.
-    pParticleNode->mFrameProvider.deallocateAssets();
-
-    // Remove the node from the emitter chain.
-    pParticleNode->mPreviousNode->mNextNode = pParticleNode->mNextNode;
-    pParticleNode->mNextNode->mPreviousNode = pParticleNode->mPreviousNode;
-   
-    // Free the node.
-    ParticleSystem::Instance->freeParticle( pParticleNode );
+    pFrameProvider->deallocateAssets();
+
+    // Reset the frame provider.
+    pFrameProvider->resetState();
+
+    // Free the frame provider.
+    // NOTE:-   The particle slot itself is reclaimed by the caller compacting the store.
+    mFreeFrameProviders.push_back( pFrameProvider );
+
+    // Return a block of free frame providers if there are too many.
+    if ( (U32)mFreeFrameProviders.size() > PARTICLE_PLAYER_FREE_LIST_BLOCK_SIZE * 2 )
+        ParticleSystem::Instance->releaseParticles( mFreeFrameProviders, PARTICLE_PLAYER_FREE_LIST_BLOCK_SIZE );
 }
 
 //------------------------------------------------------------------------------
@@ -73,11 +82,19 @@ void ParticlePlayer::EmitterNode::freeAllParticles( void )
     // Sanity!
     AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeAllParticles() - Cannot free all particles with a NULL owner." );
 
-    // Free all the nodes,
-    while( mParticleNodeHead.mNextNode != &mParticleNodeHead )
+    // Release all the particles.
+    const U32 particleCount = mParticles.getParticleCount();
+    for ( U32 particleIndex = 0; particleIndex < particleCount; ++particleIndex )
     {
-        freeParticle( mParticleNodeHead.mNextNode );
+        releaseParticle( particleIndex );
     }
+
+    // Empty the store.
+    mParticles.setParticleCount( 0 );
+    ParticleSystem::Instance->updateLiveParticleCount( -(S32)particleCount );
+
+    // Return the free frame providers.
+    ParticleSystem::Instance->releaseParticles( mFreeFrameProviders, (U32)mFreeFrameProviders.size() );
 }
 
 //------------------------------------------------------------------------------
@@ -87,14 +104,22 @@ IMPLEMENT_CONOBJECT(ParticlePlayer);
 //------------------------------------------------------------------------------
 
 ParticlePlayer::ParticlePlayer() :
+                    mCameraIdle( false ),
+                    mCameraIdleDistance( 0.0f ),
+                    mLodDistance( 0.0f ),
+                    mLodScreenSize( 0.0f ),
+                    mLod( 1.0f ),
+                    mLodTickInterval( 1 ),
+                    mLodTickCount( 0 ),
+                    mLodElapsedTime( 0.0f ),
+                    mParticleInterpolation( false ),
                     mPlaying( false ),
                     mPaused( false ),
                     mAge( 0.0f ),
-                    mParticleInterpolation( false ),
-                    mCameraIdleDistance( 0.0f ),
-                    mCameraIdle( false ),
                     mWaitingForParticles( false ),
-                    mWaitingForDelete( false )
+                    mWaitingForDelete( false ),
+                    mDeferredActiveParticleCount( 0 ),
+                    mDeferredThrottledParticleCount( 0 )
 {
     // Fetch the particle player scales.
     mEmissionRateScale = Con::getFloatVariable( PARTICLE_PLAYER_EMISSION_RATE_SCALE, 1.0f );
@@ -104,6 +129,9 @@ ParticlePlayer::ParticlePlayer() :
      
     // Register for refresh notifications.
     mParticleAsset.registerRefreshNotify( this );
+
+    // The particles are integrated every tick.
+    setTickInterest( TICK_INTEREST_ANIMATION );
 }
 
 //------------------------------------------------------------------------------
@@ -123,6 +151,8 @@ void ParticlePlayer::initPersistFields()
 
     addProtectedField( "Particle", TypeParticleAssetPtr, Offset(mParticleAsset, ParticlePlayer), &setParticle, &defaultProtectedGetFn, defaultProtectedWriteFn, "" );
     addProtectedField( "CameraIdleDistance", TypeF32, Offset(mCameraIdleDistance, ParticlePlayer),&defaultProtectedSetFn, &defaultProtectedGetFn, &writeCameraIdleDistance,"" );
+    addProtectedField( "LodDistance", TypeF32, Offset(mLodDistance, ParticlePlayer), &setLodDistance, &defaultProtectedGetFn, &writeLodDistance, "" );
+    addProtectedField( "LodScreenSize", TypeF32, Offset(mLodScreenSize, ParticlePlayer), &setLodScreenSize, &defaultProtectedGetFn, &writeLodScreenSize, "" );
     addProtectedField( "ParticleInterpolation", TypeBool, Offset(mParticleInterpolation, ParticlePlayer), &defaultProtectedSetFn, &defaultProtectedGetFn, &writeParticleInterpolation,"" );
     addProtectedField( "EmissionRateScale", TypeF32, Offset(mEmissionRateScale, ParticlePlayer), &defaultProtectedSetFn, &defaultProtectedGetFn, &writeEmissionRateScale, "" );
     addProtectedField( "SizeScale", TypeF32, Offset(mSizeScale, ParticlePlayer), &defaultProtectedSetFn, &defaultProtectedGetFn, &writeSizeScale, "" );
@@ -146,6 +176,8 @@ void ParticlePlayer::copyTo(SimObject* object)
    // Copy the fields.
    pParticlePlayer->setParticle( getParticle() );
    pParticlePlayer->setCameraIdleDistance( getCameraIdleDistance() );
+   pParticlePlayer->setLodDistance( getLodDistance() );
+   pParticlePlayer->setLodScreenSize( getLodScreenSize() );
    pParticlePlayer->setParticleInterpolation( getParticleInterpolation() );
    pParticlePlayer->setEmissionRateScale( getEmissionRateScale() );
    pParticlePlayer->setSizeScale( getSizeScale() );
@@ -217,6 +249,9 @@ void ParticlePlayer::preIntegrate( const F32 totalTime, const F32 elapsedTime, D
     // Call Parent.
     Parent::preIntegrate( totalTime, elapsedTime, pDebugStats );
 
+    // Update the level-of-detail.
+    updateLod();
+
     // Finish if the camera idle distance is zero.
     if ( mIsZero(mCameraIdleDistance) || !validRender() )
         return;
@@ -260,6 +295,64 @@ void ParticlePlayer::preIntegrate( const F32 totalTime, const F32 elapsedTime, D
 
 //------------------------------------------------------------------------------
 
+void ParticlePlayer::updateLod( void )
+{
+    // Reset to full detail.
+    mLod = 1.0f;
+    mLodTickInterval = 1;
+
+    // Finish if no level-of-detail is configured.
+    if ( ( mIsZero(mLodDistance) && mIsZero(mLodScreenSize) ) || getScene() == NULL )
+        return;
+
+    // Fetch scene windows.
+    SimSet& sceneWindows = getScene()->getAttachedSceneWindows();
+
+    // Finish if there are no cameras.
+    if ( sceneWindows.size() == 0 )
+        return;
+
+    // Fetch current position and extent.
+    const Vector2 position = getPosition();
+    const Vector2 size = getSize();
+    const F32 extent = getMax( size.x, size.y );
+
+    // Use the highest level-of-detail required by any scene window.
+    F32 lod = PARTICLE_PLAYER_MINIMUM_LOD;
+    for( SimSet::iterator itr = sceneWindows.begin(); itr != sceneWindows.end(); itr++ )
+    {
+        // Fetch the scene window.
+        SceneWindow* pSceneWindow = static_cast<SceneWindow*>(*itr);
+
+        F32 windowLod = 1.0f;
+
+        // Reduce the detail beyond the distance.
+        if ( mLodDistance > 0.0f )
+        {
+            const F32 distance = (pSceneWindow->getCameraPosition() - position).Length();
+            if ( distance > mLodDistance )
+                windowLod *= mLodDistance / distance;
+        }
+
+        // Reduce the detail below the screen size.
+        if ( mLodScreenSize > 0.0f )
+        {
+            const Vector2 cameraSize = pSceneWindow->getCameraSize() / pSceneWindow->getCameraZoom();
+            const F32 screenSize = extent / getMax( cameraSize.x, cameraSize.y );
+            if ( screenSize < mLodScreenSize )
+                windowLod *= screenSize / mLodScreenSize;
+        }
+
+        lod = getMax( lod, windowLod );
+    }
+
+    // Set the level-of-detail and the reduced simulation rate.
+    mLod = mClampF( lod, PARTICLE_PLAYER_MINIMUM_LOD, 1.0f );
+    mLodTickInterval = getMin( (U32)mFloor( 1.0f / mLod + 0.5f ), (U32)PARTICLE_PLAYER_MAXIMUM_LOD_TICK_INTERVAL );
+}
+
+//------------------------------------------------------------------------------
+
 void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
 {
     // Call parent.
@@ -271,16 +364,24 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
             mEmitters.size() == 0 )
         return;
 
-    // Calculate scaled time.
-    const F32 scaledTime = elapsedTime * mTimeScale;
-
-    // Fetch particle asset.
-    ParticleAsset* pParticleAsset = mParticleAsset;
-
     // Finish if no particle asset assigned.
-    if ( pParticleAsset == NULL )
+    if ( mParticleAsset.isNull() )
         return;
 
+    // Accumulate scaled time.
+    // NOTE:-   At a reduced level-of-detail the accumulated time is integrated less frequently.
+    mLodElapsedTime += elapsedTime * mTimeScale;
+    if ( ++mLodTickCount < mLodTickInterval )
+        return;
+
+    // Fetch the scaled time.
+    const F32 scaledTime = mLodElapsedTime;
+    mLodElapsedTime = 0.0f;
+    mLodTickCount = 0;
+
+    // Reset throttled particle count.
+    U32 throttledParticleCount = 0;
+
     // Reset active particle count.
     U32 activeParticleCount = 0;
 
@@ -290,113 +391,226 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
         // No, so update the particle player age.
         mAge += scaledTime;
 
-        // Iterate the emitters.
+        // Fetch the emitter count.
+        const U32 emitterCount = (U32)mEmitters.size();
+
+        // Can the emitters be integrated in parallel?
+        // NOTE:-   Jobs cannot submit further jobs so this is only possible when the player itself is not being integrated in parallel.
+        if (    !getDeferIntegration() &&
+                emitterCount > 1 &&
+                JobScheduler::Instance->getWorkerCount() > 0 &&
+                getParticleCount() >= PARTICLE_PLAYER_PARALLEL_EMITTER_THRESHOLD )
+        {
+            // Yes, so integrate the emitters in parallel.
+            Vector<U32> liveParticleCounts;
+            liveParticleCounts.setSize( emitterCount );
+            EmitterIntegration emitterIntegration = { this, scaledTime, liveParticleCounts.address() };
+            JobScheduler::Instance->parallelFor( emitterCount, 1, &integrateEmittersJob, &emitterIntegration );
+
+            // Accumulate the active particle count.
+            for ( U32 emitterIndex = 0; emitterIndex < emitterCount; ++emitterIndex )
+                activeParticleCount += liveParticleCounts[emitterIndex];
+        }
+        else
+        {
+            // No, so iterate the emitters.
+            for( typeEmitterVector::iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
+            {
+                activeParticleCount += integrateEmitter( *emitterItr, scaledTime );
+            }
+        }
+
+        // Accumulate the throttled particle count.
         for( typeEmitterVector::iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
         {
-            // Fetch the emitter node.
-            EmitterNode* pEmitterNode = *emitterItr;
+            throttledParticleCount += (*emitterItr)->getThrottledParticleCount();
+        }
+    }
 
-            // Fetch the asset emitter.
-            ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
+    // Is integration deferred?
+    if ( getDeferIntegration() )
+    {
+        // Yes, so defer the life-mode as it can stop or delete the player.
+        mDeferredActiveParticleCount = activeParticleCount;
+        deferIntegrationEvent( DEFERRED_PARTICLE_LIFE_MODE );
 
-            // Fetch the first particle node.
-            ParticleSystem::ParticleNode* pParticleNode = pEmitterNode->getFirstParticle();
+        // Defer the throttled particle stats as they are shared by the scene.
+        if ( throttledParticleCount > 0 )
+        {
+            mDeferredThrottledParticleCount = throttledParticleCount;
+            deferIntegrationEvent( DEFERRED_PARTICLE_STATS );
+        }
+        return;
+    }
 
-            // Fetch the particle node head.
-            ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+    // Update the throttled particle stats.
+    pDebugStats->particlesThrottled += throttledParticleCount;
 
-            // Process All particle nodes.
-            while ( pParticleNode != pParticleNodeHead )
-            {
-                // Update the particle age.
-                pParticleNode->mParticleAge += scaledTime;
+    // Update the life-mode.
+    updateLifeMode( activeParticleCount );
+}
 
-                // Has the particle expired?
-                // NOTE:-   If we're in single-particle mode then the particle lives as long as the particle player does.
-                if (    ( !pParticleAssetEmitter->getSingleParticle() && pParticleNode->mParticleAge > pParticleNode->mParticleLifetime ) ||
-                        ( mIsZero(pParticleNode->mParticleLifetime) ) )
-                {
-                    // Yes, so fetch next particle before we kill it.
-                    pParticleNode = pParticleNode->mNextNode;
+//------------------------------------------------------------------------------
 
-                    // Kill the particle.
-                    // NOTE:-   Because we move to the next particle the particle to kill is now the previous!
-                    pEmitterNode->freeParticle( pParticleNode->mPreviousNode );
-                }
-                else
-                {
-                    // No, so integrate the particle.
-                    integrateParticle( pEmitterNode, pParticleNode, pParticleNode->mParticleAge / pParticleNode->mParticleLifetime, scaledTime );
+void ParticlePlayer::integrateEmittersJob( void* pContext, const U32 startIndex, const U32 endIndex )
+{
+    // Fetch the emitter integration.
+    EmitterIntegration* pEmitterIntegration = static_cast<EmitterIntegration*>( pContext );
+    ParticlePlayer* pParticlePlayer = pEmitterIntegration->mpParticlePlayer;
 
-                    // Move to the next particle node.
-                    pParticleNode = pParticleNode->mNextNode;
+    // Integrate the emitters.
+    for ( U32 emitterIndex = startIndex; emitterIndex < endIndex; ++emitterIndex )
+    {
+        pEmitterIntegration->mpLiveParticleCounts[emitterIndex] = pParticlePlayer->integrateEmitter( pParticlePlayer->mEmitters[emitterIndex], pEmitterIntegration->mElapsedTime );
+    }
+}
 
-                    // Only count particles when not in single-particle mode.
-                    activeParticleCount++;
-                }
-            };
+//------------------------------------------------------------------------------
 
-            // Skip generating new particles if the emitter is paused.
-            if ( pEmitterNode->getPaused() )
-                continue;
+U32 ParticlePlayer::integrateEmitter( EmitterNode* pEmitterNode, const F32 scaledTime )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ParticlePlayer_IntegrateEmitter);
 
-            // Are we in single-particle mode?
-            if ( pParticleAssetEmitter->getSingleParticle() )
-            {
-                // Yes, so do we have a single particle yet?
-                if ( pParticleNodeHead->mNextNode == pParticleNodeHead )
-                {
-                    // No, so generate a single particle.
-                    pEmitterNode->createParticle();
-                }
-            }
-            else
-            {
-                // Accumulate the last generation time as we need to handle very small time-integrations correctly.
-                //
-                // NOTE:    We need to do this if there's an emission target but the time-integration is so small
-                //          that rounding results in no emission.  Downside to good FPS!
-                pEmitterNode->setTimeSinceLastGeneration( pEmitterNode->getTimeSinceLastGeneration() + scaledTime );
+    // Fetch particle asset.
+    ParticleAsset* pParticleAsset = mParticleAsset;
 
-                // Fetch the particle player age.
-                const F32 particlePlayerAge = mAge;
+    // Fetch the asset emitter.
+    ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
-                // Fetch the quantity base and variation fields.
-                const ParticleAssetField& quantityBaseField = pParticleAssetEmitter->getQuantityBaseField();
-                const ParticleAssetField& quantityVaritationField = pParticleAssetEmitter->getQuantityBaseField();
+    // Fetch the particles.
+    ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
+    const U32 particleCount = particles.getParticleCount();
 
-                // Fetch the emissions.
-                const F32 baseEmission = quantityBaseField.getFieldValue( particlePlayerAge );
-                const F32 varEmission = quantityVaritationField.getFieldValue( particlePlayerAge ) * 0.5f;
+    // Fetch single-particle mode.
+    const bool singleParticle = pParticleAssetEmitter->getSingleParticle();
 
-                // Fetch the emission scale.
-                const F32 effectEmission = pParticleAsset->getQuantityScaleField().getFieldValue( particlePlayerAge ) * getEmissionRateScale();
+    // Reset the throttled particle count.
+    pEmitterNode->setThrottledParticleCount( 0 );
 
-                // Calculate the local emission.
-                const F32 localEmission = mClampF(  (baseEmission + CoreMath::mGetRandomF(-varEmission, varEmission)) * effectEmission,
-                                                    quantityBaseField.getMinValue(),
-                                                    quantityBaseField.getMaxValue() );
+    // Process all particles.
+    // NOTE:-   Expired particles are removed by compacting the survivors in-place which keeps the store ordered by age.
+    U32 liveParticleCount = 0;
+    for ( U32 particleIndex = 0; particleIndex < particleCount; ++particleIndex )
+    {
+        // Update the particle age.
+        const F32 particleAge = ( particles.mParticleAge[particleIndex] += scaledTime );
+        const F32 particleLifetime = particles.mParticleLifetime[particleIndex];
+
+        // Has the particle expired?
+        // NOTE:-   If we're in single-particle mode then the particle lives as long as the particle player does.
+        if (    ( !singleParticle && particleAge > particleLifetime ) ||
+                ( mIsZero(particleLifetime) ) )
+        {
+            // Yes, so kill the particle.
+            pEmitterNode->releaseParticle( particleIndex );
+            continue;
+        }
 
-                // Calculate the final time-independent emission count.
-                const U32 emissionCount = U32(mFloor( localEmission * pEmitterNode->getTimeSinceLastGeneration() ));
+        // Compact the particle.
+        if ( liveParticleCount != particleIndex )
+            particles.moveParticle( particleIndex, liveParticleCount );
 
-                // Do we have an emission?
-                if ( emissionCount > 0 )
-                {
-                    // Yes, so remove this emission from accumulated time.
-                    pEmitterNode->setTimeSinceLastGeneration( getMax(0.0f, pEmitterNode->getTimeSinceLastGeneration() - (emissionCount / localEmission) ) );
+        // Integrate a single particle individually.
+        if ( singleParticle )
+            integrateParticle( pEmitterNode, liveParticleCount, particleAge / particleLifetime, scaledTime );
 
-                    // Suppress Precision Errors.
-                    if ( mIsZero( pEmitterNode->getTimeSinceLastGeneration() ) )
-                        pEmitterNode->setTimeSinceLastGeneration( 0.0f );
+        liveParticleCount++;
+    }
 
-                    // Generate the required emission.
-                    for ( U32 n = 0; n < emissionCount; n++ )
-                        pEmitterNode->createParticle();
-                }
-            }
+    // Remove the expired particles.
+    particles.setParticleCount( liveParticleCount );
+    ParticleSystem::Instance->updateLiveParticleCount( (S32)liveParticleCount - (S32)particleCount );
+
+    // Integrate the surviving particles as a batch.
+    if ( !singleParticle )
+        integrateParticles( pEmitterNode, scaledTime );
+
+    // Skip generating new particles if the emitter is paused.
+    if ( pEmitterNode->getPaused() )
+        return liveParticleCount;
+
+    // Are we in single-particle mode?
+    if ( pParticleAssetEmitter->getSingleParticle() )
+    {
+        // Yes, so do we have a single particle yet?
+        if ( !pEmitterNode->getActiveParticles() )
+        {
+            // No, so generate a single particle.
+            // NOTE:-   Single particles are never throttled.
+            pEmitterNode->createParticle();
+            ParticleSystem::Instance->updateLiveParticleCount( 1 );
         }
     }
+    else
+    {
+        // Accumulate the last generation time as we need to handle very small time-integrations correctly.
+        //
+        // NOTE:    We need to do this if there's an emission target but the time-integration is so small
+        //          that rounding results in no emission.  Downside to good FPS!
+        pEmitterNode->setTimeSinceLastGeneration( pEmitterNode->getTimeSinceLastGeneration() + scaledTime );
+
+        // Fetch the particle player age.
+        const F32 particlePlayerAge = mAge;
+
+        // Fetch the quantity base and variation fields.
+        const ParticleAssetField& quantityBaseField = pParticleAssetEmitter->getQuantityBaseField();
+        const ParticleAssetField& quantityVaritationField = pParticleAssetEmitter->getQuantityBaseField();
+
+        // Fetch the emissions.
+        const F32 baseEmission = quantityBaseField.getFieldValue( particlePlayerAge );
+        const F32 varEmission = quantityVaritationField.getFieldValue( particlePlayerAge ) * 0.5f;
+
+        // Fetch the emission scale.
+        const F32 effectEmission = pParticleAsset->getQuantityScaleField().getFieldValue( particlePlayerAge ) * getEmissionRateScale();
+
+        // Calculate the local emission.
+        const F32 localEmission = mClampF(  (baseEmission + pEmitterNode->getRandom().randRangeF(-varEmission, varEmission)) * effectEmission,
+                                            quantityBaseField.getMinValue(),
+                                            quantityBaseField.getMaxValue() );
+
+        // Calculate the final time-independent emission count.
+        const U32 emissionCount = U32(mFloor( localEmission * pEmitterNode->getTimeSinceLastGeneration() ));
+
+        // Do we have an emission?
+        if ( emissionCount > 0 )
+        {
+            // Yes, so remove this emission from accumulated time.
+            pEmitterNode->setTimeSinceLastGeneration( getMax(0.0f, pEmitterNode->getTimeSinceLastGeneration() - (emissionCount / localEmission) ) );
+
+            // Suppress Precision Errors.
+            if ( mIsZero( pEmitterNode->getTimeSinceLastGeneration() ) )
+                pEmitterNode->setTimeSinceLastGeneration( 0.0f );
+
+            // Reduce the emission by the level-of-detail.
+            // NOTE:-   The fractional emission is dithered so the mean emission is scaled exactly.
+            U32 throttledEmissionCount = emissionCount;
+            if ( mLod < 1.0f )
+                throttledEmissionCount = getMin( (U32)mFloor( emissionCount * mLod + pEmitterNode->getRandom().randF() ), emissionCount );
+
+            // Limit the emission to the share of the particle budget available to the emitter priority.
+            throttledEmissionCount = getMin( throttledEmissionCount, ParticleSystem::Instance->getEmissionAllowance( pParticleAssetEmitter->getPriority() ) );
+
+            // Record the throttled particles.
+            pEmitterNode->setThrottledParticleCount( emissionCount - throttledEmissionCount );
+
+            // Generate the required emission.
+            for ( U32 n = 0; n < throttledEmissionCount; n++ )
+                pEmitterNode->createParticle();
+
+            ParticleSystem::Instance->updateLiveParticleCount( (S32)throttledEmissionCount );
+        }
+    }
+
+    return liveParticleCount;
+}
+
+//------------------------------------------------------------------------------
+
+void ParticlePlayer::updateLifeMode( const U32 activeParticleCount )
+{
+    // Fetch particle asset.
+    ParticleAsset* pParticleAsset = mParticleAsset;
 
     // Fetch the particle life-mode.
     const ParticleAsset::LifeMode lifeMode = pParticleAsset->getLifeMode();
@@ -460,6 +674,22 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
 
 //------------------------------------------------------------------------------
 
+void ParticlePlayer::onDeferredIntegration( const U32 deferredFlags )
+{
+    // Call Parent.
+    Parent::onDeferredIntegration( deferredFlags );
+
+    // Update the throttled particle stats.
+    if ( deferredFlags & DEFERRED_PARTICLE_STATS )
+        getScene()->getDebugStats().particlesThrottled += mDeferredThrottledParticleCount;
+
+    // Update the life-mode.
+    if ( deferredFlags & DEFERRED_PARTICLE_LIFE_MODE )
+        updateLifeMode( mDeferredActiveParticleCount );
+}
+
+//------------------------------------------------------------------------------
+
 void ParticlePlayer::interpolateObject( const F32 timeDelta )
 {    
     // Call parent.
@@ -475,45 +705,20 @@ void ParticlePlayer::interpolateObject( const F32 timeDelta )
         // Fetch the emitter node.
         EmitterNode* pEmitterNode = *emitterItr;
 
-        // Fetch First Particle Node.
-        ParticleSystem::ParticleNode* pParticleNode = pEmitterNode->getFirstParticle();
-
-        // Fetch the particle node head.
-        ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
-
-        // Fetch the asset emitter.
-        ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
+        // Fetch the particles.
+        ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
+        const U32 particleCount = particles.getParticleCount();
 
-        // Fetch the local AABB..
-        const Vector2& localAABB0 = pParticleAssetEmitter->getLocalPivotAABB0();
-        const Vector2& localAABB1 = pParticleAssetEmitter->getLocalPivotAABB1();
-        const Vector2& localAABB2 = pParticleAssetEmitter->getLocalPivotAABB2();
-        const Vector2& localAABB3 = pParticleAssetEmitter->getLocalPivotAABB3();
+        const Vector2* pPreTickPosition = particles.mPreTickPosition;
+        const Vector2* pPostTickPosition = particles.mPostTickPosition;
+        Vector2* pRenderPosition = particles.mRenderPosition;
 
-        // Process All particle nodes.
-        while ( pParticleNode != pParticleNodeHead )
+        // Process all particles.
+        // NOTE: The particle quads are transformed when rendered.
+        for ( U32 particleIndex = 0; particleIndex < particleCount; ++particleIndex )
         {
             // Interpolate the position.
-            pParticleNode->mRenderTickPosition = (timeDelta * pParticleNode->mPreTickPosition) + ((1.0f-timeDelta) * pParticleNode->mPostTickPosition);
-
-            // Set the transform.
-            pParticleNode->mTransform.p = pParticleNode->mRenderTickPosition;
-
-            // Fetch the render size.
-            const Vector2& renderSize = pParticleNode->mRenderSize;
-
-            // Calculate the scaled AABB.
-            Vector2 scaledAABB[4];
-            scaledAABB[0] = localAABB0 * renderSize;
-            scaledAABB[1] = localAABB1 * renderSize;
-            scaledAABB[2] = localAABB2 * renderSize;
-            scaledAABB[3] = localAABB3 * renderSize;
-
-            // Calculate the world OOBB..
-            CoreMath::mCalculateOOBB( scaledAABB, pParticleNode->mTransform, pParticleNode->mRenderOOBB );
-
-            // Move to the next particle.
-            pParticleNode = pParticleNode->mNextNode;
+            pRenderPosition[particleIndex] = (timeDelta * pPreTickPosition[particleIndex]) + ((1.0f-timeDelta) * pPostTickPosition[particleIndex]);
         }
     }
 }
@@ -616,20 +821,35 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
             }
         }
 
+        // Fetch the local pivot AABB used as the quad for all particles.
+        const Vector2 localQuad[4] = {
+            pParticleAssetEmitter->getLocalPivotAABB0(),
+            pParticleAssetEmitter->getLocalPivotAABB1(),
+            pParticleAssetEmitter->getLocalPivotAABB2(),
+            pParticleAssetEmitter->getLocalPivotAABB3() };
+
         // Fetch the oldest-in-front flag.
         const bool oldestInFront = pParticleAssetEmitter->getOldestInFront();
 
-        // Fetch the starting particle (using appropriate particle order).
-        ParticleSystem::ParticleNode* pParticleNode = oldestInFront ? pEmitterNode->getFirstParticle() : pEmitterNode->getLastParticle();
+        // Fetch the particles.
+        ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
+        const U32 particleCount = particles.getParticleCount();
+
+        // Fetch the particle order.
+        // NOTE:-   The store is ordered oldest first so the oldest are rendered last when in front.
+        const S32 particleStep = oldestInFront ? -1 : 1;
+        S32 particleIndex = oldestInFront ? particleCount-1 : 0;
 
-        // Fetch the particle node head.
-        ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+        // Reset the render quads.
+        mRenderQuads.clear();
+        mRenderQuads.reserve( particleCount );
+        TextureHandle* pRunTexture = NULL;
 
-        // Process all particle nodes.
-        while ( pParticleNode != pParticleNodeHead )
+        // Process all particles.
+        for ( U32 n = 0; n < particleCount; ++n, particleIndex += particleStep )
         {
             // Fetch the frame provider.
-            const ImageFrameProviderCore& frameProvider = pParticleNode->mFrameProvider;
+            const ImageFrameProviderCore& frameProvider = *particles.mFrameProvider[particleIndex];
 
             // Fetch the frame area.
             const ImageAsset::FrameArea::TexelArea& texelFrameArea = frameProvider.getProviderImageFrameArea().mTexelArea;
@@ -637,29 +857,31 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
             // Frame texture.
             TextureHandle& frameTexture = frameProvider.getProviderTexture();
 
-            // Fetch the particle render OOBB.
-            Vector2* renderOOBB = pParticleNode->mRenderOOBB;
-
-            // Fetch lower/upper texture coordinates.
-            const Vector2& texLower = texelFrameArea.mTexelLower;
-            const Vector2& texUpper = texelFrameArea.mTexelUpper;
-
-            // Submit batched quad.
-            pBatchRenderer->SubmitQuad(
-                renderOOBB[0],
-                renderOOBB[1],
-                renderOOBB[2],
-                renderOOBB[3],
-                Vector2( texLower.x, texUpper.y ),
-                Vector2( texUpper.x, texUpper.y ),
-                Vector2( texUpper.x, texLower.y ),
-                Vector2( texLower.x, texLower.y ),
-                frameTexture,
-                pParticleNode->mColor );
-
-            // Move to next Particle ( using appropriate sort-order ).
-            pParticleNode = oldestInFront ? pParticleNode->mNextNode : pParticleNode->mPreviousNode;
-        };
+            // Submit the render quads if the texture changes.
+            if ( pRunTexture != NULL && *pRunTexture != frameTexture )
+            {
+                pBatchRenderer->SubmitQuads( mRenderQuads.size(), mRenderQuads.address(), localQuad, *pRunTexture, true );
+                mRenderQuads.clear();
+            }
+            pRunTexture = &frameTexture;
+
+            // Add the render quad.
+            mRenderQuads.increment();
+            BatchRender::BatchQuad& renderQuad = mRenderQuads.last();
+            renderQuad.mPosition = particles.mRenderPosition[particleIndex];
+            renderQuad.mRotation = particles.mRenderRotation[particleIndex];
+            renderQuad.mScale = particles.mRenderSize[particleIndex];
+            renderQuad.mTexelLower = texelFrameArea.mTexelLower;
+            renderQuad.mTexelUpper = texelFrameArea.mTexelUpper;
+            renderQuad.mColor = particles.mColor[particleIndex];
+        }
+
+        // Submit any remaining render quads.
+        if ( pRunTexture != NULL )
+        {
+            pBatchRenderer->SubmitQuads( mRenderQuads.size(), mRenderQuads.address(), localQuad, *pRunTexture, true );
+            mRenderQuads.clear();
+        }
 
         // Flush.
         pBatchRenderer->flush( getScene()->getDebugStats().batchIsolatedFlush );
@@ -767,6 +989,21 @@ bool ParticlePlayer::getEmitterVisible( const U32 emitterIndex )
 
 //-----------------------------------------------------------------------------
 
+U32 ParticlePlayer::getParticleCount( void ) const
+{
+    U32 particleCount = 0;
+
+    // Sum the particles in all the emitters.
+    for( typeEmitterVector::const_iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
+    {
+        particleCount += (*emitterItr)->getParticleCount();
+    }
+
+    return particleCount;
+}
+
+//-----------------------------------------------------------------------------
+
 bool ParticlePlayer::play( const bool resetParticles )
 {
     // Cannot do anything if we've not got any emitters!
@@ -877,7 +1114,7 @@ void ParticlePlayer::stop( const bool waitForParticles, const bool killEffect )
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode )
+void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, const U32 particleIndex )
 {
     // Fetch the particle player age.
     const F32 particlePlayerAge = mAge;
@@ -885,15 +1122,15 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Fetch the particle player position.
     const Vector2& particlePlayerPosition = getPosition();
 
-    // Default to not suppressing movement.
-    pParticleNode->mSuppressMovement = false;
-
     // Fetch particle asset.
     ParticleAsset* pParticleAsset = mParticleAsset;
 
     // Fetch the asset emitter.
     ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
+    // Fetch the particles.
+    ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
+
 
     // **********************************************************************************************************************
     // Calculate Particle Position.
@@ -913,11 +1150,11 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         // Determine whether to use world-space or emitter-space.
         if ( attachPositionToEmitter )
         {
-            pParticleNode->mPosition = emitterOffset;
+            particles.mPosition[particleIndex] = emitterOffset;
         }
         else
         {
-            pParticleNode->mPosition = particlePlayerPosition + emitterOffset;
+            particles.mPosition[particleIndex] = particlePlayerPosition + emitterOffset;
         }
     }
     else
@@ -932,12 +1169,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 if ( attachPositionToEmitter )
                 {
                     // Yes, so transform the particle into emitter-space only.
-                    pParticleNode->mPosition = emitterOffset;
+                    particles.mPosition[particleIndex] = emitterOffset;
                 }
                 else
                 {
                     // No, so transform the particle into world-space here.
-                    pParticleNode->mPosition = emitterOffset + particlePlayerPosition;
+                    particles.mPosition[particleIndex] = emitterOffset + particlePlayerPosition;
                 }
 
             } break;
@@ -949,17 +1186,17 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 const F32 halfWidth = emitterSize.x * 0.5f;
 
                 // Calculate emitter position.
-                Vector2 emissionPosition( CoreMath::mGetRandomF( -halfWidth, halfWidth ), 0.0f );
+                Vector2 emissionPosition( pEmitterNode->getRandom().randRangeF( -halfWidth, halfWidth ), 0.0f );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particles.mPosition[particleIndex] = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particles.mPosition[particleIndex] = b2Mul( xform, particles.mPosition[particleIndex] );
                 }
 
             } break;
@@ -972,17 +1209,17 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 const F32 halfHeight = emitterSize.y * 0.5f;
 
                 // Calculate emitter position.
-                Vector2 emissionPosition( CoreMath::mGetRandomF( -halfWidth, halfWidth ), CoreMath::mGetRandomF( -halfHeight, halfHeight ) );
+                Vector2 emissionPosition( pEmitterNode->getRandom().randRangeF( -halfWidth, halfWidth ), pEmitterNode->getRandom().randRangeF( -halfHeight, halfHeight ) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particles.mPosition[particleIndex] = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particles.mPosition[particleIndex] = b2Mul( xform, particles.mPosition[particleIndex] );
                 }
 
             } break;
@@ -991,10 +1228,10 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
             case ParticleAssetEmitter::DISK_EMITTER:
             {
                 // Calculate the random angle.
-                const F32 angle = CoreMath::mGetRandomF( 0.0f, b2_pi2 );
+                const F32 angle = pEmitterNode->getRandom().randRangeF( 0.0f, b2_pi2 );
 #if 1
                 // Calculate the uniform distribution scale.
-                const F32 distributionScale = mSqrt( CoreMath::mGetRandomF(0.0f, 1.0f) );
+                const F32 distributionScale = mSqrt( pEmitterNode->getRandom().randRangeF(0.0f, 1.0f) );
 
                 // Calculate the radii.
                 const F32 radiusX = emitterSize.x * 0.5f * distributionScale;
@@ -1008,14 +1245,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( radiusX * mCos(angle), radiusY * mSin(angle) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particles.mPosition[particleIndex] = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particles.mPosition[particleIndex] = b2Mul( xform, particles.mPosition[particleIndex] );
                 }
 
             } break;
@@ -1024,20 +1261,20 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
             case ParticleAssetEmitter::ELLIPSE_EMITTER:
             {
                 // Calculate the random angle.
-                const F32 angle = CoreMath::mGetRandomF( 0.0f, b2_pi2 );
+                const F32 angle = pEmitterNode->getRandom().randRangeF( 0.0f, b2_pi2 );
 
                 // Calculate emitter position using a uniform distribution.
                 Vector2 emissionPosition( emitterSize.x * 0.5f * mCos(angle), emitterSize.y * 0.5f * mSin(angle) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particles.mPosition[particleIndex] = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particles.mPosition[particleIndex] = b2Mul( xform, particles.mPosition[particleIndex] );
                 }
 
             } break;
@@ -1046,17 +1283,17 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
             case ParticleAssetEmitter::TORUS_EMITTER:
             {
                 // Calculate the random angle.
-                const F32 angle = CoreMath::mGetRandomF( 0.0f, b2_pi2 );
+                const F32 angle = pEmitterNode->getRandom().randRangeF( 0.0f, b2_pi2 );
 
                 // Calculate the inner and outer radii.
                 const F32 outerRadii = emitterSize.getMajorAxis() * 0.5f;
                 const F32 innerRadii = emitterSize.getMinorAxis() * 0.5f;
 #if 1
                 // Calculate the radius as a uniform distribution.
-                const F32 radius = innerRadii + ( mSqrt( CoreMath::mGetRandomF(0.0f, 1.0f) ) * (outerRadii-innerRadii) );
+                const F32 radius = innerRadii + ( mSqrt( pEmitterNode->getRandom().randRangeF(0.0f, 1.0f) ) * (outerRadii-innerRadii) );
 #else
                 // Calculate the radius as a non-uniform distribution.
-                const F32 radius = CoreMath::mGetRandomF( innerRadii, outerRadii );
+                const F32 radius = pEmitterNode->getRandom().randRangeF( innerRadii, outerRadii );
 #endif
                 // Calculate emitter position using a uniform distribution.
                 Vector2 emissionPosition( radius * mCos(angle), radius * mSin(angle) );
@@ -1065,12 +1302,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 if ( attachPositionToEmitter )
                 {
                     // Yes, so transform the particle into emitter-space only.
-                    pParticleNode->mPosition = emissionPosition + emitterOffset;
+                    particles.mPosition[particleIndex] = emissionPosition + emitterOffset;
                 }
                 else
                 {
                     // No, so transform the particle into world-space here.
-                    pParticleNode->mPosition = emissionPosition + emitterOffset + particlePlayerPosition;
+                    particles.mPosition[particleIndex] = emissionPosition + emitterOffset + particlePlayerPosition;
                 }
 
             } break;
@@ -1084,39 +1321,39 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Particle Lifetime.
     // **********************************************************************************************************************
 
-    pParticleNode->mParticleAge = 0.0f;
-    pParticleNode->mParticleLifetime = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getParticleLifeBaseField(),
-                                                                                pParticleAssetEmitter->getParticleLifeVariationField(),
-                                                                                pParticleAsset->getParticleLifeScaleField(),
-                                                                                particlePlayerAge );
+    particles.mParticleAge[particleIndex] = 0.0f;
+    particles.mParticleLifetime[particleIndex] = ParticleAssetField::calculateFieldBVE(   pEmitterNode->getRandom(), pParticleAssetEmitter->getParticleLifeBaseField(),
+                                                                                          pParticleAssetEmitter->getParticleLifeVariationField(),
+                                                                                          pParticleAsset->getParticleLifeScaleField(),
+                                                                                          particlePlayerAge );
 
 
     // **********************************************************************************************************************
     // Calculate Particle Size-X.
     // **********************************************************************************************************************
 
-    pParticleNode->mSize.x = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeXBaseField(),
-                                                                    pParticleAssetEmitter->getSizeXVariationField(),
-                                                                    pParticleAsset->getSizeXScaleField(),
-                                                                    particlePlayerAge ) * getSizeScale();
+    particles.mSize[particleIndex].x = ParticleAssetField::calculateFieldBVE( pEmitterNode->getRandom(), pParticleAssetEmitter->getSizeXBaseField(),
+                                                                              pParticleAssetEmitter->getSizeXVariationField(),
+                                                                              pParticleAsset->getSizeXScaleField(),
+                                                                              particlePlayerAge ) * getSizeScale();
 
     // Is the particle using a fixed aspect?
     if ( pParticleAssetEmitter->getFixedAspect() )
     {
         // Yes, so simply copy Size-X.
-        pParticleNode->mSize.y = pParticleNode->mSize.x;
+        particles.mSize[particleIndex].y = particles.mSize[particleIndex].x;
     }
     else
     {
         // No, so calculate the particle Size-Y.
-        pParticleNode->mSize.y = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeYBaseField(),
-                                                                        pParticleAssetEmitter->getSizeYVariationField(),
-                                                                        pParticleAsset->getSizeYScaleField(),
-                                                                        particlePlayerAge ) * getSizeScale();
+        particles.mSize[particleIndex].y = ParticleAssetField::calculateFieldBVE( pEmitterNode->getRandom(), pParticleAssetEmitter->getSizeYBaseField(),
+                                                                                  pParticleAssetEmitter->getSizeYVariationField(),
+                                                                                  pParticleAsset->getSizeYScaleField(),
+                                                                                  particlePlayerAge ) * getSizeScale();
     }
 
     // Reset the render size.
-    pParticleNode->mRenderSize.Set(-1.0f, -1.0f);
+    particles.mRenderSize[particleIndex].Set(-1.0f, -1.0f);
 
 
     // **********************************************************************************************************************
@@ -1131,30 +1368,30 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Ignore if we're using a single-particle.
     if ( !pParticleAssetEmitter->getSingleParticle() )
     {
-        pParticleNode->mSpeed = ParticleAssetField::calculateFieldBVE(  pParticleAssetEmitter->getSpeedBaseField(),
-                                                                        pParticleAssetEmitter->getSpeedVariationField(),
-                                                                        pParticleAsset->getSpeedScaleField(),
-                                                                        particlePlayerAge ) * getForceScale();
+        particles.mSpeed[particleIndex] = ParticleAssetField::calculateFieldBVE(  pEmitterNode->getRandom(), pParticleAssetEmitter->getSpeedBaseField(),
+                                                                                  pParticleAssetEmitter->getSpeedVariationField(),
+                                                                                  pParticleAsset->getSpeedScaleField(),
+                                                                                  particlePlayerAge ) * getForceScale();
 
-        pParticleNode->mRandomMotion = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getRandomMotionBaseField(),
-                                                                                pParticleAssetEmitter->getRandomMotionVariationField(),
-                                                                                pParticleAsset->getRandomMotionScaleField(),
-                                                                                particlePlayerAge ) * getForceScale();
+        particles.mRandomMotion[particleIndex] = ParticleAssetField::calculateFieldBVE(   pEmitterNode->getRandom(), pParticleAssetEmitter->getRandomMotionBaseField(),
+                                                                                          pParticleAssetEmitter->getRandomMotionVariationField(),
+                                                                                          pParticleAsset->getRandomMotionScaleField(),
+                                                                                          particlePlayerAge ) * getForceScale();
 
 
         //  Calculate the emission force.
-        emissionForce = ParticleAssetField::calculateFieldBV(   pParticleAssetEmitter->getEmissionForceForceBaseField(),
+        emissionForce = ParticleAssetField::calculateFieldBV(   pEmitterNode->getRandom(), pParticleAssetEmitter->getEmissionForceForceBaseField(),
                                                                 pParticleAssetEmitter->getEmissionForceVariationField(),
                                                                 particlePlayerAge) * getForceScale();
 
         // Calculate Emission Angle.
-        emissionAngle = ParticleAssetField::calculateFieldBV(   pParticleAssetEmitter->getEmissionAngleBaseField(),
+        emissionAngle = ParticleAssetField::calculateFieldBV(   pEmitterNode->getRandom(), pParticleAssetEmitter->getEmissionAngleBaseField(),
                                                                 pParticleAssetEmitter->getEmissionAngleVariationField(),
                                                                 particlePlayerAge );
 
         // Calculate Emission Arc.
         // NOTE:-   We're actually interested in half the emission arc!
-        emissionArc = ParticleAssetField::calculateFieldBV( pParticleAssetEmitter->getEmissionArcBaseField(),
+        emissionArc = ParticleAssetField::calculateFieldBV( pEmitterNode->getRandom(), pParticleAssetEmitter->getEmissionArcBaseField(),
                                                             pParticleAssetEmitter->getEmissionArcVariationField(),
                                                             particlePlayerAge ) * 0.5f;
 
@@ -1166,11 +1403,11 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         }
 
         // Calculate the final emission angle choosing random Arc.
-        emissionAngle = mFmod( CoreMath::mGetRandomF( emissionAngle-emissionArc, emissionAngle+emissionArc ), 360.0f );
+        emissionAngle = mFmod( pEmitterNode->getRandom().randRangeF( emissionAngle-emissionArc, emissionAngle+emissionArc ), 360.0f );
 
         // Calculate the particle velocity.
         const F32 emissionAngleRadians = mDegToRad( emissionAngle );
-        pParticleNode->mVelocity.Set( emissionForce * mCos( emissionAngleRadians ), emissionForce * mSin( emissionAngleRadians ) );
+        particles.mVelocity[particleIndex].Set( emissionForce * mCos( emissionAngleRadians ), emissionForce * mSin( emissionAngleRadians ) );
     }
 
 
@@ -1178,20 +1415,20 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Spin.
     // **********************************************************************************************************************
 
-    pParticleNode->mSpin = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getSpinBaseField(),
-                                                                    pParticleAssetEmitter->getSpinVariationField(),
-                                                                    pParticleAsset->getSpinScaleField(),
-                                                                    particlePlayerAge );
+    particles.mSpin[particleIndex] = ParticleAssetField::calculateFieldBVE(   pEmitterNode->getRandom(), pParticleAssetEmitter->getSpinBaseField(),
+                                                                              pParticleAssetEmitter->getSpinVariationField(),
+                                                                              pParticleAsset->getSpinScaleField(),
+                                                                              particlePlayerAge );
 
 
     // **********************************************************************************************************************
     // Calculate Fixed-Force.
     // **********************************************************************************************************************
 
-    pParticleNode->mFixedForce = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getFixedForceBaseField(),
-                                                                        pParticleAssetEmitter->getFixedForceVariationField(),
-                                                                        pParticleAsset->getFixedForceScaleField(),
-                                                                        particlePlayerAge ) * getForceScale();
+    particles.mFixedForce[particleIndex] = ParticleAssetField::calculateFieldBVE( pEmitterNode->getRandom(), pParticleAssetEmitter->getFixedForceBaseField(),
+                                                                                  pParticleAssetEmitter->getFixedForceVariationField(),
+                                                                                  pParticleAsset->getFixedForceScaleField(),
+                                                                                  particlePlayerAge ) * getForceScale();
 
 
     // **********************************************************************************************************************
@@ -1205,7 +1442,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         case ParticleAssetEmitter::ALIGNED_ORIENTATION:
         {
             // Use the emission angle with fixed offset.
-            pParticleNode->mOrientationAngle = mFmod( emissionAngle - pParticleAssetEmitter->getAlignedAngleOffset(), 360.0f );
+            particles.mOrientationAngle[particleIndex] = mFmod( emissionAngle - pParticleAssetEmitter->getAlignedAngleOffset(), 360.0f );
 
         } break;
 
@@ -1213,7 +1450,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         case ParticleAssetEmitter::FIXED_ORIENTATION:
         {
             // Use a fixed angle.
-            pParticleNode->mOrientationAngle = mFmod( pParticleAssetEmitter->getFixedAngleOffset(), 360.0f );
+            particles.mOrientationAngle[particleIndex] = mFmod( pParticleAssetEmitter->getFixedAngleOffset(), 360.0f );
 
         } break;
 
@@ -1222,7 +1459,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         {
             // Used a random angle/arc.
             const F32 randomArc = pParticleAssetEmitter->getRandomArc() * 0.5f;
-            pParticleNode->mOrientationAngle = mFmod( CoreMath::mGetRandomF( pParticleAssetEmitter->getRandomAngleOffset() - randomArc, pParticleAssetEmitter->getRandomAngleOffset() + randomArc ), 360.0f );
+            particles.mOrientationAngle[particleIndex] = mFmod( pEmitterNode->getRandom().randRangeF( pParticleAssetEmitter->getRandomAngleOffset() - randomArc, pParticleAssetEmitter->getRandomAngleOffset() + randomArc ), 360.0f );
 
         } break;
         
@@ -1242,10 +1479,10 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     const ParticleAssetField& alphaChannelScale = pParticleAsset->getAlphaChannelScaleField();
 
     // Calculate the color.
-    pParticleNode->mColor.set(  mClampF( redChannel.getFieldValue( 0.0f ), redChannel.getMinValue(), redChannel.getMaxValue() ),
-                                mClampF( greenChannel.getFieldValue( 0.0f ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
-                                mClampF( blueChannel.getFieldValue( 0.0f ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
-                                mClampF( alphaChannel.getFieldValue( 0.0f ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
+    particles.mColor[particleIndex].set(  mClampF( redChannel.getFieldValue( 0.0f ), redChannel.getMinValue(), redChannel.getMaxValue() ),
+                                          mClampF( greenChannel.getFieldValue( 0.0f ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
+                                          mClampF( blueChannel.getFieldValue( 0.0f ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
+                                          mClampF( alphaChannel.getFieldValue( 0.0f ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
 
 
     // **********************************************************************************************************************
@@ -1253,7 +1490,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
 
     // Fetch the image frame provider.
-    ImageFrameProviderCore& frameProvider = pParticleNode->mFrameProvider;
+    ImageFrameProviderCore& frameProvider = *particles.mFrameProvider[particleIndex];
 
     // Allocate assets to the particle.
     frameProvider.allocateAssets( &(pParticleAssetEmitter->getImageAsset()), &(pParticleAssetEmitter->getAnimationAsset()) );
@@ -1268,7 +1505,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
             const U32 frameCount = pParticleAssetEmitter->getImageAsset()->getFrameCount();
 
             // Choose a random frame.
-            frameProvider.setImageFrame( (U32)CoreMath::mGetRandomI( 0, frameCount-1 ) );
+            frameProvider.setImageFrame( (U32)pEmitterNode->getRandom().randRangeI( 0, frameCount-1 ) );
         }
         else
         {
@@ -1285,37 +1522,38 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         const AssetPtr<AnimationAsset>& animationAsset = pParticleAssetEmitter->getAnimationAsset();
 
         // Play it.
-        frameProvider.playAnimation( animationAsset );
+        frameProvider.playAnimation( animationAsset, pEmitterNode->getRandom() );
     }
 
 
     // **********************************************************************************************************************
     // Reset Tick Position.
     // **********************************************************************************************************************
-    pParticleNode->mPreTickPosition = pParticleNode->mPostTickPosition = pParticleNode->mRenderTickPosition = pParticleNode->mPosition;
+    particles.mPreTickPosition[particleIndex] = particles.mPostTickPosition[particleIndex] = particles.mRenderPosition[particleIndex] = particles.mPosition[particleIndex];
 
 
     // **********************************************************************************************************************
     // Do a Single Particle Integration to get things going.
     // **********************************************************************************************************************
-    integrateParticle( pEmitterNode, pParticleNode, 0.0f, 0.0f );
+    integrateParticle( pEmitterNode, particleIndex, 0.0f, 0.0f );
 }
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode, F32 particleAge, F32 elapsedTime )
+void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, const U32 particleIndex, F32 particleAge, F32 elapsedTime )
 {
-    // Fetch particle asset.
-    ParticleAsset* pParticleAsset = mParticleAsset;
+    integrateParticle( mParticleAsset, pEmitterNode->getAssetEmitter(), pEmitterNode->getParticles(), pEmitterNode->getRandom(), getForceScale(), particleIndex, particleAge, elapsedTime );
+}
 
-    // Fetch the asset emitter.
-    ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
+//------------------------------------------------------------------------------
 
+void ParticlePlayer::integrateParticle( ParticleAsset* pParticleAsset, ParticleAssetEmitter* pParticleAssetEmitter, ParticleSystem::ParticleStore& particles, RandomLCG& random, const F32 forceScale, const U32 particleIndex, const F32 particleAge, const F32 elapsedTime )
+{
 
     // **********************************************************************************************************************
     // Copy Old Tick Position.
     // **********************************************************************************************************************
-    pParticleNode->mRenderTickPosition = pParticleNode->mPreTickPosition = pParticleNode->mPostTickPosition;
+    particles.mPreTickPosition[particleIndex] = particles.mPostTickPosition[particleIndex];
 
 
     // **********************************************************************************************************************
@@ -1323,47 +1561,47 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
 
     // Scale Size-X.
-    pParticleNode->mRenderSize.x = mClampF( pParticleNode->mSize.x * pParticleAssetEmitter->getSizeXLifeField().getFieldValue( particleAge ),
-                                            pParticleAssetEmitter->getSizeXBaseField().getMinValue(),
-                                            pParticleAssetEmitter->getSizeXBaseField().getMaxValue());
+    particles.mRenderSize[particleIndex].x = mClampF( particles.mSize[particleIndex].x * pParticleAssetEmitter->getSizeXLifeField().getFieldValue( particleAge ),
+                                                      pParticleAssetEmitter->getSizeXBaseField().getMinValue(),
+                                                      pParticleAssetEmitter->getSizeXBaseField().getMaxValue());
 
     // Is the particle using a fixed aspect?
     if ( pParticleAssetEmitter->getFixedAspect() )
     {
         // Yes, so simply copy Size-X.
-        pParticleNode->mRenderSize.y = pParticleNode->mRenderSize.x;
+        particles.mRenderSize[particleIndex].y = particles.mRenderSize[particleIndex].x;
     }
     else
     {
         // No, so Scale Size-Y.
-        pParticleNode->mRenderSize.y = mClampF( pParticleNode->mSize.y * pParticleAssetEmitter->getSizeYLifeField().getFieldValue( particleAge ),
-                                                pParticleAssetEmitter->getSizeYBaseField().getMinValue(),
-                                                pParticleAssetEmitter->getSizeYBaseField().getMaxValue() );
+        particles.mRenderSize[particleIndex].y = mClampF( particles.mSize[particleIndex].y * pParticleAssetEmitter->getSizeYLifeField().getFieldValue( particleAge ),
+                                                          pParticleAssetEmitter->getSizeYBaseField().getMinValue(),
+                                                          pParticleAssetEmitter->getSizeYBaseField().getMaxValue() );
     }
 
 
     // **********************************************************************************************************************
     // Scale Speed.
     // **********************************************************************************************************************
-    pParticleNode->mRenderSpeed = mClampF(  pParticleNode->mSpeed * pParticleAssetEmitter->getSpeedLifeField().getFieldValue( particleAge ),
-                                            pParticleAssetEmitter->getSpeedBaseField().getMinValue(),
-                                            pParticleAssetEmitter->getSpeedBaseField().getMaxValue() );
+    const F32 renderSpeed = mClampF(  particles.mSpeed[particleIndex] * pParticleAssetEmitter->getSpeedLifeField().getFieldValue( particleAge ),
+                                      pParticleAssetEmitter->getSpeedBaseField().getMinValue(),
+                                      pParticleAssetEmitter->getSpeedBaseField().getMaxValue() );
 
 
     // **********************************************************************************************************************
     // Scale Fixed-Force.
     // **********************************************************************************************************************
-    pParticleNode->mRenderFixedForce = mClampF( pParticleNode->mFixedForce * pParticleAssetEmitter->getFixedForceLifeField().getFieldValue( particleAge ),
-                                                pParticleAssetEmitter->getFixedForceBaseField().getMinValue(),
-                                                pParticleAssetEmitter->getFixedForceBaseField().getMaxValue() );
+    const F32 renderFixedForce = mClampF( particles.mFixedForce[particleIndex] * pParticleAssetEmitter->getFixedForceLifeField().getFieldValue( particleAge ),
+                                          pParticleAssetEmitter->getFixedForceBaseField().getMinValue(),
+                                          pParticleAssetEmitter->getFixedForceBaseField().getMaxValue() );
 
 
     // **********************************************************************************************************************
     // Scale Random-Motion.
     // **********************************************************************************************************************
-    pParticleNode->mRenderRandomMotion = mClampF(   pParticleNode->mRandomMotion * pParticleAssetEmitter->getRandomMotionLifeField().getFieldValue( particleAge ),
-                                                    pParticleAssetEmitter->getRandomMotionBaseField().getMinValue(),
-                                                    pParticleAssetEmitter->getRandomMotionBaseField().getMaxValue() );
+    const F32 renderRandomMotion = mClampF(   particles.mRandomMotion[particleIndex] * pParticleAssetEmitter->getRandomMotionLifeField().getFieldValue( particleAge ),
+                                              pParticleAssetEmitter->getRandomMotionBaseField().getMinValue(),
+                                              pParticleAssetEmitter->getRandomMotionBaseField().getMaxValue() );
 
 
     // **********************************************************************************************************************
@@ -1378,10 +1616,10 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     const ParticleAssetField& alphaChannelScale = pParticleAsset->getAlphaChannelScaleField();
 
     // Calculate the color.
-    pParticleNode->mColor.set(  mClampF( redChannel.getFieldValue( particleAge ), redChannel.getMinValue(), redChannel.getMaxValue() ),
-                                mClampF( greenChannel.getFieldValue( particleAge ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
-                                mClampF( blueChannel.getFieldValue( particleAge ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
-                                mClampF( alphaChannel.getFieldValue( particleAge ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
+    particles.mColor[particleIndex].set(  mClampF( redChannel.getFieldValue( particleAge ), redChannel.getMinValue(), redChannel.getMaxValue() ),
+                                          mClampF( greenChannel.getFieldValue( particleAge ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
+                                          mClampF( blueChannel.getFieldValue( particleAge ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
+                                          mClampF( alphaChannel.getFieldValue( particleAge ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
 
 
     // **********************************************************************************************************************
@@ -1393,7 +1631,7 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     if ( !pParticleAssetEmitter->isStaticFrameProvider() )
     {
         // No, so update animation.
-        pParticleNode->mFrameProvider.updateAnimation( elapsedTime );
+        particles.mFrameProvider[particleIndex]->updateAnimation( elapsedTime );
     }
 
 
@@ -1405,28 +1643,24 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     if ( !pParticleAssetEmitter->getSingleParticle() )
     {
         // Calculate random motion (if we've got any).
-        if ( mNotZero( pParticleNode->mRenderRandomMotion ) )
+        if ( mNotZero( renderRandomMotion ) )
         {
             // Fetch random motion.
-            const F32 randomMotion = pParticleNode->mRenderRandomMotion * 0.5f;
+            const F32 randomMotion = renderRandomMotion * 0.5f;
 
             // Add time-integrated random motion into velocity.
-            pParticleNode->mVelocity += Vector2( CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime, CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime );
+            particles.mVelocity[particleIndex] += Vector2( random.randRangeF(-randomMotion, randomMotion) * elapsedTime, random.randRangeF(-randomMotion, randomMotion) * elapsedTime );
         }
 
         // Do we have any fixed force?
-        if ( mNotZero( pParticleNode->mRenderFixedForce ) )
+        if ( mNotZero( renderFixedForce ) )
         {
             // Yes, so time-integrate a fixed force to the velocity.
-            pParticleNode->mVelocity += (pParticleAssetEmitter->getFixedForceDirection() * (pParticleNode->mRenderFixedForce * getForceScale()) * elapsedTime);
+            particles.mVelocity[particleIndex] += (pParticleAssetEmitter->getFixedForceDirection() * (renderFixedForce * forceScale) * elapsedTime);
         }
 
-        // Are we suppressing movement?
-        if ( !pParticleNode->mSuppressMovement )
-        {
-            // No, so adjust particle position.
-            pParticleNode->mPosition += (pParticleNode->mVelocity * pParticleNode->mRenderSpeed * elapsedTime);
-        }
+        // Adjust particle position.
+        particles.mPosition[particleIndex] += (particles.mVelocity[particleIndex] * renderSpeed * elapsedTime);
     }
 
 
@@ -1436,59 +1670,184 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     if ( pParticleAssetEmitter->getKeepAligned() && pParticleAssetEmitter->getOrientationType() == ParticleAssetEmitter::ALIGNED_ORIENTATION )
     {
         // Yes, so calculate last movement direction.
-        F32 movementAngle = mRadToDeg( mAtan( pParticleNode->mVelocity.x, pParticleNode->mVelocity.y ) );
+        F32 movementAngle = mRadToDeg( mAtan( particles.mVelocity[particleIndex].x, particles.mVelocity[particleIndex].y ) );
 
         // Adjust for negative ArcTan quadrants.
         if ( movementAngle < 0.0f )
             movementAngle += 360.0f;
 
         // Set new Orientation Angle.
-        pParticleNode->mOrientationAngle = movementAngle - pParticleAssetEmitter->getAlignedAngleOffset();
+        particles.mOrientationAngle[particleIndex] = movementAngle - pParticleAssetEmitter->getAlignedAngleOffset();
 
     }
     else
     {
         // No, so calculate the render spin.
-        pParticleNode->mRenderSpin = pParticleNode->mSpin * pParticleAssetEmitter->getSpinLifeField().getFieldValue( particleAge );
+        const F32 renderSpin = particles.mSpin[particleIndex] * pParticleAssetEmitter->getSpinLifeField().getFieldValue( particleAge );
 
         // Have we got some Spin?
-        if ( mNotZero(pParticleNode->mRenderSpin) )
+        if ( mNotZero(renderSpin) )
         {
             // Yes, so add into Orientation.
-            pParticleNode->mOrientationAngle += pParticleNode->mRenderSpin * elapsedTime;
+            particles.mOrientationAngle[particleIndex] += renderSpin * elapsedTime;
 
             // Clamp the orientation angle.
-            pParticleNode->mOrientationAngle = mFmod( pParticleNode->mOrientationAngle, 360.0f );
+            particles.mOrientationAngle[particleIndex] = mFmod( particles.mOrientationAngle[particleIndex], 360.0f );
         }
     }
 
-    // Calculate the transform.
-    pParticleNode->mTransform.Set( pParticleNode->mPosition, mDegToRad(pParticleNode->mOrientationAngle) );
+    // Calculate the render transform.
+    // NOTE: The particle quad is transformed when rendered.
+    particles.mRenderPosition[particleIndex] = particles.mPosition[particleIndex];
+    particles.mRenderRotation[particleIndex].Set( mDegToRad(particles.mOrientationAngle[particleIndex]) );
 
-    // Fetch the local AABB..
-    const Vector2& localAABB0 = pParticleAssetEmitter->getLocalPivotAABB0();
-    const Vector2& localAABB1 = pParticleAssetEmitter->getLocalPivotAABB1();
-    const Vector2& localAABB2 = pParticleAssetEmitter->getLocalPivotAABB2();
-    const Vector2& localAABB3 = pParticleAssetEmitter->getLocalPivotAABB3();
 
-    // Fetch the render size.
-    const Vector2& renderSize = pParticleNode->mRenderSize;
+    // **********************************************************************************************************************
+    // Set Post Tick Position.
+    // **********************************************************************************************************************
+    particles.mPostTickPosition[particleIndex] = particles.mPosition[particleIndex];
+}
 
-    // Calculate the scaled AABB.
-    Vector2 scaledAABB[4];
-    scaledAABB[0] = localAABB0 * renderSize;
-    scaledAABB[1] = localAABB1 * renderSize;
-    scaledAABB[2] = localAABB2 * renderSize;
-    scaledAABB[3] = localAABB3 * renderSize;
+//------------------------------------------------------------------------------
 
-    // Calculate the world OOBB..
-    CoreMath::mCalculateOOBB( scaledAABB, pParticleNode->mTransform, pParticleNode->mRenderOOBB );
+void ParticlePlayer::integrateParticles( EmitterNode* pEmitterNode, const F32 elapsedTime )
+{
+    integrateParticles( mParticleAsset, pEmitterNode->getAssetEmitter(), pEmitterNode->getParticles(), pEmitterNode->getRandom(), getForceScale(), elapsedTime );
+}
 
+//------------------------------------------------------------------------------
 
-    // **********************************************************************************************************************
-    // Set Post Tick Position.
-    // **********************************************************************************************************************
-    pParticleNode->mPostTickPosition = pParticleNode->mPosition;
+void ParticlePlayer::integrateParticles( ParticleAsset* pParticleAsset, ParticleAssetEmitter* pParticleAssetEmitter, ParticleSystem::ParticleStore& particles, RandomLCG& random, const F32 forceScale, const F32 elapsedTime )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ParticlePlayer_IntegrateParticles);
+
+    const U32 particleCount = particles.getParticleCount();
+
+    // Fetch the life fields.
+    const ParticleAssetField& sizeXLifeField = pParticleAssetEmitter->getSizeXLifeField();
+    const ParticleAssetField& sizeYLifeField = pParticleAssetEmitter->getSizeYLifeField();
+    const ParticleAssetField& speedLifeField = pParticleAssetEmitter->getSpeedLifeField();
+    const ParticleAssetField& fixedForceLifeField = pParticleAssetEmitter->getFixedForceLifeField();
+    const ParticleAssetField& randomMotionLifeField = pParticleAssetEmitter->getRandomMotionLifeField();
+    const ParticleAssetField& spinLifeField = pParticleAssetEmitter->getSpinLifeField();
+    const ParticleAssetField& redChannel = pParticleAssetEmitter->getRedChannelLifeField();
+    const ParticleAssetField& greenChannel = pParticleAssetEmitter->getGreenChannelLifeField();
+    const ParticleAssetField& blueChannel = pParticleAssetEmitter->getBlueChannelLifeField();
+    const ParticleAssetField& alphaChannel = pParticleAssetEmitter->getAlphaChannelLifeField();
+
+    // Fetch the emitter state.
+    const F32 randomMotionMinimum = pParticleAssetEmitter->getRandomMotionBaseField().getMinValue();
+    const F32 randomMotionMaximum = pParticleAssetEmitter->getRandomMotionBaseField().getMaxValue();
+    const F32 alphaScale = pParticleAsset->getAlphaChannelScaleField().getFieldValue( 0.0f );
+    const bool fixedAspect = pParticleAssetEmitter->getFixedAspect();
+    const bool staticFrameProvider = pParticleAssetEmitter->isStaticFrameProvider();
+    const bool keepAligned = pParticleAssetEmitter->getKeepAligned() && pParticleAssetEmitter->getOrientationType() == ParticleAssetEmitter::ALIGNED_ORIENTATION;
+    const F32 alignedAngleOffset = pParticleAssetEmitter->getAlignedAngleOffset();
+
+    // Configure the integration batch.
+    const U32 batchSize = 256;
+    F32 sizeXLife[batchSize];
+    F32 sizeYLife[batchSize];
+    F32 speedLife[batchSize];
+    F32 fixedForceLife[batchSize];
+    F32 spinLife[batchSize];
+    ColorF colorLife[batchSize];
+    F32 renderSpin[batchSize];
+
+    ParticleSystem::IntegrationBatch batch;
+    batch.mElapsedTime = elapsedTime;
+    batch.mSizeXLife = sizeXLife;
+    batch.mSizeYLife = sizeYLife;
+    batch.mSpeedLife = speedLife;
+    batch.mFixedForceLife = fixedForceLife;
+    batch.mSpinLife = spinLife;
+    batch.mColorLife = colorLife;
+    batch.mSizeXLimits.Set( pParticleAssetEmitter->getSizeXBaseField().getMinValue(), pParticleAssetEmitter->getSizeXBaseField().getMaxValue() );
+    batch.mSizeYLimits.Set( pParticleAssetEmitter->getSizeYBaseField().getMinValue(), pParticleAssetEmitter->getSizeYBaseField().getMaxValue() );
+    batch.mSpeedLimits.Set( pParticleAssetEmitter->getSpeedBaseField().getMinValue(), pParticleAssetEmitter->getSpeedBaseField().getMaxValue() );
+    batch.mFixedForceLimits.Set( pParticleAssetEmitter->getFixedForceBaseField().getMinValue(), pParticleAssetEmitter->getFixedForceBaseField().getMaxValue() );
+    batch.mColorMinimum.set( redChannel.getMinValue(), greenChannel.getMinValue(), blueChannel.getMinValue(), alphaChannel.getMinValue() );
+    batch.mColorMaximum.set( redChannel.getMaxValue(), greenChannel.getMaxValue(), blueChannel.getMaxValue(), alphaChannel.getMaxValue() );
+    batch.mFixedAspect = fixedAspect;
+    batch.mFixedForceDirection = pParticleAssetEmitter->getFixedForceDirection();
+    batch.mForceScale = forceScale;
+    batch.mRenderSpin = renderSpin;
+
+    // Integrate the particles in batches.
+    for ( U32 batchStart = 0; batchStart < particleCount; batchStart += batchSize )
+    {
+        const U32 batchCount = getMin( batchSize, particleCount - batchStart );
+        batch.mStart = batchStart;
+        batch.mCount = batchCount;
+
+        // Sample the life fields, update animations and apply random motion.
+        // NOTE: Random motion is applied here so that the random sequence matches single particle integration.
+        for ( U32 batchIndex = 0; batchIndex < batchCount; ++batchIndex )
+        {
+            const U32 particleIndex = batchStart + batchIndex;
+            const F32 particleAge = particles.mParticleAge[particleIndex] / particles.mParticleLifetime[particleIndex];
+
+            sizeXLife[batchIndex] = sizeXLifeField.getFieldValue( particleAge );
+            sizeYLife[batchIndex] = fixedAspect ? sizeXLife[batchIndex] : sizeYLifeField.getFieldValue( particleAge );
+            speedLife[batchIndex] = speedLifeField.getFieldValue( particleAge );
+            fixedForceLife[batchIndex] = fixedForceLifeField.getFieldValue( particleAge );
+            spinLife[batchIndex] = keepAligned ? 0.0f : spinLifeField.getFieldValue( particleAge );
+            colorLife[batchIndex].set(  redChannel.getFieldValue( particleAge ),
+                                        greenChannel.getFieldValue( particleAge ),
+                                        blueChannel.getFieldValue( particleAge ),
+                                        alphaChannel.getFieldValue( particleAge ) * alphaScale );
+
+            // Is the emitter in static mode?
+            if ( !staticFrameProvider )
+            {
+                // No, so update animation.
+                particles.mFrameProvider[particleIndex]->updateAnimation( elapsedTime );
+            }
+
+            // Calculate random motion (if we've got any).
+            const F32 renderRandomMotion = mClampF( particles.mRandomMotion[particleIndex] * randomMotionLifeField.getFieldValue( particleAge ), randomMotionMinimum, randomMotionMaximum );
+            if ( mNotZero( renderRandomMotion ) )
+            {
+                // Fetch random motion.
+                const F32 randomMotion = renderRandomMotion * 0.5f;
+
+                // Add time-integrated random motion into velocity.
+                particles.mVelocity[particleIndex] += Vector2( random.randRangeF(-randomMotion, randomMotion) * elapsedTime, random.randRangeF(-randomMotion, randomMotion) * elapsedTime );
+            }
+        }
+
+        // Integrate the batch.
+        ParticleSystem::integrateParticles( particles, batch );
+
+        // Update the orientations.
+        for ( U32 batchIndex = 0; batchIndex < batchCount; ++batchIndex )
+        {
+            const U32 particleIndex = batchStart + batchIndex;
+
+            // Are we aligning to motion?
+            if ( keepAligned )
+            {
+                // Yes, so calculate last movement direction.
+                F32 movementAngle = mRadToDeg( mAtan( particles.mVelocity[particleIndex].x, particles.mVelocity[particleIndex].y ) );
+
+                // Adjust for negative ArcTan quadrants.
+                if ( movementAngle < 0.0f )
+                    movementAngle += 360.0f;
+
+                // Set new Orientation Angle.
+                particles.mOrientationAngle[particleIndex] = movementAngle - alignedAngleOffset;
+            }
+            else if ( mNotZero( renderSpin[batchIndex] ) )
+            {
+                // Add spin into orientation and clamp it.
+                particles.mOrientationAngle[particleIndex] = mFmod( particles.mOrientationAngle[particleIndex] + renderSpin[batchIndex] * elapsedTime, 360.0f );
+            }
+
+            // Calculate the render rotation.
+            particles.mRenderRotation[particleIndex].Set( mDegToRad(particles.mOrientationAngle[particleIndex]) );
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -31,6 +31,10 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_JOB_SCHEDULER_H_
+#include "platform/threads/jobScheduler.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 #define PARTICLE_PLAYER_EMISSION_RATE_SCALE     "$pref::T2D::ParticlePlayerEmissionRateScale"
@@ -38,6 +42,11 @@
 #define PARTICLE_PLAYER_FORCE_SCALE             "$pref::T2D::ParticlePlayerForceScale"
 #define PARTICLE_PLAYER_TIME_SCALE              "$pref::T2D::ParticlePlayerTimeScale"
 
+#define PARTICLE_PLAYER_FREE_LIST_BLOCK_SIZE            64
+#define PARTICLE_PLAYER_PARALLEL_EMITTER_THRESHOLD      1024
+#define PARTICLE_PLAYER_MINIMUM_LOD                     0.1f
+#define PARTICLE_PLAYER_MAXIMUM_LOD_TICK_INTERVAL       4
+
 //-----------------------------------------------------------------------------
 
 class ParticlePlayer : public SceneObject, protected AssetPtrCallback
@@ -51,13 +60,17 @@ private:
     private:
         ParticlePlayer*                 mOwner;
         ParticleAssetEmitter*           mpAssetEmitter;
-        ParticleSystem::ParticleNode    mParticleNodeHead;
+        ParticleSystem::ParticleStore   mParticles;
+        Vector<ImageFrameProviderCore*> mFreeFrameProviders;
+        RandomLCG                       mRandom;
         F32                             mTimeSinceLastGeneration;
+        U32                             mThrottledParticleCount;
         bool                            mPaused;
         bool                            mVisible;
 
     public:
-        EmitterNode( ParticlePlayer* pParticlePlayer, ParticleAssetEmitter* pParticleAssetEmitter )
+        EmitterNode( ParticlePlayer* pParticlePlayer, ParticleAssetEmitter* pParticleAssetEmitter ) :
+            mRandom( CoreMath::mGetRandomI() )
         {
             // Sanity!
             AssertFatal( pParticlePlayer != NULL, "EmitterNode() - Cannot have a NULL owner." );
@@ -78,8 +91,8 @@ private:
             // Reset time since last generation.
             mTimeSinceLastGeneration = 0.0f;
 
-            // Reset the node head.
-            mParticleNodeHead.mNextNode = mParticleNodeHead.mPreviousNode = &mParticleNodeHead;
+            // Reset the throttled particle count.
+            mThrottledParticleCount = 0;
         }
 
         ~EmitterNode()
@@ -90,27 +103,40 @@ private:
         inline ParticlePlayer* getOwner( void ) const { return mOwner; }
         inline ParticleAssetEmitter* getAssetEmitter( void ) const { return mpAssetEmitter; }
 
-        inline bool getActiveParticles( void ) const { return mParticleNodeHead.mNextNode != &mParticleNodeHead; }
+        inline bool getActiveParticles( void ) const { return mParticles.getParticleCount() > 0; }
+        inline U32 getParticleCount( void ) const { return mParticles.getParticleCount(); }
+        inline ParticleSystem::ParticleStore& getParticles( void ) { return mParticles; }
 
-        inline ParticleSystem::ParticleNode* getFirstParticle( void ) const { return mParticleNodeHead.mNextNode; }
-        inline ParticleSystem::ParticleNode* getLastParticle( void ) const { return mParticleNodeHead.mPreviousNode; }
-        inline ParticleSystem::ParticleNode* getParticleNodeHead( void ) { return &mParticleNodeHead; }
+        /// Each emitter has its own random stream so emitters can be integrated concurrently.
+        inline RandomLCG& getRandom( void ) { return mRandom; }
 
         inline void setTimeSinceLastGeneration( const F32 timeSinceLastGeneration ) { mTimeSinceLastGeneration = timeSinceLastGeneration; }
         inline F32 getTimeSinceLastGeneration( void ) const { return mTimeSinceLastGeneration; }
 
+        inline void setThrottledParticleCount( const U32 throttledParticleCount ) { mThrottledParticleCount = throttledParticleCount; }
+        inline U32 getThrottledParticleCount( void ) const { return mThrottledParticleCount; }
+
         inline void setPaused( const bool paused ) { mPaused = paused; }
         inline bool getPaused( void ) const { return mPaused; }
 
         inline void setVisible( const bool visible ) { mVisible = visible; }
         inline bool getVisible( void ) const { return mVisible; }
 
-        ParticleSystem::ParticleNode* createParticle( void );
-        void freeParticle( ParticleSystem::ParticleNode* pParticleNode );
-        void freeAllParticles( void );        
+        U32 createParticle( void );
+        void releaseParticle( const U32 particleIndex );
+        void freeAllParticles( void );
     };
 
     typedef Vector<EmitterNode*> typeEmitterVector;
+    typedef Vector<BatchRender::BatchQuad> typeRenderQuadVector;
+
+    /// Emitter integration job context.
+    struct EmitterIntegration
+    {
+        ParticlePlayer* mpParticlePlayer;
+        F32             mElapsedTime;
+        U32*            mpLiveParticleCounts;
+    };
 
     AssetPtr<ParticleAsset>     mParticleAsset;
     typeEmitterVector           mEmitters;
@@ -118,6 +144,13 @@ private:
     bool                        mCameraIdle;
     F32                         mCameraIdleDistance;
 
+    F32                         mLodDistance;
+    F32                         mLodScreenSize;
+    F32                         mLod;
+    U32                         mLodTickInterval;
+    U32                         mLodTickCount;
+    F32                         mLodElapsedTime;
+
     bool						mParticleInterpolation;
 
     bool                        mPlaying;
@@ -130,6 +163,10 @@ private:
 
     bool                        mWaitingForParticles;
     bool                        mWaitingForDelete;
+    U32                         mDeferredActiveParticleCount;
+    U32                         mDeferredThrottledParticleCount;
+
+    typeRenderQuadVector        mRenderQuads;
 
 public:
     ParticlePlayer();
@@ -142,6 +179,7 @@ public:
     virtual void preIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     void interpolateObject( const F32 timeDelta );
+    virtual bool getParallelIntegrateSafe( void ) const { return true; }
 
     virtual bool validRender( void ) const { return mParticleAsset.notNull() && mParticleAsset->isAssetValid(); }
     virtual bool shouldRender( void ) const { return true; }
@@ -154,6 +192,14 @@ public:
     inline void setCameraIdleDistance( const F32 idleDistance ) { mCameraIdleDistance = idleDistance; mCameraIdle = false; }
     inline F32 getCameraIdleDistance( void ) const { return mCameraIdleDistance; }
 
+    /// Level-of-detail.
+    /// The emission and simulation rates are reduced as the player moves away from, or becomes small within, every camera.
+    inline void setLodDistance( const F32 lodDistance ) { mLodDistance = getMax( lodDistance, 0.0f ); }
+    inline F32 getLodDistance( void ) const { return mLodDistance; }
+    inline void setLodScreenSize( const F32 lodScreenSize ) { mLodScreenSize = getMax( lodScreenSize, 0.0f ); }
+    inline F32 getLodScreenSize( void ) const { return mLodScreenSize; }
+    inline F32 getLod( void ) const { return mLod; }
+
     inline void setParticleInterpolation( const bool interpolation ) { mParticleInterpolation = interpolation; }
     inline bool getParticleInterpolation( void ) const { return mParticleInterpolation; }
 
@@ -170,6 +216,7 @@ public:
     inline F32 getTimeScale( void  ) const { return mTimeScale; }
 
     inline const U32 getEmitterCount( void ) const { return (U32)mEmitters.size(); }
+    U32 getParticleCount( void ) const;
 
     void setEmitterPaused( const bool paused, const U32 emitterIndex );
     bool getEmitterPaused( const U32 emitterIndex );
@@ -182,6 +229,11 @@ public:
     inline void setPaused( const bool paused ) { mPaused = paused; }
     inline bool getPaused( void ) const { return mPaused; }
 
+    /// Particle integration.
+    /// The per-particle and batched paths are exposed so that they can be checked against each other.
+    static void integrateParticle( ParticleAsset* pParticleAsset, ParticleAssetEmitter* pParticleAssetEmitter, ParticleSystem::ParticleStore& particles, RandomLCG& random, const F32 forceScale, const U32 particleIndex, const F32 particleAge, const F32 elapsedTime );
+    static void integrateParticles( ParticleAsset* pParticleAsset, ParticleAssetEmitter* pParticleAssetEmitter, ParticleSystem::ParticleStore& particles, RandomLCG& random, const F32 forceScale, const F32 elapsedTime );
+
     /// Declare Console Object.
     DECLARE_CONOBJECT(ParticlePlayer);
 
@@ -190,16 +242,26 @@ protected:
     virtual void OnUnregisterScene( Scene* pScene );
 
     virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
+    virtual void onDeferredIntegration( const U32 deferredFlags );
 
     /// Particle Creation/Integration.
-    void configureParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode );
-    void integrateParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode, const F32 particleAge, const F32 elapsedTime );
+    void configureParticle( EmitterNode* pEmitterNode, const U32 particleIndex );
+    void integrateParticle( EmitterNode* pEmitterNode, const U32 particleIndex, const F32 particleAge, const F32 elapsedTime );
+    void integrateParticles( EmitterNode* pEmitterNode, const F32 elapsedTime );
+    U32 integrateEmitter( EmitterNode* pEmitterNode, const F32 scaledTime );
+    static void integrateEmittersJob( void* pContext, const U32 startIndex, const U32 endIndex );
+    void updateLifeMode( const U32 activeParticleCount );
+    void updateLod( void );
 
     /// Persistence.
     virtual void onTamlAddParent( SimObject* pParentObject );
 
     static bool     setParticle(void* obj, const char* data)                                { static_cast<ParticlePlayer*>( obj )->setParticle(data); return false; };
     static bool     writeCameraIdleDistance( void* obj, StringTableEntry pFieldName )       { return static_cast<ParticlePlayer*>( obj )->getCameraIdleDistance() > 0.0f; }
+    static bool     writeLodDistance( void* obj, StringTableEntry pFieldName )              { return static_cast<ParticlePlayer*>( obj )->getLodDistance() > 0.0f; }
+    static bool     setLodDistance(void* obj, const char* data)                             { static_cast<ParticlePlayer*>( obj )->setLodDistance(dAtof(data)); return false; }
+    static bool     writeLodScreenSize( void* obj, StringTableEntry pFieldName )            { return static_cast<ParticlePlayer*>( obj )->getLodScreenSize() > 0.0f; }
+    static bool     setLodScreenSize(void* obj, const char* data)                           { static_cast<ParticlePlayer*>( obj )->setLodScreenSize(dAtof(data)); return false; }
     static bool     writeParticleInterpolation( void* obj, StringTableEntry pFieldName )    { return static_cast<ParticlePlayer*>( obj )->getParticleInterpolation(); }
     static bool     writeEmissionRateScale( void* obj, StringTableEntry pFieldName )        { return !mIsOne( static_cast<ParticlePlayer*>( obj )->getEmissionRateScale() ); }
     static bool     writeSizeScale( void* obj, StringTableEntry pFieldName )                { return !mIsOne( static_cast<ParticlePlayer*>( obj )->getSizeScale() ); }
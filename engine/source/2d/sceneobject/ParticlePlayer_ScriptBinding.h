@@ -64,6 +64,58 @@ ConsoleMethodWithDocs(ParticlePlayer, getCameraIdleDistance, ConsoleFloat, 2, 2,
 
 //-----------------------------------------------------------------------------
 
+/*! Sets the distance from the nearest camera beyond which the emission and simulation rates are reduced.
+    @param lodDistance The distance from the nearest camera beyond which the level-of-detail is reduced.  Zero disables distance level-of-detail.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(ParticlePlayer, setLodDistance, ConsoleVoid, 3, 3, (lodDistance))
+{
+    object->setLodDistance( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the distance from the nearest camera beyond which the emission and simulation rates are reduced.
+    @return The distance from the nearest camera beyond which the level-of-detail is reduced.
+*/
+ConsoleMethodWithDocs(ParticlePlayer, getLodDistance, ConsoleFloat, 2, 2, ())
+{
+    return object->getLodDistance();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the fraction of the camera view the player size must cover before the emission and simulation rates are reduced.
+    @param lodScreenSize The fraction of the camera view below which the level-of-detail is reduced.  Zero disables screen-size level-of-detail.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(ParticlePlayer, setLodScreenSize, ConsoleVoid, 3, 3, (lodScreenSize))
+{
+    object->setLodScreenSize( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the fraction of the camera view the player size must cover before the emission and simulation rates are reduced.
+    @return The fraction of the camera view below which the level-of-detail is reduced.
+*/
+ConsoleMethodWithDocs(ParticlePlayer, getLodScreenSize, ConsoleFloat, 2, 2, ())
+{
+    return object->getLodScreenSize();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the current level-of-detail.
+    @return The current level-of-detail from one (full detail) down to the minimum level-of-detail.
+*/
+ConsoleMethodWithDocs(ParticlePlayer, getLod, ConsoleFloat, 2, 2, ())
+{
+    return object->getLod();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether the intermediate world position, rotation, and size data points of particles between ticks are calculated.
     @return No return value.
 */
@@ -276,4 +328,75 @@ ConsoleMethodWithDocs(ParticlePlayer, getEmitterVisible, ConsoleBool, 3, 3, (emi
     return object->getEmitterVisible( dAtoi(argv[2]) );
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Plays the specified particle asset in a temporary scene and reports the integration throughput.
+    Only the particle integration is timed, no rendering is performed.
+    @param particleAssetId The particle asset Id to play.
+    @param tickCount The number of ticks to integrate.  Optional: Defaults to 600.
+    @return The number of particles integrated per millisecond or -1 if the particle asset could not be played.
+*/
+ConsoleFunctionWithDocs( benchmarkParticlePlayer, ConsoleFloat, 2, 3, (particleAssetId, [tickCount]?))
+{
+    // Fetch the tick count.
+    const U32 tickCount = argc > 2 ? getMax( dAtoi(argv[2]), 1 ) : 600;
+
+    // Create a scene to play the particles in.
+    Scene* pScene = new Scene();
+    pScene->registerObject();
+
+    // Create the particle player.
+    ParticlePlayer* pParticlePlayer = new ParticlePlayer();
+    pParticlePlayer->registerObject();
+    pParticlePlayer->setParticle( argv[1] );
+
+    // Add to the scene which will start it playing.
+    pScene->addToScene( pParticlePlayer );
+
+    // Is the particle player playing?
+    if ( !pParticlePlayer->getIsPlaying() )
+    {
+        // No, so warn.
+        Con::warnf( "benchmarkParticlePlayer() - Could not play the particle asset '%s'.", argv[1] );
+        pScene->deleteObject();
+        return -1.0f;
+    }
+
+    DebugStats debugStats;
+    U32 particlesIntegrated = 0;
+    U32 peakParticles = 0;
+    U32 totalTime = 0;
+
+    for ( U32 tick = 0; tick < tickCount; ++tick )
+    {
+        const U32 startTime = Platform::getRealMilliseconds();
+
+        // Integrate the particles.
+        pParticlePlayer->integrateObject( tick * Tickable::smTickSec, Tickable::smTickSec, &debugStats );
+
+        totalTime += Platform::getRealMilliseconds() - startTime;
+
+        // Count the particles.
+        const U32 particleCount = pParticlePlayer->getParticleCount();
+        particlesIntegrated += particleCount;
+        peakParticles = getMax( peakParticles, particleCount );
+    }
+
+    const F32 particlesPerMs = (F32)particlesIntegrated / (F32)getMax( totalTime, (U32)1 );
+
+    Con::printf( "Particle Player Benchmark: %s", argv[1] );
+    Con::printf( "  Ticks: %d", tickCount );
+    Con::printf( "  ParticlesIntegrated: %d", particlesIntegrated );
+    Con::printf( "  PeakParticles: %d", peakParticles );
+    Con::printf( "  Time: %dms", totalTime );
+    Con::printf( "  Particles/ms: %0.1f", particlesPerMs );
+
+    // Remove the scene and particle player.
+    pScene->deleteObject();
+
+    return particlesPerMs;
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleMethodGroupEndWithDocs(ParticlePlayer)
\ No newline at end of file
@@ -100,6 +100,7 @@ static StringTableEntry edgeTypeName            = StringTable->insert( "Edge" );
 SceneObject::SceneObject() :
     /// Scene.
     mpScene(NULL),
+    mTickableIndex(-1),
     mpTargetScene(NULL),
 
     /// Lifetime.
@@ -139,6 +140,7 @@ SceneObject::SceneObject() :
     /// Body.
     mpBody(NULL),
     mWorldQueryKey(0),
+    mRenderQueryMovedPosition(U32_MAX),
 
     /// Collision control.
     mCollisionLayerMask(MASK_ALL),
@@ -187,6 +189,16 @@ SceneObject::SceneObject() :
     mBeingSafeDeleted(false),
     mSafeDeleteReady(true),
 
+    /// Parallel integration.
+    mDeferIntegration(false),
+    mDeferredIntegration(0),
+    mDeferredTickDisplacement(0.0f, 0.0f),
+
+    /// Tick interest.
+    mTickInterest(TICK_INTEREST_NONE),
+    mActiveTickInterest(TICK_INTEREST_NONE),
+    mPreTickInterest(TICK_INTEREST_NONE),
+
     /// Miscellaneous.
     mBatchIsolated(false),
     mSerialiseKey(0),
@@ -240,6 +252,10 @@ SceneObject::SceneObject() :
     // Set last awake state.
     mLastAwakeState = !mBodyDefinition.allowSleep || mBodyDefinition.awake;
 
+    // Not in any render query cache.
+    for ( U32 cacheSlot = 0; cacheSlot < WORLD_QUERY_RENDER_QUERY_CACHES; ++cacheSlot )
+        mRenderQueryCacheIndex[cacheSlot] = -1;
+
     // Turn-off auto-sizing.
     mAutoSizing = false;
 
@@ -324,7 +340,7 @@ void SceneObject::initPersistFields()
     addProtectedField("GravityScale", TypeF32, 0, &setGravityScale, &getGravityScale, &writeGravityScale, "");
 
     /// Render visibility.
-    addField("Visible", TypeBool, Offset(mVisible, SceneObject), &writeVisible, "");
+    addProtectedField("Visible", TypeBool, Offset(mVisible, SceneObject), &setVisible, &defaultProtectedGetFn, &writeVisible, "");
 
     /// Render blending.
     addField("BlendMode", TypeBool, Offset(mBlendMode, SceneObject), &writeBlendMode, "");
@@ -420,10 +436,7 @@ void SceneObject::OnRegisterScene( Scene* pScene )
         b2FixtureDef* pFixtureDef = (*itr);
 
         // Create fixture.
-        b2Fixture* pFixture = mpBody->CreateFixture( pFixtureDef );
-
-        // Push fixture.
-        mCollisionFixtures.push_back( pFixture );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy fixture shape.
         delete pFixtureDef->shape;
@@ -513,6 +526,10 @@ void SceneObject::OnUnregisterScene( Scene* pScene )
         mWorldProxyId = -1;
     }
 
+    // Discard any deferred integration.
+    mDeferIntegration = false;
+    mDeferredIntegration = 0;
+
     // Reset scene.
     mpScene = NULL;
 }
@@ -620,9 +637,20 @@ void SceneObject::integrateObject( const F32 totalTime, const F32 elapsedTime, D
 
         // Calculate tick displacement.
         b2Vec2 tickDisplacement = position - mPreTickPosition;
-            
-        // Update world proxy.
-        mpScene->getWorldQuery()->update( this, tickAABB, tickDisplacement );
+
+        // Is integration deferred?
+        if ( mDeferIntegration )
+        {
+            // Yes, so defer the world proxy update as the world query is shared.
+            mDeferredTickAABB = tickAABB;
+            mDeferredTickDisplacement = tickDisplacement;
+            deferIntegrationEvent( DEFERRED_WORLD_QUERY_UPDATE );
+        }
+        else
+        {
+            // No, so update world proxy.
+            mpScene->getWorldQuery()->update( this, tickAABB, tickDisplacement );
+        }
 
         //have we arrived at the target position?
         if (mTargetPositionActive)
@@ -670,6 +698,45 @@ void SceneObject::integrateObject( const F32 totalTime, const F32 elapsedTime, D
 
 //-----------------------------------------------------------------------------
 
+bool SceneObject::canIntegrateParallel( void ) const
+{
+    // The type must be safe and the object must not be attached to anything shared.
+    return getParallelIntegrateSafe() &&
+            mAttachedCtrls.size() == 0 &&
+            mpAttachedCamera == NULL &&
+            mAudioHandles.size() == 0 &&
+            !mTargetPositionActive;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::endDeferredIntegration( void )
+{
+    // Fetch and reset the deferred events.
+    const U32 deferredFlags = mDeferredIntegration;
+    mDeferredIntegration = 0;
+    mDeferIntegration = false;
+
+    // Perform any deferred events.
+    if ( deferredFlags != 0 )
+        onDeferredIntegration( deferredFlags );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::onDeferredIntegration( const U32 deferredFlags )
+{
+    // Update world proxy.
+    if ( deferredFlags & DEFERRED_WORLD_QUERY_UPDATE )
+        mpScene->getWorldQuery()->update( this, mDeferredTickAABB, mDeferredTickDisplacement );
+
+    // Initiate Death!
+    if ( deferredFlags & DEFERRED_LIFETIME_EXPIRED )
+        safeDelete();
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::postIntegrate(const F32 totalTime, const F32 elapsedTime, DebugStats *pDebugStats)
 {
     // Debug Profiling.
@@ -924,6 +991,9 @@ void SceneObject::unpackUpdate(NetConnection * conn, BitStream *stream)
 
 void SceneObject::setEnabled( const bool enabled )
 {
+    // Fetch the current enabled state.
+    const bool wasEnabled = isEnabled();
+
     // Call parent.
     Parent::setEnabled( enabled );
 
@@ -931,11 +1001,30 @@ void SceneObject::setEnabled( const bool enabled )
     if ( mpScene )
     {
         mpBody->SetActive( enabled );
+
+        // Notify the scene if the enabled state changed.
+        if ( wasEnabled != enabled )
+            mpScene->onSceneObjectEnabledChanged( this );
     }
 }
 
 //-----------------------------------------------------------------------------
 
+void SceneObject::setVisible( const bool status )
+{
+    // Ignore no change.
+    if ( status == mVisible )
+        return;
+
+    mVisible = status;
+
+    // Notify the scene.
+    if ( mpScene )
+        mpScene->onSceneObjectVisibilityChanged( this );
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::setLifetime( const F32 lifetime )
 {
     // Debug Profiling.
@@ -973,6 +1062,14 @@ void SceneObject::updateLifetime( const F32 elapsedTime )
             // Yes, so reset lifetime.
             setLifetime( 0.0f );
 
+            // Is integration deferred?
+            if ( mDeferIntegration )
+            {
+                // Yes, so defer the delete request.
+                deferIntegrationEvent( DEFERRED_LIFETIME_EXPIRED );
+                return;
+            }
+
             // Initiate Death!
             safeDelete();
         }
@@ -1878,17 +1975,33 @@ b2Shape::Type SceneObject::getCollisionShapeType( U32 shapeIndex ) const
 
 S32 SceneObject::getCollisionShapeIndex( const b2Fixture* pFixture ) const
 {
-    // Iterate collision shapes.
-    S32 collisionShapeIndex = 0;
-    for( typeCollisionFixtureVector::const_iterator collisionShapeItr = mCollisionFixtures.begin(); collisionShapeItr != mCollisionFixtures.end(); ++collisionShapeItr, ++collisionShapeIndex )
-    {
-        // Return index if this is the collision shape we are searching for.
-        if ( pFixture == *collisionShapeItr )
-            return collisionShapeIndex;
-    }
+    // Fetch the collision shape index held by the fixture.
+    const U32 collisionShapeIndex = (U32)(size_t)pFixture->GetUserData();
 
-    // Not found.
-    return -1;
+    // Finish if the fixture isn't one of ours.
+    if ( collisionShapeIndex >= (U32)mCollisionFixtures.size() || mCollisionFixtures[collisionShapeIndex] != pFixture )
+        return -1;
+
+    return (S32)collisionShapeIndex;
+}
+
+//-----------------------------------------------------------------------------
+
+b2Fixture* SceneObject::createCollisionFixture( const b2FixtureDef* pFixtureDef )
+{
+    // Sanity!
+    AssertFatal( mpBody != NULL, "SceneObject::createCollisionFixture() - Cannot create a fixture without a physics body." );
+
+    // Create the fixture.
+    b2Fixture* pFixture = mpBody->CreateFixture( pFixtureDef );
+
+    // Set the fixture collision shape index.
+    setCollisionFixtureIndex( pFixture, mCollisionFixtures.size() );
+
+    // Push fixture.
+    mCollisionFixtures.push_back( pFixture );
+
+    return pFixture;
 }
 
 //-----------------------------------------------------------------------------
@@ -2192,6 +2305,11 @@ void SceneObject::deleteCollisionShape( const U32 shapeIndex )
     {
         mpBody->DestroyFixture( mCollisionFixtures[ shapeIndex ] );
         mCollisionFixtures.erase_fast( shapeIndex );
+
+        // Update the collision shape index of the fixture moved into the deleted slot.
+        if ( shapeIndex < (U32)mCollisionFixtures.size() )
+            setCollisionFixtureIndex( mCollisionFixtures[ shapeIndex ], shapeIndex );
+
         return;
     }
 
@@ -2240,7 +2358,7 @@ S32 SceneObject::createCircleCollisionShape( const F32 radius, const b2Vec2& loc
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2298,7 +2416,7 @@ S32 SceneObject::createPolygonCollisionShape( const U32 pointCount, const b2Vec2
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2341,7 +2459,7 @@ S32 SceneObject::createPolygonBoxCollisionShape( const F32 width, const F32 heig
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2384,7 +2502,7 @@ S32 SceneObject::createPolygonBoxCollisionShape( const F32 width, const F32 heig
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2427,7 +2545,7 @@ S32 SceneObject::createPolygonBoxCollisionShape( const F32 width, const F32 heig
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2488,7 +2606,7 @@ S32 SceneObject::createChainCollisionShape( const U32 pointCount, const b2Vec2*
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2535,7 +2653,7 @@ S32 SceneObject::createChainCollisionShape(  const U32 pointCount, const b2Vec2*
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2629,7 +2747,7 @@ S32 SceneObject::createEdgeCollisionShape( const b2Vec2& localPositionStart, con
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
@@ -2666,7 +2784,7 @@ S32 SceneObject::createEdgeCollisionShape(   const b2Vec2& localPositionStart, c
     if ( mpScene )
     {
         // Create and push fixture.
-        mCollisionFixtures.push_back( mpBody->CreateFixture( pFixtureDef ) );
+        createCollisionFixture( pFixtureDef );
 
         // Destroy shape and fixture.
         delete pShape;
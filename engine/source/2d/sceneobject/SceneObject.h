@@ -123,6 +123,7 @@ public:
 protected:
     /// Scene.
     SimObjectPtr<Scene>  mpScene;
+    S32                     mTickableIndex;
 
     /// Target Scene.
     /// NOTE:   Unfortunately this is required as the scene can be set via a field which
@@ -177,6 +178,8 @@ protected:
     b2Body*                 mpBody;
     b2BodyDef               mBodyDefinition;
     U32                     mWorldQueryKey;
+    S32                     mRenderQueryCacheIndex[WORLD_QUERY_RENDER_QUERY_CACHES];
+    U32                     mRenderQueryMovedPosition;
 
     /// Collision control.
     U32                     mCollisionLayerMask;
@@ -236,6 +239,17 @@ protected:
     bool                    mBeingSafeDeleted;
     bool                    mSafeDeleteReady;
 
+    /// Parallel integration.
+    bool                    mDeferIntegration;
+    U32                     mDeferredIntegration;
+    b2AABB                  mDeferredTickAABB;
+    b2Vec2                  mDeferredTickDisplacement;
+
+    /// Tick interest.
+    U32                     mTickInterest;
+    U32                     mActiveTickInterest;
+    U32                     mPreTickInterest;
+
     /// Destroy notifications.
     typeDestroyNotificationVector mDestroyNotifyList;
 
@@ -257,10 +271,38 @@ protected:
     virtual void            OnRegisterScene( Scene* pScene );
     virtual void            OnUnregisterScene( Scene* pScene );
 
+    /// Collision fixtures.
+    /// NOTE:   Each live fixture holds its collision shape index as its user data so that a fixture
+    ///         can be mapped to its collision shape index without searching the collision fixtures.
+    b2Fixture*              createCollisionFixture( const b2FixtureDef* pFixtureDef );
+    inline void             setCollisionFixtureIndex( b2Fixture* pFixture, const U32 shapeIndex ) { pFixture->SetUserData( (void*)(size_t)shapeIndex ); }
+
     /// Ticking.
     void                    resetTickSpatials( const bool resize = false );
     inline bool             getSpatialDirty( void ) const { return mSpatialDirty; }
 
+    /// Tick interest.
+    /// NOTE:   Types that override any of the integration stages must declare the interest those stages need
+    ///         as the scene only dispatches the stages an object is interested in.  The declared interest is
+    ///         always dispatched whereas the active interest can be toggled at runtime.
+    inline void             setTickInterest( const U32 tickInterest ) { mTickInterest = tickInterest; }
+    inline void             setActiveTickInterest( const U32 tickInterest, const bool active ) { if ( active ) mActiveTickInterest |= tickInterest; else mActiveTickInterest &= ~tickInterest; }
+
+    /// Parallel integration.
+    /// NOTE:   Whilst integration is deferred, side effects that touch script or shared state are flagged
+    ///         instead and are only performed when the scene ends the deferral on the main thread.
+    enum DeferredIntegrationFlags
+    {
+        DEFERRED_WORLD_QUERY_UPDATE = BIT(0),
+        DEFERRED_LIFETIME_EXPIRED   = BIT(1),
+        DEFERRED_ANIMATION_END      = BIT(2),
+        DEFERRED_PARTICLE_LIFE_MODE = BIT(3),
+        DEFERRED_PARTICLE_STATS     = BIT(4),
+    };
+    inline bool             getDeferIntegration( void ) const { return mDeferIntegration; }
+    inline void             deferIntegrationEvent( const U32 deferredFlag ) { mDeferredIntegration |= deferredFlag; }
+    virtual void            onDeferredIntegration( const U32 deferredFlags );
+
     /// Contact processing.
     void                    initializeContactGathering( void );
 
@@ -288,6 +330,55 @@ public:
     virtual void            interpolateObject( const F32 timeDelta );
     inline bool             getIsEditorTickAllowed( void ) const { return mEditorTickAllowed; }
 
+    /// Tick interest.
+    enum TickInterest
+    {
+        TICK_INTEREST_NONE          = 0,
+        TICK_INTEREST_PHYSICS       = BIT(0),
+        TICK_INTEREST_ANIMATION     = BIT(1),
+        TICK_INTEREST_BEHAVIORS     = BIT(2),
+        TICK_INTEREST_CALLBACKS     = BIT(3),
+        TICK_INTEREST_ALL           = TICK_INTEREST_PHYSICS | TICK_INTEREST_ANIMATION | TICK_INTEREST_BEHAVIORS | TICK_INTEREST_CALLBACKS,
+
+        /// The interest that requires the pre-integrate, integrate and interpolate stages.
+        TICK_INTEREST_INTEGRATION       = TICK_INTEREST_PHYSICS | TICK_INTEREST_ANIMATION,
+
+        /// The interest that requires the post-integrate stage.
+        TICK_INTEREST_POST_INTEGRATION  = TICK_INTEREST_BEHAVIORS | TICK_INTEREST_CALLBACKS,
+    };
+    inline U32              getTickInterest( void ) const
+    {
+        // Start with the declared and active interest.
+        U32 tickInterest = mTickInterest | mActiveTickInterest;
+
+        // Physics if the spatials have changed or the body can move.
+        if ( mSpatialDirty || ( mpBody != NULL && mpBody->IsAwake() && mpBody->GetType() != b2_staticBody ) )
+            tickInterest |= TICK_INTEREST_PHYSICS;
+
+        // Animation if any timed effects or attachments need updating.
+        if ( mLifetimeActive || mFadeActive || mGrowActive || mTargetPositionActive ||
+            mpAttachedCamera != NULL || mAttachedCtrls.size() > 0 || mAudioHandles.size() > 0 )
+            tickInterest |= TICK_INTEREST_ANIMATION;
+
+        // Behaviors if any components need notifying.
+        if ( hasComponents() )
+            tickInterest |= TICK_INTEREST_BEHAVIORS;
+
+        // Callbacks if any script callbacks may be raised.
+        if ( mUpdateCallback || mSleepingCallback || mTargetPositionActive || mFadeActive || mGrowActive )
+            tickInterest |= TICK_INTEREST_CALLBACKS;
+
+        return tickInterest;
+    }
+    inline U32              getIntegrationTickInterest( void ) const { return mPreTickInterest | getTickInterest(); }
+
+    /// Parallel integration.
+    /// NOTE:   Types opt-in only when "integrateObject" touches nothing but their own state.
+    virtual bool            getParallelIntegrateSafe( void ) const { return false; }
+    bool                    canIntegrateParallel( void ) const;
+    inline void             beginDeferredIntegration( void ) { mDeferIntegration = true; }
+    void                    endDeferredIntegration( void );
+
     /// Render batching.
     inline void             setBatchIsolated( const bool batchIsolated ) { mBatchIsolated = batchIsolated; }
     virtual bool            getBatchIsolated( void ) { return mBatchIsolated; }
@@ -522,7 +613,7 @@ public:
     Vector2                 getEdgeCollisionShapeAdjacentEnd( const U32 shapeIndex ) const;
 
     /// Render visibility.
-    inline void             setVisible( const bool status )             { mVisible = status; }
+    void                    setVisible( const bool status );
     inline bool             getVisible(void) const                      { return mVisible; }
 
     /// Render blending.
@@ -744,6 +835,7 @@ protected:
     static bool             writeGravityScale( void* obj, StringTableEntry pFieldName ) { return mNotEqual(static_cast<SceneObject*>(obj)->getGravityScale(), 1.0f); }
 
     /// Render visibility.
+    static bool             setVisible(void* obj, const char* data)         { static_cast<SceneObject*>(obj)->setVisible(dAtob(data)); return false; }
     static bool             writeVisible( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getVisible() == false; }
 
     /// Render blending.
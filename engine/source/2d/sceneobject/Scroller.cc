@@ -62,6 +62,9 @@ Scroller::Scroller() :
 
    // Use fixed rotation by default.
    mBodyDefinition.fixedRotation = true;
+
+   // The scrolling is integrated every tick.
+   setTickInterest( TICK_INTEREST_ANIMATION );
 }
 
 //------------------------------------------------------------------------------
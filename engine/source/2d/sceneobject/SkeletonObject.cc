@@ -46,22 +46,28 @@ IMPLEMENT_CONOBJECT(SkeletonObject);
 
 //------------------------------------------------------------------------------
 
-SkeletonObject::SkeletonObject() :  mPreTickTime( 0.0f ),
+SkeletonObject::SkeletonObject() :  mSkeleton(NULL),
+                                    mState(NULL),
+                                    mPreTickTime( 0.0f ),
                                     mPostTickTime( 0.0f ),
                                     mTimeScale(1),
                                     mLastFrameTime(0),
+                                    mAnimationDuration(0.0),
                                     mTotalAnimationTime(0),
-                                    mSkeleton(NULL),
-                                    mState(NULL),
-                                    mAnimationCycle(false),
                                     mAnimationFinished(true),
-                                    mAnimationDuration(0.0),
+                                    mAnimationCycle(false),
                                     mFlipX(false),
-                                    mFlipY(false)
+                                    mFlipY(false),
+                                    mAnimateWhenVisible(false),
+                                    mInCameraView(true),
+                                    mSharedPose(false)
 {
     mCurrentAnimation = StringTable->insert("");
     mSkeletonScale.SetZero();
     mSkeletonOffset.SetZero();
+
+    // The skeleton is integrated every tick.
+    setTickInterest( TICK_INTEREST_ANIMATION );
 }
 
 //------------------------------------------------------------------------------
@@ -93,6 +99,8 @@ void SkeletonObject::initPersistFields()
     addProtectedField("AnimationCycle", TypeBool, Offset(mAnimationCycle, SkeletonObject), &setAnimationCycle, &defaultProtectedGetFn, &writeAnimationCycle, "Whether the animation loops or not");
     addField("FlipX", TypeBool, Offset(mFlipX, SkeletonObject), &writeFlipX, "");
     addField("FlipY", TypeBool, Offset(mFlipY, SkeletonObject), &writeFlipY, "");
+    addProtectedField("AnimateWhenVisible", TypeBool, Offset(mAnimateWhenVisible, SkeletonObject), &setAnimateWhenVisible, &defaultProtectedGetFn, &writeAnimateWhenVisible, "Whether the skeleton is only animated when within a camera view or not.");
+    addProtectedField("SharedPose", TypeBool, Offset(mSharedPose, SkeletonObject), &setSharedPose, &defaultProtectedGetFn, &writeSharedPose, "Whether the skeleton uses poses shared with other skeletons using the same asset or not.");
 }
 
 //-----------------------------------------------------------------------------
@@ -103,6 +111,9 @@ void SkeletonObject::preIntegrate( const F32 totalTime, const F32 elapsedTime, D
     mPreTickTime = mPostTickTime;
     mPostTickTime = totalTime;
     
+    // Update whether the skeleton is within a camera view.
+    updateCameraView();
+    
     // Update composition at pre-tick time.
     updateComposition( mPreTickTime );
     
@@ -176,6 +187,8 @@ void SkeletonObject::copyTo(SimObject* object)
     pComposite->setCurrentSkin( getCurrentSkin() );
     pComposite->setRootBoneScale( getRootBoneScale() );
     pComposite->setRootBoneOffset( getRootBoneOffset() );
+    pComposite->setAnimateWhenVisible( getAnimateWhenVisible() );
+    pComposite->setSharedPose( getSharedPose() );
 }
 
 //-----------------------------------------------------------------------------
@@ -337,6 +350,7 @@ void SkeletonObject::generateComposition( void )
     // Clear existing visualization
     clearSprites();
     mSkeletonSprites.clear();
+    mSkeletonAttachments.clear();
     
     // Finish if skeleton asset isn't available.
     if ( mSkeletonAsset.isNull() )
@@ -376,30 +390,137 @@ void SkeletonObject::generateComposition( void )
         rootBone->x = mSkeletonOffset.x;
         rootBone->y = mSkeletonOffset.y;
     }
+    
+    // Get the ImageAsset used by the sprites
+    StringTableEntry assetId = (*mSkeletonAsset).mImageAsset.getAssetId();
+    
+    // Create a persistent sprite for each slot.
+    // NOTE:-   Sprites are created in slot order and only updated in-place afterwards so the draw order is stable.
+    mSkeletonSprites.setSize( mSkeleton->slotCount );
+    mSkeletonAttachments.setSize( mSkeleton->slotCount );
+    for (int i = 0; i < mSkeleton->slotCount; ++i)
+    {
+        SpriteBatchItem* pSprite = SpriteBatch::createSprite();
+        pSprite->setImage(assetId);
+        pSprite->setVisible(false);
+        
+        mSkeletonSprites[i] = pSprite;
+        mSkeletonAttachments[i] = NULL;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonObject::updateCameraView( void )
+{
+    // Always in view if not culling the animation.
+    mInCameraView = true;
+    
+    if ( !mAnimateWhenVisible || getScene() == NULL )
+        return;
+    
+    // Fetch scene windows.
+    SimSet& sceneWindows = getScene()->getAttachedSceneWindows();
+    
+    // Fetch the skeleton AABB.
+    const b2AABB aabb = getAABB();
+    
+    // Is the skeleton within any camera view?
+    for( SimSet::iterator itr = sceneWindows.begin(); itr != sceneWindows.end(); itr++ )
+    {
+        // Fetch the scene window.
+        SceneWindow* pSceneWindow = static_cast<SceneWindow*>(*itr);
+        
+        // Calculate the zoomed camera view.
+        const Vector2 cameraExtent = pSceneWindow->getCameraSize() * ( 0.5f / pSceneWindow->getCameraZoom() );
+        const Vector2 cameraPosition = pSceneWindow->getCameraPosition();
+        b2AABB cameraAABB;
+        cameraAABB.lowerBound = cameraPosition - cameraExtent;
+        cameraAABB.upperBound = cameraPosition + cameraExtent;
+        
+        if ( b2TestOverlap( cameraAABB, aabb ) )
+            return;
+    }
+    
+    // Not within any camera view.
+    mInCameraView = false;
+}
+
+//-----------------------------------------------------------------------------
+
+spTrackEntry* SkeletonObject::getSharedPoseTrack( void ) const
+{
+    // Finish if not using shared poses or the root bone is customized.
+    if ( !mSharedPose || mSkeletonScale.notZero() || mSkeletonOffset.notZero() || mState->trackCount == 0 )
+        return NULL;
+    
+    // Finish if the animation is being mixed.
+    spTrackEntry* pTrack = mState->tracks[0];
+    if ( pTrack == NULL || pTrack->previous != NULL )
+        return NULL;
+    
+    // Finish if anything is listening for animation events.
+    // NOTE:-   Events are only fired when the animation state is applied to the skeleton.
+    if ( mState->listener != NULL || pTrack->listener != NULL )
+        return NULL;
+    
+    // Finish if other tracks are playing.
+    for ( S32 i = 1; i < mState->trackCount; ++i )
+    {
+        if ( mState->tracks[i] != NULL )
+            return NULL;
+    }
+    
+    return pTrack;
 }
 
 //-----------------------------------------------------------------------------
 
 void SkeletonObject::updateComposition( const F32 time )
 {
+    // Debug Profiling.
+    PROFILE_SCOPE(SkeletonObject_UpdateComposition);
+    
+    // Finish if the composition hasn't been generated.
+    if ( mSkeleton == NULL || mState == NULL || mSkeletonSprites.size() == 0 )
+        return;
+    
+    // Finish if the skeleton is not visible and is only animated when visible.
+    // NOTE:-   The last frame time is not updated so the animation catches up when back in view.
+    if ( !mInCameraView )
+        return;
+    
     // Update position/orientation/state of visualization
     float delta = (time - mLastFrameTime) * mTimeScale;
     mLastFrameTime = time;
     
     spSkeleton_update(mSkeleton, delta);
     
+    mSkeleton->flipX = getFlipX();
+    mSkeleton->flipY = getFlipY();
+    
     if (!mAnimationFinished)
-    {
         spAnimationState_update(mState, delta);
-        spAnimationState_apply(mState, mSkeleton);
-    }
     
-    spSkeleton_updateWorldTransform(mSkeleton);
-    
-    // Get the ImageAsset used by the sprites
-    StringTableEntry assetId = (*mSkeletonAsset).mImageAsset.getAssetId();
+    // Use a shared pose if possible otherwise evaluate the pose.
+    spTrackEntry* pSharedPoseTrack = getSharedPoseTrack();
+    if ( pSharedPoseTrack != NULL && mSkeletonAsset->applyPose( mSkeleton, pSharedPoseTrack->animation, pSharedPoseTrack->time, pSharedPoseTrack->loop != 0 ) )
+    {
+        // Advance the track as applying the animation state would so that queued animations start and finished tracks are cleared.
+        pSharedPoseTrack->lastTime = pSharedPoseTrack->time;
+    }
+    else
+    {
+        if (!mAnimationFinished)
+            spAnimationState_apply(mState, mSkeleton);
+        
+        spSkeleton_updateWorldTransform(mSkeleton);
+    }
     
-    clearSprites();
+    mSkeleton->r = mBlendColor.red;
+    mSkeleton->g = mBlendColor.green;
+    mSkeleton->b = mBlendColor.blue;
+    mSkeleton->a = mBlendColor.alpha;
     
     Vector2 vertices[4];
     
@@ -408,25 +529,32 @@ void SkeletonObject::updateComposition( const F32 time )
     {
         spSlot* slot = mSkeleton->slots[i];
         spAttachment* attachment = slot->attachment;
+        SpriteBatchItem* pSprite = mSkeletonSprites[i];
         
+        // Hide the slot sprite if there's no region to show.
         if (!attachment || attachment->type != ATTACHMENT_REGION)
+        {
+            pSprite->setVisible(false);
             continue;
+        }
         
         spRegionAttachment* regionAttachment = (spRegionAttachment*)attachment;
         spRegionAttachment_computeWorldVertices(regionAttachment, slot->skeleton->x, slot->skeleton->y, slot->bone, vertexPositions);
         
-        SpriteBatchItem* pSprite = SpriteBatch::createSprite();
-
+        pSprite->setVisible(true);
+        
+        // Only change the frame when the slot attachment changes.
+        if (mSkeletonAttachments[i] != attachment)
+        {
+            pSprite->setNamedImageFrame(attachment->name);
+            mSkeletonAttachments[i] = attachment;
+        }
+        
         pSprite->setDepth(mSceneLayerDepth);
         
         pSprite->setSrcBlendFactor(mSrcBlendFactor);
         pSprite->setDstBlendFactor(mDstBlendFactor);
         
-        mSkeleton->r = mBlendColor.red;
-        mSkeleton->g = mBlendColor.green;
-        mSkeleton->b = mBlendColor.blue;
-        mSkeleton->a = mBlendColor.alpha;
-        
         F32 alpha = mSkeleton->a * slot->a;
         pSprite->setBlendColor(ColorF(
             mSkeleton->r * slot->r * alpha,
@@ -435,9 +563,6 @@ void SkeletonObject::updateComposition( const F32 time )
             alpha
         ));
         
-        mSkeleton->flipX = getFlipX();
-        mSkeleton->flipY = getFlipY();
-        
         vertices[0].x = vertexPositions[VERTEX_X1];
         vertices[0].y = vertexPositions[VERTEX_Y1];
         vertices[1].x = vertexPositions[VERTEX_X4];
@@ -447,9 +572,6 @@ void SkeletonObject::updateComposition( const F32 time )
         vertices[3].x = vertexPositions[VERTEX_X2];
         vertices[3].y = vertexPositions[VERTEX_Y2];
         pSprite->setExplicitVertices(vertices);
-        
-        pSprite->setImage(assetId);
-        pSprite->setNamedImageFrame(attachment->name);
     }
     
     if (mLastFrameTime >= mTotalAnimationTime)
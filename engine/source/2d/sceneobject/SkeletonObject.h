@@ -44,7 +44,11 @@ protected:
     
 private:
     typedef Vector<SpriteBatchItem*> typeSkeletonSpritesVector;
-    typeSkeletonSpritesVector   mSkeletonSprites;
+    typedef Vector<spAttachment*> typeSkeletonAttachmentsVector;
+
+    /// Persistent sprites and their current attachments indexed by skeleton slot.
+    typeSkeletonSpritesVector       mSkeletonSprites;
+    typeSkeletonAttachmentsVector   mSkeletonAttachments;
     
     AssetPtr<SkeletonAsset>     mSkeletonAsset;
     spSkeleton*                 mSkeleton;
@@ -67,6 +71,10 @@ private:
     
     bool                        mFlipX;
     bool                        mFlipY;
+
+    bool                        mAnimateWhenVisible;
+    bool                        mInCameraView;
+    bool                        mSharedPose;
     
     
     
@@ -120,6 +128,17 @@ public:
     
     inline void setAnimationCycle( const bool isLooping ) { mAnimationCycle = isLooping; }
     inline bool getAnimationCycle( void ) const {return mAnimationCycle; };
+
+    /// Animation culling.
+    inline void setAnimateWhenVisible( const bool animateWhenVisible ) { mAnimateWhenVisible = animateWhenVisible; mInCameraView = true; }
+    inline bool getAnimateWhenVisible( void ) const { return mAnimateWhenVisible; }
+
+    /// Shared pose evaluation.
+    /// NOTE:   Shared poses are sampled by the skeleton asset so are only used when playing a single unmixed
+    ///         animation without a root bone scale or offset and with no animation state listeners.
+    ///         The track time still advances so queued and non-looping animations finish as usual.
+    inline void setSharedPose( const bool sharedPose ) { mSharedPose = sharedPose; }
+    inline bool getSharedPose( void ) const { return mSharedPose; }
     
     void onAnimationFinished();
     
@@ -129,6 +148,8 @@ public:
 protected:
     void generateComposition( void );
     void updateComposition( const F32 time );
+    void updateCameraView( void );
+    spTrackEntry* getSharedPoseTrack( void ) const;
     
 protected:
     static bool setSkeletonAsset( void* obj, const char* data )                  { static_cast<SkeletonObject*>(obj)->setSkeletonAsset(data); return false; }
@@ -154,6 +175,12 @@ protected:
     static bool setAnimationCycle( void* obj, const char* data )                 { static_cast<SkeletonObject*>(obj)->setAnimationCycle( dAtob(data) ); return false; }
     static bool writeAnimationCycle( void* obj, StringTableEntry pFieldName )    { return static_cast<SkeletonObject*>(obj)->getAnimationCycle() == false; }
     
+    static bool setAnimateWhenVisible( void* obj, const char* data )             { static_cast<SkeletonObject*>(obj)->setAnimateWhenVisible( dAtob(data) ); return false; }
+    static bool writeAnimateWhenVisible( void* obj, StringTableEntry pFieldName ) { return static_cast<SkeletonObject*>(obj)->getAnimateWhenVisible() == true; }
+
+    static bool setSharedPose( void* obj, const char* data )                     { static_cast<SkeletonObject*>(obj)->setSharedPose( dAtob(data) ); return false; }
+    static bool writeSharedPose( void* obj, StringTableEntry pFieldName )        { return static_cast<SkeletonObject*>(obj)->getSharedPose() == true; }
+
     static bool writeFlipX( void* obj, StringTableEntry pFieldName )             { return static_cast<SkeletonObject*>(obj)->getFlipX() == true; }
     static bool writeFlipY( void* obj, StringTableEntry pFieldName )             { return static_cast<SkeletonObject*>(obj)->getFlipY() == true; }
 };
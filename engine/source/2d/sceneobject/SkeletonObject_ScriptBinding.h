@@ -297,6 +297,50 @@ ConsoleMethodWithDocs(SkeletonObject, getAnimationDuration, ConsoleFloat, 2, 2,
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether the skeleton is only animated when within a camera view or not.
+    When enabled, the skeleton pose is not updated whilst off-screen and catches up when back in view.
+    @param animateWhenVisible Whether the skeleton is only animated when within a camera view or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SkeletonObject, setAnimateWhenVisible, ConsoleVoid, 3, 3, (bool animateWhenVisible))
+{
+    object->setAnimateWhenVisible( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the skeleton is only animated when within a camera view or not.
+    @return Whether the skeleton is only animated when within a camera view or not.
+*/
+ConsoleMethodWithDocs(SkeletonObject, getAnimateWhenVisible, ConsoleBool, 2, 2, ())
+{
+    return object->getAnimateWhenVisible();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the skeleton uses poses shared with other skeletons using the same asset or not.
+    Shared poses are sampled at the asset pose sample rate and are only used when playing a single unmixed animation without a root bone scale or offset.  Animation events are not fired from shared poses.
+    @param sharedPose Whether the skeleton uses shared poses or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SkeletonObject, setSharedPose, ConsoleVoid, 3, 3, (bool sharedPose))
+{
+    object->setSharedPose( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the skeleton uses poses shared with other skeletons using the same asset or not.
+    @return Whether the skeleton uses shared poses or not.
+*/
+ConsoleMethodWithDocs(SkeletonObject, getSharedPose, ConsoleBool, 2, 2, ())
+{
+    return object->getSharedPose();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Mixes the current animation with another.
     @param animation The name of the animation to mix.
     @param time The time to start mixing.
@@ -53,6 +53,9 @@ Trigger::Trigger()
 
     // Gather contacts.
     mGatherContacts = true;
+
+    // The contact callbacks are processed every tick.
+    setTickInterest( TICK_INTEREST_PHYSICS | TICK_INTEREST_CALLBACKS );
 }
 
 //-----------------------------------------------------------------------------
@@ -84,6 +84,10 @@ typedef double float64;
 /// Maximum number of contacts to be handled to solve a TOI impact.
 #define b2_maxTOIContacts			32
 
+/// Maximum number of threads the islands are solved across. Each thread
+/// solves a contiguous partition of the islands with its own stack allocator.
+#define b2_maxSolverThreads			16
+
 /// A velocity threshold for elastic collisions. Any collision with a relative linear
 /// velocity below this threshold will be treated as inelastic.
 #define b2_velocityThreshold		1.0f
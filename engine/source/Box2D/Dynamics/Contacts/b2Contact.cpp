@@ -160,7 +160,15 @@ b2Contact::b2Contact(b2Fixture* fA, int32 indexA, b2Fixture* fB, int32 indexB)
 // Note: do not assume the fixture AABBs are overlapping or are valid.
 void b2Contact::Update(b2ContactListener* listener)
 {
-	b2Manifold oldManifold = m_manifold;
+	b2Manifold oldManifold;
+	int32 events = UpdateManifold(&oldManifold);
+	ReportUpdate(events, &oldManifold, listener);
+}
+
+int32 b2Contact::UpdateManifold(b2Manifold* oldManifold)
+{
+	*oldManifold = m_manifold;
+	int32 events = 0;
 
 	// Re-enable this contact.
 	m_flags |= e_enabledFlag;
@@ -201,9 +209,9 @@ void b2Contact::Update(b2ContactListener* listener)
 			mp2->tangentImpulse = 0.0f;
 			b2ContactID id2 = mp2->id;
 
-			for (int32 j = 0; j < oldManifold.pointCount; ++j)
+			for (int32 j = 0; j < oldManifold->pointCount; ++j)
 			{
-				b2ManifoldPoint* mp1 = oldManifold.points + j;
+				b2ManifoldPoint* mp1 = oldManifold->points + j;
 
 				if (mp1->id.key == id2.key)
 				{
@@ -216,8 +224,7 @@ void b2Contact::Update(b2ContactListener* listener)
 
 		if (touching != wasTouching)
 		{
-			bodyA->SetAwake(true);
-			bodyB->SetAwake(true);
+			events |= e_wakeEvent;
 		}
 	}
 
@@ -230,18 +237,49 @@ void b2Contact::Update(b2ContactListener* listener)
 		m_flags &= ~e_touchingFlag;
 	}
 
-	if (wasTouching == false && touching == true && listener)
+	if (wasTouching == false && touching == true)
+	{
+		events |= e_beginEvent;
+	}
+
+	if (wasTouching == true && touching == false)
+	{
+		events |= e_endEvent;
+	}
+
+	if (sensor == false && touching)
+	{
+		events |= e_preSolveEvent;
+	}
+
+	return events;
+}
+
+void b2Contact::ReportUpdate(int32 events, const b2Manifold* oldManifold, b2ContactListener* listener)
+{
+	if (events & e_wakeEvent)
+	{
+		m_fixtureA->GetBody()->SetAwake(true);
+		m_fixtureB->GetBody()->SetAwake(true);
+	}
+
+	if (listener == NULL)
+	{
+		return;
+	}
+
+	if (events & e_beginEvent)
 	{
 		listener->BeginContact(this);
 	}
 
-	if (wasTouching == true && touching == false && listener)
+	if (events & e_endEvent)
 	{
 		listener->EndContact(this);
 	}
 
-	if (sensor == false && touching && listener)
+	if (events & e_preSolveEvent)
 	{
-		listener->PreSolve(this, &oldManifold);
+		listener->PreSolve(this, oldManifold);
 	}
 }
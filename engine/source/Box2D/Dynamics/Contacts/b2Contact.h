@@ -173,6 +173,22 @@ protected:
 		e_toiFlag			= 0x0020
 	};
 
+	// Events produced by updating the contact.
+	enum
+	{
+		// The bodies must be woken because the touching state changed.
+		e_wakeEvent			= 0x0001,
+
+		// The shapes started touching.
+		e_beginEvent		= 0x0002,
+
+		// The shapes stopped touching.
+		e_endEvent			= 0x0004,
+
+		// The contact is touching and not a sensor.
+		e_preSolveEvent		= 0x0008
+	};
+
 	/// Flag this contact for filtering. Filtering will occur the next time step.
 	void FlagForFiltering();
 
@@ -189,6 +205,15 @@ protected:
 
 	void Update(b2ContactListener* listener);
 
+	/// Update the manifold and touching state without waking the bodies or calling
+	/// the listener. This only writes to the contact so it can be called concurrently
+	/// for different contacts.
+	/// @return the events to pass to ReportUpdate.
+	int32 UpdateManifold(b2Manifold* oldManifold);
+
+	/// Wake the bodies and call the listener for the events of an update.
+	void ReportUpdate(int32 events, const b2Manifold* oldManifold, b2ContactListener* listener);
+
 	static b2ContactRegister s_registers[b2Shape::e_typeCount][b2Shape::e_typeCount];
 	static bool s_initialized;
 
@@ -32,6 +32,14 @@ b2ContactManager::b2ContactManager()
 	m_contactFilter = &b2_defaultFilter;
 	m_contactListener = &b2_defaultListener;
 	m_allocator = NULL;
+	m_taskExecutor = NULL;
+	m_updates = NULL;
+	m_updateCapacity = 0;
+}
+
+b2ContactManager::~b2ContactManager()
+{
+	b2Free(m_updates);
 }
 
 void b2ContactManager::Destroy(b2Contact* c)
@@ -104,69 +112,148 @@ void b2ContactManager::Destroy(b2Contact* c)
 // contact list.
 void b2ContactManager::Collide()
 {
+	if (m_taskExecutor && m_taskExecutor->GetThreadCount() > 1)
+	{
+		CollideParallel();
+		return;
+	}
+
 	// Update awake contacts.
 	b2Contact* c = m_contactList;
 	while (c)
 	{
-		b2Fixture* fixtureA = c->GetFixtureA();
-		b2Fixture* fixtureB = c->GetFixtureB();
-		int32 indexA = c->GetChildIndexA();
-		int32 indexB = c->GetChildIndexB();
-		b2Body* bodyA = fixtureA->GetBody();
-		b2Body* bodyB = fixtureB->GetBody();
-		 
-		// Is this contact flagged for filtering?
-		if (c->m_flags & b2Contact::e_filterFlag)
+		b2Contact* cNext = c->GetNext();
+
+		int32 action = PrepareContact(c);
+		if (action == e_destroyContact)
+		{
+			Destroy(c);
+		}
+		else if (action == e_updateContact)
+		{
+			c->Update(m_contactListener);
+		}
+
+		c = cNext;
+	}
+}
+
+void b2ContactManager::CollideParallel()
+{
+	if (m_contactCount > m_updateCapacity)
+	{
+		b2Free(m_updates);
+		m_updateCapacity = b2Max(m_contactCount, 2 * m_updateCapacity);
+		m_updates = (b2ContactUpdate*)b2Alloc(m_updateCapacity * sizeof(b2ContactUpdate));
+	}
+
+	// Decide what to do with each contact in list order. Contacts are destroyed
+	// later so the end contact events keep their place in the list.
+	int32 updateCount = 0;
+	for (b2Contact* c = m_contactList; c; c = c->GetNext())
+	{
+		b2ContactUpdate* update = m_updates + updateCount++;
+		update->contact = c;
+		update->action = PrepareContact(c);
+	}
+
+	// Update the manifolds. This only touches the contacts themselves.
+	m_taskExecutor->ParallelFor(updateCount, 64, UpdateContacts, m_updates);
+
+	// Report the events in list order so the listener sees the same sequence as
+	// a serial update.
+	for (int32 i = 0; i < updateCount; ++i)
+	{
+		b2ContactUpdate* update = m_updates + i;
+		b2Contact* c = update->contact;
+
+		if (update->action == e_destroyContact)
+		{
+			Destroy(c);
+		}
+		else if (update->action == e_updateContact)
 		{
-			// Should these bodies collide?
-			if (bodyB->ShouldCollide(bodyA) == false)
+			c->ReportUpdate(update->events, &update->oldManifold, m_contactListener);
+		}
+		else
+		{
+			// An earlier contact in the list may have woken one of the bodies.
+			int32 action = PrepareContact(c);
+			if (action == e_destroyContact)
 			{
-				b2Contact* cNuke = c;
-				c = cNuke->GetNext();
-				Destroy(cNuke);
-				continue;
+				Destroy(c);
 			}
-
-			// Check user filtering.
-			if (m_contactFilter && m_contactFilter->ShouldCollide(fixtureA, fixtureB) == false)
+			else if (action == e_updateContact)
 			{
-				b2Contact* cNuke = c;
-				c = cNuke->GetNext();
-				Destroy(cNuke);
-				continue;
+				c->Update(m_contactListener);
 			}
-
-			// Clear the filtering flag.
-			c->m_flags &= ~b2Contact::e_filterFlag;
 		}
+	}
+}
 
-		bool activeA = bodyA->IsAwake() && bodyA->m_type != b2_staticBody;
-		bool activeB = bodyB->IsAwake() && bodyB->m_type != b2_staticBody;
+void b2ContactManager::UpdateContacts(void* context, int32 startIndex, int32 endIndex)
+{
+	b2ContactUpdate* updates = (b2ContactUpdate*)context;
 
-		// At least one body must be awake and it must be dynamic or kinematic.
-		if (activeA == false && activeB == false)
+	for (int32 i = startIndex; i < endIndex; ++i)
+	{
+		b2ContactUpdate* update = updates + i;
+		if (update->action == e_updateContact)
 		{
-			c = c->GetNext();
-			continue;
+			update->events = update->contact->UpdateManifold(&update->oldManifold);
 		}
+	}
+}
 
-		int32 proxyIdA = fixtureA->m_proxies[indexA].proxyId;
-		int32 proxyIdB = fixtureB->m_proxies[indexB].proxyId;
-		bool overlap = m_broadPhase.TestOverlap(proxyIdA, proxyIdB);
+int32 b2ContactManager::PrepareContact(b2Contact* c)
+{
+	b2Fixture* fixtureA = c->GetFixtureA();
+	b2Fixture* fixtureB = c->GetFixtureB();
+	int32 indexA = c->GetChildIndexA();
+	int32 indexB = c->GetChildIndexB();
+	b2Body* bodyA = fixtureA->GetBody();
+	b2Body* bodyB = fixtureB->GetBody();
+	 
+	// Is this contact flagged for filtering?
+	if (c->m_flags & b2Contact::e_filterFlag)
+	{
+		// Should these bodies collide?
+		if (bodyB->ShouldCollide(bodyA) == false)
+		{
+			return e_destroyContact;
+		}
 
-		// Here we destroy contacts that cease to overlap in the broad-phase.
-		if (overlap == false)
+		// Check user filtering.
+		if (m_contactFilter && m_contactFilter->ShouldCollide(fixtureA, fixtureB) == false)
 		{
-			b2Contact* cNuke = c;
-			c = cNuke->GetNext();
-			Destroy(cNuke);
-			continue;
+			return e_destroyContact;
 		}
 
-		// The contact persists.
-		c->Update(m_contactListener);
-		c = c->GetNext();
+		// Clear the filtering flag.
+		c->m_flags &= ~b2Contact::e_filterFlag;
 	}
+
+	bool activeA = bodyA->IsAwake() && bodyA->m_type != b2_staticBody;
+	bool activeB = bodyB->IsAwake() && bodyB->m_type != b2_staticBody;
+
+	// At least one body must be awake and it must be dynamic or kinematic.
+	if (activeA == false && activeB == false)
+	{
+		return e_skipContact;
+	}
+
+	int32 proxyIdA = fixtureA->m_proxies[indexA].proxyId;
+	int32 proxyIdB = fixtureB->m_proxies[indexB].proxyId;
+	bool overlap = m_broadPhase.TestOverlap(proxyIdA, proxyIdB);
+
+	// Here we destroy contacts that cease to overlap in the broad-phase.
+	if (overlap == false)
+	{
+		return e_destroyContact;
+	}
+
+	// The contact persists.
+	return e_updateContact;
 }
 
 void b2ContactManager::FindNewContacts()
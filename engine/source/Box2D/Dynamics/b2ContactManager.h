@@ -25,12 +25,31 @@ class b2Contact;
 class b2ContactFilter;
 class b2ContactListener;
 class b2BlockAllocator;
+class b2TaskExecutor;
+
+// A contact gathered for the parallel narrow phase.
+struct b2ContactUpdate
+{
+	b2Contact* contact;
+	int32 action;
+	int32 events;
+	b2Manifold oldManifold;
+};
 
 // Delegate of b2World.
 class b2ContactManager
 {
 public:
+	// What to do with a contact during the narrow phase.
+	enum
+	{
+		e_skipContact,
+		e_updateContact,
+		e_destroyContact
+	};
+
 	b2ContactManager();
+	~b2ContactManager();
 
 	// Broad-phase callback.
 	void AddPair(void* proxyUserDataA, void* proxyUserDataB);
@@ -40,6 +59,14 @@ public:
 	void Destroy(b2Contact* c);
 
 	void Collide();
+
+	// Update the contacts across the task executor then report the events in list order.
+	void CollideParallel();
+
+	// Filter a contact and check that it needs updating.
+	int32 PrepareContact(b2Contact* c);
+
+	static void UpdateContacts(void* context, int32 startIndex, int32 endIndex);
             
 	b2BroadPhase m_broadPhase;
 	b2Contact* m_contactList;
@@ -47,6 +74,10 @@ public:
 	b2ContactFilter* m_contactFilter;
 	b2ContactListener* m_contactListener;
 	b2BlockAllocator* m_allocator;
+	b2TaskExecutor* m_taskExecutor;
+
+	b2ContactUpdate* m_updates;
+	int32 m_updateCapacity;
 };
 
 #endif
@@ -27,6 +27,7 @@ class b2Contact;
 class b2Joint;
 class b2StackAllocator;
 class b2ContactListener;
+struct b2ContactImpulse;
 struct b2ContactVelocityConstraint;
 struct b2Profile;
 
@@ -35,7 +36,7 @@ class b2Island
 {
 public:
 	b2Island(int32 bodyCapacity, int32 contactCapacity, int32 jointCapacity,
-			b2StackAllocator* allocator, b2ContactListener* listener);
+			b2StackAllocator* allocator, b2ContactListener* listener, int32 staticCapacity = 0);
 	~b2Island();
 
 	void Clear()
@@ -69,11 +70,28 @@ public:
 		m_joints[m_jointCount++] = joint;
 	}
 
+	/// Add a static body that has been assigned a shared slot below the island
+	/// bodies (a negative island index). The body is read but never written so
+	/// it can be shared by islands being solved on other threads.
+	void AddStatic(b2Body* body)
+	{
+		b2Assert(body->m_type == b2_staticBody);
+		b2Assert(body->m_islandIndex < 0 && -body->m_islandIndex <= m_staticCapacity);
+		int32 index = body->m_islandIndex;
+		m_positions[index].c = body->m_sweep.c;
+		m_positions[index].a = body->m_sweep.a;
+		m_velocities[index].v = body->m_linearVelocity;
+		m_velocities[index].w = body->m_angularVelocity;
+	}
+
 	void Report(const b2ContactVelocityConstraint* constraints);
 
 	b2StackAllocator* m_allocator;
 	b2ContactListener* m_listener;
 
+	// When set the contact impulses are stored here instead of being reported.
+	b2ContactImpulse* m_impulses;
+
 	b2Body** m_bodies;
 	b2Contact** m_contacts;
 	b2Joint** m_joints;
@@ -88,6 +106,7 @@ public:
 	int32 m_bodyCapacity;
 	int32 m_contactCapacity;
 	int32 m_jointCapacity;
+	int32 m_staticCapacity;
 };
 
 #endif
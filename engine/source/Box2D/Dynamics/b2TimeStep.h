@@ -32,6 +32,9 @@ struct b2Profile
 	float32 solvePosition;
 	float32 broadphase;
 	float32 solveTOI;
+	int32 islandCount;
+	int32 solveThreadCount;
+	float32 solveThreads[b2_maxSolverThreads];
 };
 
 /// This is an internal structure.
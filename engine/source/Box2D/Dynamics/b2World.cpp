@@ -34,11 +34,124 @@
 #include <Box2D/Common/b2Timer.h>
 #include <new>
 
+// An island gathered for the parallel solver. The ranges index the flat
+// arrays filled in during the island search.
+struct b2SolverIsland
+{
+	int32 bodyStart;
+	int32 bodyCount;
+	int32 staticStart;
+	int32 staticCount;
+	int32 contactStart;
+	int32 contactCount;
+	int32 jointStart;
+	int32 jointCount;
+};
+
+// A contiguous range of islands solved on a single thread.
+struct b2SolverPartition
+{
+	b2StackAllocator* allocator;
+	int32 islandStart;
+	int32 islandCount;
+	int32 bodyCapacity;
+	int32 contactCapacity;
+	int32 jointCapacity;
+	b2Profile profile;
+	float32 time;
+};
+
+struct b2SolverContext
+{
+	const b2TimeStep* step;
+	b2Vec2 gravity;
+	bool allowSleep;
+
+	b2SolverIsland* islands;
+	b2SolverPartition* partitions;
+
+	b2Body** bodies;
+	b2Body** statics;
+	b2Contact** contacts;
+	b2Joint** joints;
+	b2ContactImpulse* impulses;
+
+	int32 staticSlotCount;
+};
+
+// Solve the islands of the partitions [startIndex, endIndex). The contact impulses
+// are stored rather than reported as the listener is not thread safe.
+static void b2SolveIslandPartitions(void* context, int32 startIndex, int32 endIndex)
+{
+	b2SolverContext* solver = (b2SolverContext*)context;
+
+	for (int32 p = startIndex; p < endIndex; ++p)
+	{
+		b2SolverPartition* partition = solver->partitions + p;
+
+		b2Timer timer;
+
+		b2Island island(partition->bodyCapacity,
+						partition->contactCapacity,
+						partition->jointCapacity,
+						partition->allocator,
+						NULL,
+						solver->staticSlotCount);
+
+		partition->profile.solveInit = 0.0f;
+		partition->profile.solveVelocity = 0.0f;
+		partition->profile.solvePosition = 0.0f;
+
+		int32 islandEnd = partition->islandStart + partition->islandCount;
+		for (int32 i = partition->islandStart; i < islandEnd; ++i)
+		{
+			const b2SolverIsland* solverIsland = solver->islands + i;
+
+			island.Clear();
+			island.m_impulses = solver->impulses ? solver->impulses + solverIsland->contactStart : NULL;
+
+			for (int32 j = 0; j < solverIsland->bodyCount; ++j)
+			{
+				island.Add(solver->bodies[solverIsland->bodyStart + j]);
+			}
+
+			for (int32 j = 0; j < solverIsland->staticCount; ++j)
+			{
+				island.AddStatic(solver->statics[solverIsland->staticStart + j]);
+			}
+
+			for (int32 j = 0; j < solverIsland->contactCount; ++j)
+			{
+				island.Add(solver->contacts[solverIsland->contactStart + j]);
+			}
+
+			for (int32 j = 0; j < solverIsland->jointCount; ++j)
+			{
+				island.Add(solver->joints[solverIsland->jointStart + j]);
+			}
+
+			b2Profile profile;
+			island.Solve(&profile, *solver->step, solver->gravity, solver->allowSleep);
+			partition->profile.solveInit += profile.solveInit;
+			partition->profile.solveVelocity += profile.solveVelocity;
+			partition->profile.solvePosition += profile.solvePosition;
+		}
+
+		partition->time = timer.GetMilliseconds();
+	}
+}
+
 b2World::b2World(const b2Vec2& gravity)
 {
 	m_destructionListener = NULL;
 	m_debugDraw = NULL;
 
+	m_taskExecutor = NULL;
+	for (int32 i = 0; i < b2_maxSolverThreads; ++i)
+	{
+		m_solverAllocators[i] = NULL;
+	}
+
 	m_bodyList = NULL;
 	m_jointList = NULL;
 
@@ -82,6 +195,15 @@ b2World::~b2World()
 
 		b = bNext;
 	}
+
+	for (int32 i = 0; i < b2_maxSolverThreads; ++i)
+	{
+		if (m_solverAllocators[i])
+		{
+			m_solverAllocators[i]->~b2StackAllocator();
+			b2Free(m_solverAllocators[i]);
+		}
+	}
 }
 
 void b2World::SetDestructionListener(b2DestructionListener* listener)
@@ -99,6 +221,28 @@ void b2World::SetContactListener(b2ContactListener* listener)
 	m_contactManager.m_contactListener = listener;
 }
 
+void b2World::SetTaskExecutor(b2TaskExecutor* executor)
+{
+	m_taskExecutor = executor;
+}
+
+void b2World::SetCollideTaskExecutor(b2TaskExecutor* executor)
+{
+	m_contactManager.m_taskExecutor = executor;
+}
+
+b2StackAllocator* b2World::GetSolverAllocator(int32 index)
+{
+	b2Assert(0 <= index && index < b2_maxSolverThreads);
+	if (m_solverAllocators[index] == NULL)
+	{
+		void* mem = b2Alloc(sizeof(b2StackAllocator));
+		m_solverAllocators[index] = new (mem) b2StackAllocator;
+	}
+
+	return m_solverAllocators[index];
+}
+
 void b2World::SetDebugDraw(b2Draw* debugDraw)
 {
 	m_debugDraw = debugDraw;
@@ -388,6 +532,11 @@ void b2World::Solve(const b2TimeStep& step)
 	m_profile.solveInit = 0.0f;
 	m_profile.solveVelocity = 0.0f;
 	m_profile.solvePosition = 0.0f;
+	m_profile.islandCount = 0;
+	m_profile.solveThreadCount = 0;
+
+	// The islands are gathered and solved across threads if there is more than one.
+	bool parallel = m_taskExecutor != NULL && m_taskExecutor->GetThreadCount() > 1;
 
 	// Size the island for the worst case.
 	b2Island island(m_bodyCount,
@@ -413,6 +562,28 @@ void b2World::Solve(const b2TimeStep& step)
 	// Build and simulate all awake islands.
 	int32 stackSize = m_bodyCount;
 	b2Body** stack = (b2Body**)m_stackAllocator.Allocate(stackSize * sizeof(b2Body*));
+
+	// Storage for the gathered islands. Each island holds at least one non-static body and
+	// each time a static body is found in an island it was reached through a contact or joint.
+	b2SolverContext solver;
+	int32 islandCount = 0;
+	int32 bodyCount = 0;
+	int32 staticCount = 0;
+	int32 contactCount = 0;
+	int32 jointCount = 0;
+	if (parallel)
+	{
+		solver.islands = (b2SolverIsland*)m_stackAllocator.Allocate(m_bodyCount * sizeof(b2SolverIsland));
+		solver.bodies = (b2Body**)m_stackAllocator.Allocate(m_bodyCount * sizeof(b2Body*));
+		solver.statics = (b2Body**)m_stackAllocator.Allocate((m_contactManager.m_contactCount + m_jointCount) * sizeof(b2Body*));
+		solver.contacts = (b2Contact**)m_stackAllocator.Allocate(m_contactManager.m_contactCount * sizeof(b2Contact*));
+		solver.joints = (b2Joint**)m_stackAllocator.Allocate(m_jointCount * sizeof(b2Joint*));
+		solver.impulses = NULL;
+		if (m_contactManager.m_contactListener)
+		{
+			solver.impulses = (b2ContactImpulse*)m_stackAllocator.Allocate(m_contactManager.m_contactCount * sizeof(b2ContactImpulse));
+		}
+	}
 	for (b2Body* seed = m_bodyList; seed; seed = seed->m_next)
 	{
 		if (seed->m_flags & b2Body::e_islandFlag)
@@ -527,11 +698,53 @@ void b2World::Solve(const b2TimeStep& step)
 			}
 		}
 
-		b2Profile profile;
-		island.Solve(&profile, step, m_gravity, m_allowSleep);
-		m_profile.solveInit += profile.solveInit;
-		m_profile.solveVelocity += profile.solveVelocity;
-		m_profile.solvePosition += profile.solvePosition;
+		++m_profile.islandCount;
+
+		if (parallel)
+		{
+			// Gather the island to be solved later.
+			b2SolverIsland* solverIsland = solver.islands + islandCount++;
+			solverIsland->bodyStart = bodyCount;
+			solverIsland->staticStart = staticCount;
+			solverIsland->contactStart = contactCount;
+			solverIsland->jointStart = jointCount;
+
+			for (int32 i = 0; i < island.m_bodyCount; ++i)
+			{
+				b2Body* b = island.m_bodies[i];
+				if (b->GetType() == b2_staticBody)
+				{
+					solver.statics[staticCount++] = b;
+				}
+				else
+				{
+					solver.bodies[bodyCount++] = b;
+				}
+			}
+
+			for (int32 i = 0; i < island.m_contactCount; ++i)
+			{
+				solver.contacts[contactCount++] = island.m_contacts[i];
+			}
+
+			for (int32 i = 0; i < island.m_jointCount; ++i)
+			{
+				solver.joints[jointCount++] = island.m_joints[i];
+			}
+
+			solverIsland->bodyCount = bodyCount - solverIsland->bodyStart;
+			solverIsland->staticCount = staticCount - solverIsland->staticStart;
+			solverIsland->contactCount = contactCount - solverIsland->contactStart;
+			solverIsland->jointCount = jointCount - solverIsland->jointStart;
+		}
+		else
+		{
+			b2Profile profile;
+			island.Solve(&profile, step, m_gravity, m_allowSleep);
+			m_profile.solveInit += profile.solveInit;
+			m_profile.solveVelocity += profile.solveVelocity;
+			m_profile.solvePosition += profile.solvePosition;
+		}
 
 		// Post solve cleanup.
 		for (int32 i = 0; i < island.m_bodyCount; ++i)
@@ -545,6 +758,26 @@ void b2World::Solve(const b2TimeStep& step)
 		}
 	}
 
+	if (parallel)
+	{
+		SolveIslands(step, &solver, islandCount, staticCount);
+
+		if (solver.impulses)
+		{
+			m_stackAllocator.Free(solver.impulses);
+		}
+		m_stackAllocator.Free(solver.joints);
+		m_stackAllocator.Free(solver.contacts);
+		m_stackAllocator.Free(solver.statics);
+		m_stackAllocator.Free(solver.bodies);
+		m_stackAllocator.Free(solver.islands);
+	}
+	else
+	{
+		m_profile.solveThreadCount = 1;
+		m_profile.solveThreads[0] = m_profile.solveInit + m_profile.solveVelocity + m_profile.solvePosition;
+	}
+
 	m_stackAllocator.Free(stack);
 
 	{
@@ -573,6 +806,118 @@ void b2World::Solve(const b2TimeStep& step)
 	}
 }
 
+void b2World::SolveIslands(const b2TimeStep& step, b2SolverContext* solver, int32 islandCount, int32 staticCount)
+{
+	if (islandCount == 0)
+	{
+		return;
+	}
+
+	// Give each static body a slot below the island bodies. The island search leaves
+	// every static body with a non-negative island index so each is only assigned once.
+	int32 staticSlotCount = 0;
+	for (int32 i = 0; i < staticCount; ++i)
+	{
+		b2Body* b = solver->statics[i];
+		if (b->m_islandIndex >= 0)
+		{
+			b->m_islandIndex = -(++staticSlotCount);
+		}
+	}
+
+	// Split the islands into contiguous partitions of roughly equal cost. Each island
+	// is solved exactly as it would be on a single thread so the partitioning does not
+	// affect the results.
+	int32 threadCount = b2Min(m_taskExecutor->GetThreadCount(), b2_maxSolverThreads);
+	int32 partitionCount = b2Min(threadCount, islandCount);
+
+	int32 totalCost = 0;
+	for (int32 i = 0; i < islandCount; ++i)
+	{
+		const b2SolverIsland* solverIsland = solver->islands + i;
+		totalCost += solverIsland->bodyCount + solverIsland->contactCount + solverIsland->jointCount;
+	}
+
+	b2SolverPartition partitions[b2_maxSolverThreads];
+	int32 islandIndex = 0;
+	int32 cost = 0;
+	for (int32 p = 0; p < partitionCount; ++p)
+	{
+		b2SolverPartition* partition = partitions + p;
+		partition->allocator = GetSolverAllocator(p);
+		partition->islandStart = islandIndex;
+		partition->bodyCapacity = 0;
+		partition->contactCapacity = 0;
+		partition->jointCapacity = 0;
+
+		// Leave at least one island for each of the remaining partitions and
+		// give the last partition whatever is left.
+		int32 islandLimit = islandCount - (partitionCount - p - 1);
+		int32 targetCost = (int32)((float32)totalCost * (p + 1) / partitionCount);
+
+		do
+		{
+			const b2SolverIsland* solverIsland = solver->islands + islandIndex++;
+			partition->bodyCapacity = b2Max(partition->bodyCapacity, solverIsland->bodyCount);
+			partition->contactCapacity = b2Max(partition->contactCapacity, solverIsland->contactCount);
+			partition->jointCapacity = b2Max(partition->jointCapacity, solverIsland->jointCount);
+			cost += solverIsland->bodyCount + solverIsland->contactCount + solverIsland->jointCount;
+		}
+		while (islandIndex < islandLimit && (cost < targetCost || p == partitionCount - 1));
+
+		partition->islandCount = islandIndex - partition->islandStart;
+	}
+
+	solver->step = &step;
+	solver->gravity = m_gravity;
+	solver->allowSleep = m_allowSleep;
+	solver->partitions = partitions;
+	solver->staticSlotCount = staticSlotCount;
+
+	m_taskExecutor->ParallelFor(partitionCount, 1, b2SolveIslandPartitions, solver);
+
+	m_profile.solveThreadCount = partitionCount;
+	for (int32 p = 0; p < partitionCount; ++p)
+	{
+		const b2SolverPartition* partition = partitions + p;
+		m_profile.solveInit += partition->profile.solveInit;
+		m_profile.solveVelocity += partition->profile.solveVelocity;
+		m_profile.solvePosition += partition->profile.solvePosition;
+		m_profile.solveThreads[p] = partition->time;
+	}
+
+	// Finish the islands in the order they were found so the results match solving
+	// them on a single thread. A static body is woken by each island it is part of and
+	// put back to sleep if that island fell asleep.
+	b2ContactListener* listener = m_contactManager.m_contactListener;
+	for (int32 i = 0; i < islandCount; ++i)
+	{
+		const b2SolverIsland* solverIsland = solver->islands + i;
+
+		bool asleep = solver->bodies[solverIsland->bodyStart]->IsAwake() == false;
+		for (int32 j = 0; j < solverIsland->staticCount; ++j)
+		{
+			b2Body* b = solver->statics[solverIsland->staticStart + j];
+			b->SetAwake(true);
+			if (asleep)
+			{
+				b->SetAwake(false);
+			}
+		}
+
+		if (listener == NULL)
+		{
+			continue;
+		}
+
+		for (int32 j = 0; j < solverIsland->contactCount; ++j)
+		{
+			int32 contactIndex = solverIsland->contactStart + j;
+			listener->PostSolve(solver->contacts[contactIndex], solver->impulses + contactIndex);
+		}
+	}
+}
+
 // Find TOI contacts and solve them.
 void b2World::SolveTOI(const b2TimeStep& step)
 {
@@ -34,6 +34,7 @@ class b2Body;
 class b2Draw;
 class b2Fixture;
 class b2Joint;
+struct b2SolverContext;
 
 /// The world class manages all physics entities, dynamic simulation,
 /// and asynchronous queries. The world also contains efficient memory
@@ -61,6 +62,22 @@ public:
 	/// remain in scope.
 	void SetContactListener(b2ContactListener* listener);
 
+	/// Register a task executor used to solve the islands across multiple threads.
+	/// The results are the same as solving on a single thread. The executor is
+	/// owned by you and must remain in scope.
+	void SetTaskExecutor(b2TaskExecutor* executor);
+
+	/// Get the registered task executor.
+	b2TaskExecutor* GetTaskExecutor() const;
+
+	/// Register a task executor used to update the contacts across multiple threads.
+	/// The contact events are still reported on the calling thread in the same order
+	/// as a single threaded update. The executor is owned by you and must remain in scope.
+	void SetCollideTaskExecutor(b2TaskExecutor* executor);
+
+	/// Get the registered collide task executor.
+	b2TaskExecutor* GetCollideTaskExecutor() const;
+
 	/// Register a routine for debug drawing. The debug draw functions are called
 	/// inside with b2World::DrawDebugData method. The debug draw object is owned
 	/// by you and must remain in scope.
@@ -227,6 +244,9 @@ private:
 	void Solve(const b2TimeStep& step);
 	void SolveTOI(const b2TimeStep& step);
 
+	void SolveIslands(const b2TimeStep& step, b2SolverContext* solver, int32 islandCount, int32 staticCount);
+	b2StackAllocator* GetSolverAllocator(int32 index);
+
 	void DrawJoint(b2Joint* joint);
 	void DrawShape(b2Fixture* shape, const b2Transform& xf, const b2Color& color);
 
@@ -249,6 +269,11 @@ private:
 	b2DestructionListener* m_destructionListener;
 	b2Draw* m_debugDraw;
 
+	b2TaskExecutor* m_taskExecutor;
+
+	// Stack allocators for each thread used to solve the islands.
+	b2StackAllocator* m_solverAllocators[b2_maxSolverThreads];
+
 	// This is used to compute the time step ratio to
 	// support a variable time step.
 	float32 m_inv_dt0;
@@ -346,6 +371,16 @@ inline const b2ContactManager& b2World::GetContactManager() const
 	return m_contactManager;
 }
 
+inline b2TaskExecutor* b2World::GetTaskExecutor() const
+{
+	return m_taskExecutor;
+}
+
+inline b2TaskExecutor* b2World::GetCollideTaskExecutor() const
+{
+	return m_contactManager.m_taskExecutor;
+}
+
 inline const b2Profile& b2World::GetProfile() const
 {
 	return m_profile;
@@ -118,6 +118,24 @@ public:
 	}
 };
 
+/// Implement this class to let the world spread work across multiple threads.
+/// See b2World::SetTaskExecutor
+class b2TaskExecutor
+{
+public:
+	/// Task callback. Processes the indices [startIndex, endIndex).
+	typedef void (*b2TaskFunction)(void* context, int32 startIndex, int32 endIndex);
+
+	virtual ~b2TaskExecutor() {}
+
+	/// Get the number of threads work is spread across, including the calling thread.
+	virtual int32 GetThreadCount() const = 0;
+
+	/// Process the indices [0, count) in chunks of at most grainSize. This
+	/// must only return once every index has been processed.
+	virtual void ParallelFor(int32 count, int32 grainSize, b2TaskFunction task, void* context) = 0;
+};
+
 /// Callback class for AABB queries.
 /// See b2World::Query
 class b2QueryCallback
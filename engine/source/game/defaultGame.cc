@@ -81,6 +81,10 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_JOB_SCHEDULER_H_
+#include "platform/threads/jobScheduler.h"
+#endif
+
 #ifdef TORQUE_OS_IOS
 #include "platformiOS/iOSProfiler.h"
 #endif
@@ -106,6 +110,10 @@ static F32 frameTotalTime = 0.0f;
 static F32 frameTotalLastTime = 0.0f;
 static U32 frameTotalCount = 0;
 
+// Sampled frame stats.
+static F32 frameRateSample = 0.0f;
+static U32 frameCountSample = 0;
+
 //-----------------------------------------------------------------------------
 
 bool initializeLibraries()
@@ -164,6 +172,9 @@ bool initializeLibraries()
 
     // Initialize the particle system.
     ParticleSystem::Init();
+
+    // Initialize the job scheduler.
+    JobScheduler::Init();
     
 #if defined(TORQUE_OS_IOS) && defined(_USE_STORE_KIT)
     storeInit();
@@ -205,6 +216,9 @@ void shutdownLibraries()
 
     // Destroy the particle system.
     ParticleSystem::destroy();
+
+    // Destroy the job scheduler.
+    JobScheduler::destroy();
   
 #ifdef _USE_STORE_KIT
     storeCleanup();
@@ -418,14 +432,31 @@ void DefaultGame::processTick( void )
     static F32 lastFrameUpdate = frameTotalTime;    
     if ( (frameTotalTime - lastFrameUpdate) > 0.25f )
     {
-        Con::setVariable( "fps::framePeriod", avar("%4.1f", 1.0f / framePeriod) );
-        Con::setVariable( "fps::frameCount", avar("%u", frameTotalCount) );
+        frameRateSample = 1.0f / framePeriod;
+        frameCountSample = frameTotalCount;
+
+        Con::setVariable( "fps::framePeriod", avar("%4.1f", frameRateSample) );
+        Con::setVariable( "fps::frameCount", avar("%u", frameCountSample) );
         lastFrameUpdate = frameTotalTime;
     }
 }
 
 //--------------------------------------------------------------------------
 
+F32 DefaultGame::getFramesPerSecond( void ) const
+{
+    return frameRateSample;
+}
+
+//--------------------------------------------------------------------------
+
+U32 DefaultGame::getFrameCount( void ) const
+{
+    return frameCountSample;
+}
+
+//--------------------------------------------------------------------------
+
 void DefaultGame::advanceTime( F32 timeDelta )
 {
     // Update total frame time.
@@ -55,6 +55,9 @@ public:
     virtual void interpolateTick( F32 delta ) {};
     virtual void advanceTime( F32 timeDelta );
 
+    virtual F32 getFramesPerSecond( void ) const;
+    virtual U32 getFrameCount( void ) const;
+
     void processQuitEvent();
     void processTimeEvent(TimeEvent *event);
     void processInputEvent(InputEvent *event);
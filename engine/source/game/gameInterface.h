@@ -97,6 +97,13 @@ public:
    inline bool requiresRestart( void ) const { return mRequiresRestart; }
    /// @}
 
+   /// @name Frame Statistics
+   /// Periodically sampled frame statistics, avoiding the need to query the console.
+   /// @{
+   virtual F32 getFramesPerSecond( void ) const { return 0.0f; }
+   virtual U32 getFrameCount( void ) const { return 0; }
+   /// @}
+
    /// @name Journaling
    ///
    /// Journaling is used in order to make a "demo" of the actual game.  It logs
@@ -49,6 +49,19 @@ S32 TextureManager::mBitmapResidentSize = 0;
 S32 TextureManager::mTextureResidentSize = 0;
 S32 TextureManager::mTextureResidentWasteSize = 0;
 S32 TextureManager::mTextureResidentCount = 0;
+S32 TextureManager::mAtlasPageSize = 1024;
+S32 TextureManager::mAtlasMaxBitmapSize = 256;
+TextureManager::typeAtlasPageVector TextureManager::mAtlasPages;
+TextureManager::typeAtlasEntryVector TextureManager::mAtlasEntries;
+
+// Pixels of edge-extruded border surrounding each atlas area so that filtering does not bleed neighbouring areas.
+static const S32 AtlasAreaGutter = 1;
+
+// The atlas page size must be a power-of-two so that the page texture is not padded.
+static inline S32 getAtlasPageSize( const S32 atlasPageSize )
+{
+    return getMin( (S32)getNextPow2( getMax( atlasPageSize, 64 ) ), (S32)MaximumProductSupportedTextureWidth );
+}
 
 //---------------------------------------------------------------------------------------------------------------------
 
@@ -155,6 +168,8 @@ void TextureManager::create()
     Con::addVariable("$pref::OpenGL::force16BitTexture", TypeBool, &TextureManager::mForce16BitTexture);
     Con::addVariable("$pref::OpenGL::allowTextureCompression", TypeBool, &TextureManager::mAllowTextureCompression);
     Con::addVariable("$pref::OpenGL::disableTextureSubImageUpdates", TypeBool, &TextureManager::mDisableTextureSubImageUpdates);
+    Con::addVariable("$pref::OpenGL::textureAtlasPageSize", TypeS32, &TextureManager::mAtlasPageSize);
+    Con::addVariable("$pref::OpenGL::textureAtlasMaxBitmapSize", TypeS32, &TextureManager::mAtlasMaxBitmapSize);
 
     // Flag as alive.
     mManagerState = Alive;
@@ -166,6 +181,14 @@ void TextureManager::destroy()
 {
     AssertISV(mManagerState != NotInitialized, "TextureManager::destroy - nothing to destroy!");
 
+    // Release the texture atlas.
+    for( typeAtlasPageVector::iterator pageItr = mAtlasPages.begin(); pageItr != mAtlasPages.end(); ++pageItr )
+    {
+        delete *pageItr;
+    }
+    mAtlasPages.clear();
+    mAtlasEntries.clear();
+
     // Destroy the texture dictionary.
     TextureDictionary::destroy();
 
@@ -940,6 +963,249 @@ GBitmap *TextureManager::loadBitmap( const char* pTextureKey, bool recurse, bool
 
 //--------------------------------------------------------------------------------------------------------------------
 
+bool TextureManager::allocateAtlasArea( const char* pTextureKey, const GLuint filter, TextureHandle& atlasTexture, RectI& atlasArea )
+{
+    // Finish if texture key is invalid.
+    if( pTextureKey == NULL || *pTextureKey == 0)
+        return false;
+
+    // Fetch texture key.
+    StringTableEntry textureKey = StringTable->insert(pTextureKey);
+
+    // Load the bitmap.
+    GBitmap* pBitmap = loadBitmap( textureKey );
+
+    // Finish if bitmap could not be loaded.
+    if ( pBitmap == NULL )
+        return false;
+
+    // Fetch the bitmap dimensions.
+    const S32 bitmapWidth = pBitmap->getWidth();
+    const S32 bitmapHeight = pBitmap->getHeight();
+
+    // Fetch the page size.
+    const S32 pageSize = getAtlasPageSize( mAtlasPageSize );
+
+    // Finish if the bitmap is not an atlas candidate.
+    if (    (pBitmap->getFormat() != GBitmap::RGBA && pBitmap->getFormat() != GBitmap::RGB) ||
+            bitmapWidth > mAtlasMaxBitmapSize || bitmapHeight > mAtlasMaxBitmapSize ||
+            bitmapWidth + (AtlasAreaGutter*2) > pageSize || bitmapHeight + (AtlasAreaGutter*2) > pageSize )
+    {
+        delete pBitmap;
+        return false;
+    }
+
+    // Find an existing entry for the texture key.
+    AtlasEntry* pAtlasEntry = NULL;
+    for( typeAtlasEntryVector::iterator entryItr = mAtlasEntries.begin(); entryItr != mAtlasEntries.end(); ++entryItr )
+    {
+        if ( entryItr->mTextureKey == textureKey && entryItr->mFilter == filter )
+        {
+            pAtlasEntry = entryItr;
+            break;
+        }
+    }
+
+    // Allocate a new area if we've no entry or the bitmap dimensions have changed.
+    if ( pAtlasEntry == NULL || pAtlasEntry->mArea.extent.x != bitmapWidth || pAtlasEntry->mArea.extent.y != bitmapHeight )
+    {
+        Point2I pixelOffset;
+        AtlasPage* pAtlasPage = allocateAtlasPageArea( filter, bitmapWidth + (AtlasAreaGutter*2), bitmapHeight + (AtlasAreaGutter*2), pixelOffset );
+
+        // Finish if no page area could be allocated.
+        if ( pAtlasPage == NULL )
+        {
+            delete pBitmap;
+            return false;
+        }
+
+        // Create an entry if required.
+        if ( pAtlasEntry == NULL )
+        {
+            AtlasEntry atlasEntry;
+            atlasEntry.mTextureKey = textureKey;
+            atlasEntry.mFilter = filter;
+            mAtlasEntries.push_back( atlasEntry );
+            pAtlasEntry = &mAtlasEntries.last();
+        }
+
+        pAtlasEntry->mpPage = pAtlasPage;
+        pAtlasEntry->mArea.set( pixelOffset.x + AtlasAreaGutter, pixelOffset.y + AtlasAreaGutter, bitmapWidth, bitmapHeight );
+    }
+
+    // Copy the bitmap into the page.
+    copyAtlasBitmap( pAtlasEntry->mpPage, pBitmap, pAtlasEntry->mArea );
+
+    // Delete the bitmap.
+    delete pBitmap;
+
+    // Set the atlas area.
+    atlasTexture = pAtlasEntry->mpPage->mTexture;
+    atlasArea = pAtlasEntry->mArea;
+
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::purgeAtlas( void )
+{
+    // Iterate pages.
+    for( S32 pageIndex = 0; pageIndex < mAtlasPages.size(); )
+    {
+        AtlasPage* pAtlasPage = mAtlasPages[pageIndex];
+
+        // Skip the page if anything other than the atlas references it.
+        if ( ((TextureObject*)pAtlasPage->mTexture)->mRefCount > 1 )
+        {
+            ++pageIndex;
+            continue;
+        }
+
+        // Remove the page entries.
+        for( S32 entryIndex = 0; entryIndex < mAtlasEntries.size(); )
+        {
+            if ( mAtlasEntries[entryIndex].mpPage == pAtlasPage )
+            {
+                mAtlasEntries.erase_fast( entryIndex );
+                continue;
+            }
+
+            ++entryIndex;
+        }
+
+        // Remove the page.
+        mAtlasPages.erase_fast( pageIndex );
+        delete pAtlasPage;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+TextureManager::AtlasPage* TextureManager::allocateAtlasPageArea( const GLuint filter, const U32 width, const U32 height, Point2I& pixelOffset )
+{
+    // Fetch the page size.
+    const U32 pageSize = (U32)getAtlasPageSize( mAtlasPageSize );
+
+    // Find space on an existing page with the same filter.
+    for( typeAtlasPageVector::iterator pageItr = mAtlasPages.begin(); pageItr != mAtlasPages.end(); ++pageItr )
+    {
+        AtlasPage* pAtlasPage = *pageItr;
+
+        // Skip if the filter is different.
+        if ( pAtlasPage->mFilter != filter )
+            continue;
+
+        // Does the area fit on the current shelf?
+        if ( pAtlasPage->mShelfX + width <= pageSize && pAtlasPage->mShelfY + height <= pageSize )
+        {
+            // Yes, so allocate it.
+            pixelOffset.set( pAtlasPage->mShelfX, pAtlasPage->mShelfY );
+            pAtlasPage->mShelfX += width;
+            pAtlasPage->mShelfHeight = getMax( pAtlasPage->mShelfHeight, height );
+            return pAtlasPage;
+        }
+
+        // Does the area fit on a new shelf?
+        const U32 shelfY = pAtlasPage->mShelfY + pAtlasPage->mShelfHeight;
+        if ( shelfY + height <= pageSize )
+        {
+            // Yes, so allocate it.
+            pixelOffset.set( 0, shelfY );
+            pAtlasPage->mShelfX = width;
+            pAtlasPage->mShelfY = shelfY;
+            pAtlasPage->mShelfHeight = height;
+            return pAtlasPage;
+        }
+    }
+
+    // Finish if the area can never fit.
+    if ( width > pageSize || height > pageSize )
+        return NULL;
+
+    // Create a new page bitmap.
+    GBitmap* pPageBitmap = new GBitmap( pageSize, pageSize, false, GBitmap::RGBA );
+    dMemset( pPageBitmap->getWritableBits(), 0, pPageBitmap->byteSize );
+
+    // Create a new page.
+    AtlasPage* pAtlasPage = new AtlasPage();
+    pAtlasPage->mTexture = TextureHandle( getUniqueTextureKey(), pPageBitmap, TextureHandle::BitmapKeepTexture, true );
+    pAtlasPage->mTexture.setFilter( filter );
+    pAtlasPage->mFilter = filter;
+    pAtlasPage->mShelfX = width;
+    pAtlasPage->mShelfY = 0;
+    pAtlasPage->mShelfHeight = height;
+    mAtlasPages.push_back( pAtlasPage );
+
+    pixelOffset.set( 0, 0 );
+
+    return pAtlasPage;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::copyAtlasBitmap( AtlasPage* pAtlasPage, const GBitmap* pBitmap, const RectI& atlasArea )
+{
+    // Fetch the page texture object.
+    TextureObject* pTextureObject = pAtlasPage->mTexture;
+    GBitmap* pPageBitmap = pTextureObject->mpBitmap;
+
+    // Sanity!
+    AssertFatal( pPageBitmap != NULL && pPageBitmap->getFormat() == GBitmap::RGBA, "TextureManager::copyAtlasBitmap() - Invalid page bitmap." );
+
+    const S32 bitmapWidth = atlasArea.extent.x;
+    const S32 bitmapHeight = atlasArea.extent.y;
+    const bool sourceAlpha = pBitmap->getFormat() == GBitmap::RGBA;
+
+    // Copy the bitmap including the gutter.  Clamping the source coordinate extrudes the edge pixels into the gutter.
+    for( S32 y = -AtlasAreaGutter; y < bitmapHeight + AtlasAreaGutter; ++y )
+    {
+        const S32 sourceY = mClamp( y, 0, bitmapHeight-1 );
+        U8* pDest = pPageBitmap->getAddress( atlasArea.point.x - AtlasAreaGutter, atlasArea.point.y + y );
+
+        for( S32 x = -AtlasAreaGutter; x < bitmapWidth + AtlasAreaGutter; ++x )
+        {
+            const U8* pSource = pBitmap->getAddress( mClamp( x, 0, bitmapWidth-1 ), sourceY );
+            *pDest++ = pSource[0];
+            *pDest++ = pSource[1];
+            *pDest++ = pSource[2];
+            *pDest++ = sourceAlpha ? pSource[3] : 0xFF;
+        }
+    }
+
+    // Finish if the page texture is not resident.  The kept bitmap will be uploaded when it is.
+    if ( !(mDGLRender || mManagerState == Resurrecting) || pTextureObject->mGLTextureName == 0 )
+        return;
+
+    // Refresh the whole page if sub-image updates are disabled.
+    if ( mDisableTextureSubImageUpdates )
+    {
+        refresh( pTextureObject );
+        return;
+    }
+
+    // Gather the updated area.
+    const S32 updateX = atlasArea.point.x - AtlasAreaGutter;
+    const S32 updateY = atlasArea.point.y - AtlasAreaGutter;
+    const S32 updateWidth = bitmapWidth + (AtlasAreaGutter*2);
+    const S32 updateHeight = bitmapHeight + (AtlasAreaGutter*2);
+    const S32 updateRowSize = updateWidth * pPageBitmap->bytesPerPixel;
+
+    U8* pUpdateBits = new U8[updateRowSize * updateHeight];
+    for( S32 y = 0; y < updateHeight; ++y )
+    {
+        dMemcpy( pUpdateBits + (y * updateRowSize), pPageBitmap->getAddress( updateX, updateY + y ), updateRowSize );
+    }
+
+    // Upload the updated area.
+    glBindTexture( GL_TEXTURE_2D, pTextureObject->mGLTextureName );
+    glTexSubImage2D( GL_TEXTURE_2D, 0, updateX, updateY, updateWidth, updateHeight, GL_RGBA, GL_UNSIGNED_BYTE, pUpdateBits );
+
+    delete [] pUpdateBits;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
 void TextureManager::dumpMetrics( void )
 {
     S32 textureResidentCount = 0;
@@ -995,6 +1261,7 @@ void TextureManager::dumpMetrics( void )
         mTextureResidentWasteSize,
         mBitmapResidentSize,
         getResidentFraction() );
+    Con::printf( "AtlasPageCount: %d, AtlasEntryCount: %d", mAtlasPages.size(), mAtlasEntries.size() );
 
     Con::printBlankLine();
     Con::printSeparator();
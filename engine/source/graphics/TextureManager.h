@@ -40,6 +40,14 @@
 #include "graphics/TextureDictionary.h"
 #endif
 
+#ifndef _MRECT_H_
+#include "math/mRect.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 #define MaximumProductSupportedTextureWidth 2048
@@ -71,6 +79,28 @@ public:
     };
 
 private:
+    /// Texture atlas page.
+    struct AtlasPage
+    {
+        TextureHandle   mTexture;
+        GLuint          mFilter;
+        U32             mShelfX;
+        U32             mShelfY;
+        U32             mShelfHeight;
+    };
+
+    /// Texture atlas entry.
+    struct AtlasEntry
+    {
+        StringTableEntry    mTextureKey;
+        GLuint              mFilter;
+        AtlasPage*          mpPage;
+        RectI               mArea;
+    };
+
+    typedef Vector<AtlasPage*> typeAtlasPageVector;
+    typedef Vector<AtlasEntry> typeAtlasEntryVector;
+
     static S32 mMasterTextureKeyIndex;
     static ManagerState mManagerState;
     static S32 mTextureResidentWasteSize;
@@ -80,6 +110,10 @@ private:
     static bool mForce16BitTexture;
     static bool mAllowTextureCompression;
     static bool mDisableTextureSubImageUpdates;
+    static S32 mAtlasPageSize;
+    static S32 mAtlasMaxBitmapSize;
+    static typeAtlasPageVector mAtlasPages;
+    static typeAtlasEntryVector mAtlasEntries;
 
 public:
     static bool mDGLRender;
@@ -104,6 +138,12 @@ public:
 
     static StringTableEntry getUniqueTextureKey( void );
 
+    /// Texture atlas.
+    static bool allocateAtlasArea( const char* pTextureKey, const GLuint filter, TextureHandle& atlasTexture, RectI& atlasArea );
+    static void purgeAtlas( void );
+    static U32 getAtlasPageCount( void ) { return (U32)mAtlasPages.size(); }
+    static U32 getAtlasEntryCount( void ) { return (U32)mAtlasEntries.size(); }
+
     static void dumpMetrics( void );
 
 private:
@@ -120,6 +160,9 @@ private:
     static U16* create16BitBitmap( GBitmap *pDL, U8 *in_source8, GBitmap::BitmapFormat alpha_info, GLint *GLformat, GLint *GLdata_type, U32 width, U32 height );
     static void getSourceDestByteFormat(GBitmap *pBitmap, U32 *sourceFormat, U32 *destFormat, U32 *byteFormat, U32* texelSize);
     static F32 getResidentFraction( void );
+
+    static AtlasPage* allocateAtlasPageArea( const GLuint filter, const U32 width, const U32 height, Point2I& pixelOffset );
+    static void copyAtlasBitmap( AtlasPage* pAtlasPage, const GBitmap* pBitmap, const RectI& atlasArea );
 };
 
 #endif // _TEXTURE_MANAGER_H_
\ No newline at end of file
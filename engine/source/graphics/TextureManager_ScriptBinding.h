@@ -72,4 +72,14 @@ ConsoleFunctionWithDocs( dumpTextureManagerMetrics, ConsoleVoid, 1, 1, ())
     return TextureManager::dumpMetrics();
 }
 
+//--------------------------------------------------------------------------------------------------------------------
+
+/*! Release any texture atlas pages that are no longer used by any image.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( purgeTextureAtlas, ConsoleVoid, 1, 1, ())
+{
+    TextureManager::purgeAtlas();
+}
+
 /*! @} */ // group TextureManagerFunctions
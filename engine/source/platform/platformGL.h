@@ -35,4 +35,7 @@
 #elif defined(TORQUE_OS_EMSCRIPTEN)
 #include "platformEmscripten/platformGL.h"
 #endif
+
+// Null/recording dispatch used for headless render benchmarks.
+#include "platform/platformGLNull.h"
 #endif
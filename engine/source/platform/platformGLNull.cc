@@ -0,0 +1,493 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/platform.h"
+#include "platform/platformGL.h"
+#include "platform/platformGLNull.h"
+#include "console/console.h"
+
+// Script bindings.
+#include "platformGLNull_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+static GLNullMetrics smNullMetrics;
+static bool smNullEnabled = false;
+static bool smNullCaptureVertices = false;
+static Vector<F32> smNullCapturedVertices;
+
+#ifdef TORQUE_GL_NULL_DISPATCH
+
+//-----------------------------------------------------------------------------
+
+static GLuint smNullTextureName = 0;
+static GLuint smNullBufferName = 0;
+static GLuint smNullElementBuffer = 0;
+static const GLfloat* smNullVertexPointer = NULL;
+static GLint smNullVertexSize = 0;
+static GLsizei smNullVertexStride = 0;
+
+// Saved entry points restored when the dispatch is disabled.
+#define GL_FUNCTION(fn_return, fn_name, fn_args, fn_value) static fn_return (GLAPIENTRY *saved_##fn_name)fn_args = NULL;
+#include "platform/GLCoreFunc.h"
+#include "platform/GLExtFunc.h"
+#undef GL_FUNCTION
+
+// Recording stubs.  These only count the call and return the same value as the loader stubs.
+#define GL_FUNCTION(fn_return, fn_name, fn_args, fn_value) static fn_return GLAPIENTRY null_##fn_name fn_args { smNullMetrics.mCalls++; fn_value }
+#include "platform/GLCoreFunc.h"
+#include "platform/GLExtFunc.h"
+#undef GL_FUNCTION
+
+//-----------------------------------------------------------------------------
+
+static U32 getNullPixelBytes( GLsizei width, GLsizei height, GLenum format, GLenum type )
+{
+    // Packed formats.
+    if ( type == GL_UNSIGNED_SHORT_5_6_5 || type == GL_UNSIGNED_SHORT_4_4_4_4 || type == GL_UNSIGNED_SHORT_5_5_5_1 )
+        return width * height * 2;
+
+    U32 components;
+    switch( format )
+    {
+        case GL_RGBA:               components = 4; break;
+        case GL_RGB:                components = 3; break;
+        case GL_LUMINANCE_ALPHA:    components = 2; break;
+        default:                    components = 1; break;
+    }
+
+    return width * height * components;
+}
+
+//-----------------------------------------------------------------------------
+
+static U32 getNullIndexBytes( GLsizei count, GLenum type )
+{
+    switch( type )
+    {
+        case GL_UNSIGNED_INT:       return count * 4;
+        case GL_UNSIGNED_SHORT:     return count * 2;
+        default:                    return count;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullDrawArrays( GLenum mode, GLint first, GLsizei count )
+{
+    smNullMetrics.mCalls++;
+    smNullMetrics.mDrawCalls++;
+    smNullMetrics.mVertices += count;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullDrawElements( GLenum mode, GLsizei count, GLenum type, const GLvoid *indices )
+{
+    smNullMetrics.mCalls++;
+    smNullMetrics.mDrawCalls++;
+    smNullMetrics.mVertices += count;
+
+    // Client-side indices are transferred with every draw.
+    if ( smNullElementBuffer == 0 )
+        smNullMetrics.mIndexBytes += getNullIndexBytes( count, type );
+
+    // Finish if not capturing client-side vertices.
+    if ( !smNullCaptureVertices || smNullElementBuffer != 0 || smNullVertexPointer == NULL || indices == NULL )
+        return;
+
+    // Capture the vertex positions.
+    const U32 vertexStride = smNullVertexStride == 0 ? smNullVertexSize : smNullVertexStride / sizeof(GLfloat);
+    for ( GLsizei index = 0; index < count; ++index )
+    {
+        // Fetch the vertex index.
+        U32 vertexIndex;
+        switch( type )
+        {
+            case GL_UNSIGNED_INT:       vertexIndex = ((const GLuint*)indices)[index]; break;
+            case GL_UNSIGNED_SHORT:     vertexIndex = ((const GLushort*)indices)[index]; break;
+            default:                    vertexIndex = ((const GLubyte*)indices)[index]; break;
+        }
+
+        const GLfloat* pVertex = smNullVertexPointer + vertexIndex * vertexStride;
+        smNullCapturedVertices.push_back( pVertex[0] );
+        smNullCapturedVertices.push_back( pVertex[1] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullVertexPointer( GLint size, GLenum type, GLsizei stride, const GLvoid *pointer )
+{
+    smNullMetrics.mCalls++;
+
+    // Only float vertices are captured.
+    smNullVertexPointer = type == GL_FLOAT ? (const GLfloat*)pointer : NULL;
+    smNullVertexSize = size;
+    smNullVertexStride = stride;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullBegin( GLenum mode )
+{
+    // Immediate mode is counted as a draw call.
+    smNullMetrics.mCalls++;
+    smNullMetrics.mDrawCalls++;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullVertex2f( GLfloat x, GLfloat y )
+{
+    smNullMetrics.mCalls++;
+    smNullMetrics.mVertices++;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullVertex3f( GLfloat x, GLfloat y, GLfloat z )
+{
+    smNullMetrics.mCalls++;
+    smNullMetrics.mVertices++;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullEnable( GLenum cap )
+{
+    smNullMetrics.mCalls++;
+    smNullMetrics.mStateChanges++;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullDisable( GLenum cap )
+{
+    smNullMetrics.mCalls++;
+    smNullMetrics.mStateChanges++;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullBlendFunc( GLenum sfactor, GLenum dfactor )
+{
+    smNullMetrics.mCalls++;
+    smNullMetrics.mStateChanges++;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullAlphaFunc( GLenum func, GLclampf ref )
+{
+    smNullMetrics.mCalls++;
+    smNullMetrics.mStateChanges++;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullTexEnvi( GLenum target, GLenum pname, GLint param )
+{
+    smNullMetrics.mCalls++;
+    smNullMetrics.mStateChanges++;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullTexParameteri( GLenum target, GLenum pname, GLint param )
+{
+    smNullMetrics.mCalls++;
+    smNullMetrics.mStateChanges++;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullPolygonMode( GLenum face, GLenum mode )
+{
+    smNullMetrics.mCalls++;
+    smNullMetrics.mStateChanges++;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullBindTexture( GLenum target, GLuint texture )
+{
+    smNullMetrics.mCalls++;
+    smNullMetrics.mStateChanges++;
+    smNullMetrics.mTextureBinds++;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullGenTextures( GLsizei n, GLuint *textures )
+{
+    smNullMetrics.mCalls++;
+
+    // Hand out unique names so texture bookkeeping behaves as normal.
+    for ( GLsizei index = 0; index < n; ++index )
+        textures[index] = ++smNullTextureName;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullTexImage2D( GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels )
+{
+    smNullMetrics.mCalls++;
+
+    if ( pixels != NULL )
+        smNullMetrics.mTextureBytes += getNullPixelBytes( width, height, format, type );
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels )
+{
+    smNullMetrics.mCalls++;
+    smNullMetrics.mTextureBytes += getNullPixelBytes( width, height, format, type );
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullGenBuffersARB( GLsizei n, GLuint* buffers )
+{
+    smNullMetrics.mCalls++;
+
+    for ( GLsizei index = 0; index < n; ++index )
+        buffers[index] = ++smNullBufferName;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullBindBufferARB( GLenum target, GLuint buffer )
+{
+    smNullMetrics.mCalls++;
+    smNullMetrics.mStateChanges++;
+    smNullMetrics.mBufferBinds++;
+
+    if ( target == GL_ELEMENT_ARRAY_BUFFER_ARB )
+        smNullElementBuffer = buffer;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullBufferDataARB( GLenum target, GLsizeiptrARB size, const void* data, GLenum usage )
+{
+    smNullMetrics.mCalls++;
+
+    if ( data != NULL )
+        smNullMetrics.mBufferBytes += (U32)size;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullBufferSubDataARB( GLenum target, GLintptrARB offset, GLsizeiptrARB size, const void* data )
+{
+    smNullMetrics.mCalls++;
+    smNullMetrics.mBufferBytes += (U32)size;
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullGetIntegerv( GLenum pname, GLint *params )
+{
+    smNullMetrics.mCalls++;
+
+    switch( pname )
+    {
+        case GL_MAX_TEXTURE_SIZE:
+            params[0] = 4096;
+            break;
+
+        case GL_VIEWPORT:
+            params[0] = params[1] = 0;
+            params[2] = params[3] = 4096;
+            break;
+
+        default:
+            params[0] = 0;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void GLAPIENTRY nullGetFloatv( GLenum pname, GLfloat *params )
+{
+    smNullMetrics.mCalls++;
+
+    switch( pname )
+    {
+        case GL_MODELVIEW_MATRIX:
+        case GL_PROJECTION_MATRIX:
+        case GL_TEXTURE_MATRIX:
+            // Identity.
+            for ( U32 index = 0; index < 16; ++index )
+                params[index] = (index % 5) == 0 ? 1.0f : 0.0f;
+            break;
+
+        default:
+            params[0] = 0.0f;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static const GLubyte* GLAPIENTRY nullGetString( GLenum name )
+{
+    smNullMetrics.mCalls++;
+    return (const GLubyte*)"Null";
+}
+
+#endif // TORQUE_GL_NULL_DISPATCH
+
+//-----------------------------------------------------------------------------
+
+namespace GLNull
+{
+
+bool isSupported( void )
+{
+#ifdef TORQUE_GL_NULL_DISPATCH
+    return true;
+#else
+    return false;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+bool isEnabled( void )
+{
+    return smNullEnabled;
+}
+
+//-----------------------------------------------------------------------------
+
+bool enable( void )
+{
+#ifdef TORQUE_GL_NULL_DISPATCH
+    // Finish if already enabled.
+    if ( smNullEnabled )
+        return true;
+
+    // Save the bound entry points and point them at the recording stubs.
+    #define GL_FUNCTION(fn_return, fn_name, fn_args, fn_value) saved_##fn_name = fn_name; fn_name = null_##fn_name;
+    #include "platform/GLCoreFunc.h"
+    #include "platform/GLExtFunc.h"
+    #undef GL_FUNCTION
+
+    // Entry points that record more than a call.
+    glDrawArrays        = nullDrawArrays;
+    glDrawElements      = nullDrawElements;
+    glVertexPointer     = nullVertexPointer;
+    glBegin             = nullBegin;
+    glVertex2f          = nullVertex2f;
+    glVertex3f          = nullVertex3f;
+    glEnable            = nullEnable;
+    glDisable           = nullDisable;
+    glBlendFunc         = nullBlendFunc;
+    glAlphaFunc         = nullAlphaFunc;
+    glTexEnvi           = nullTexEnvi;
+    glTexParameteri     = nullTexParameteri;
+    glPolygonMode       = nullPolygonMode;
+    glBindTexture       = nullBindTexture;
+    glGenTextures       = nullGenTextures;
+    glTexImage2D        = nullTexImage2D;
+    glTexSubImage2D     = nullTexSubImage2D;
+    glGenBuffersARB     = nullGenBuffersARB;
+    glBindBufferARB     = nullBindBufferARB;
+    glBufferDataARB     = nullBufferDataARB;
+    glBufferSubDataARB  = nullBufferSubDataARB;
+    glGetIntegerv       = nullGetIntegerv;
+    glGetFloatv         = nullGetFloatv;
+    glGetString         = nullGetString;
+
+    smNullElementBuffer = 0;
+    smNullVertexPointer = NULL;
+    smNullMetrics.reset();
+    smNullEnabled = true;
+
+    Con::printf( "GL null dispatch enabled." );
+
+    return true;
+#else
+    Con::warnf( "GLNull::enable() - The null GL dispatch is not supported on this platform." );
+    return false;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void disable( void )
+{
+#ifdef TORQUE_GL_NULL_DISPATCH
+    // Finish if not enabled.
+    if ( !smNullEnabled )
+        return;
+
+    // Restore the saved entry points.
+    #define GL_FUNCTION(fn_return, fn_name, fn_args, fn_value) fn_name = saved_##fn_name;
+    #include "platform/GLCoreFunc.h"
+    #include "platform/GLExtFunc.h"
+    #undef GL_FUNCTION
+
+    smNullEnabled = false;
+
+    Con::printf( "GL null dispatch disabled." );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void resetMetrics( void )
+{
+    smNullMetrics.reset();
+}
+
+//-----------------------------------------------------------------------------
+
+const GLNullMetrics& getMetrics( void )
+{
+    return smNullMetrics;
+}
+
+//-----------------------------------------------------------------------------
+
+void setCaptureVertices( const bool capture )
+{
+    smNullCaptureVertices = capture;
+}
+
+//-----------------------------------------------------------------------------
+
+void clearCapturedVertices( void )
+{
+    smNullCapturedVertices.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+const Vector<F32>& getCapturedVertices( void )
+{
+    return smNullCapturedVertices;
+}
+
+} // namespace GLNull
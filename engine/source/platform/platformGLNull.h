@@ -0,0 +1,98 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PLATFORMGLNULL_H_
+#define _PLATFORMGLNULL_H_
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// The null dispatch swaps the bound GL entry points so it is only available
+// on platforms that resolve GL through function pointers.
+#if defined(TORQUE_OS_WIN32) || defined(TORQUE_OS_LINUX) || defined(TORQUE_OS_OPENBSD) || defined(TORQUE_OS_FREEBSD)
+#define TORQUE_GL_NULL_DISPATCH
+#endif
+
+//-----------------------------------------------------------------------------
+
+struct GLNullMetrics
+{
+    GLNullMetrics() { reset(); }
+
+    void reset( void )
+    {
+        mCalls          = 0;
+        mDrawCalls      = 0;
+        mVertices       = 0;
+        mStateChanges   = 0;
+        mTextureBinds   = 0;
+        mBufferBinds    = 0;
+        mTextureBytes   = 0;
+        mBufferBytes    = 0;
+        mIndexBytes     = 0;
+    }
+
+    U32 mCalls;
+    U32 mDrawCalls;
+    U32 mVertices;
+    U32 mStateChanges;
+    U32 mTextureBinds;
+    U32 mBufferBinds;
+    U32 mTextureBytes;
+    U32 mBufferBytes;
+    U32 mIndexBytes;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Null/recording GL dispatch.
+///
+/// When enabled, every bound GL entry point is replaced with a stub that does no
+/// rendering but records the number of calls, draw calls, state changes and bytes
+/// that would have been sent to the driver.  No GL context is required which allows
+/// render-cost benchmarks to be run headless.
+namespace GLNull
+{
+    bool isSupported( void );
+    bool isEnabled( void );
+
+    bool enable( void );
+    void disable( void );
+
+    void resetMetrics( void );
+    const GLNullMetrics& getMetrics( void );
+
+    /// Vertex capture.
+    /// When capturing, the x/y position of every client-side vertex drawn with glDrawElements is recorded in draw order.
+    void setCaptureVertices( const bool capture );
+    void clearCapturedVertices( void );
+    const Vector<F32>& getCapturedVertices( void );
+}
+
+#endif // _PLATFORMGLNULL_H_
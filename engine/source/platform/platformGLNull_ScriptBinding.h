@@ -0,0 +1,115 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin(GLNull, "Null GL dispatch functions.");
+
+/*! @defgroup GLNullFunctions Null GL Dispatch
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+//-----------------------------------------------------------------------------
+
+/*! Enables or disables the null GL dispatch.
+    When enabled, no rendering is performed but all GL calls, draw calls, state changes and uploaded bytes are recorded.
+    This does not require a GL context so can be used for headless render benchmarks.
+    @param enabled Whether to enable the null GL dispatch or not.
+    @return Whether the null GL dispatch is enabled or not.
+*/
+ConsoleFunctionWithDocs( setGLNullDispatch, ConsoleBool, 2, 2, (enabled))
+{
+    if ( dAtob(argv[1]) )
+        return GLNull::enable();
+
+    GLNull::disable();
+    return GLNull::isEnabled();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the null GL dispatch is enabled or not.
+    @return Whether the null GL dispatch is enabled or not.
+*/
+ConsoleFunctionWithDocs( getGLNullDispatch, ConsoleBool, 1, 1, ())
+{
+    return GLNull::isEnabled();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Resets the metrics recorded by the null GL dispatch.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( resetGLNullMetrics, ConsoleVoid, 1, 1, ())
+{
+    GLNull::resetMetrics();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the metrics recorded by the null GL dispatch since it was last reset.
+    @return The metrics formatted as "calls drawCalls vertices stateChanges textureBinds bufferBinds textureBytes bufferBytes indexBytes".
+*/
+ConsoleFunctionWithDocs( getGLNullMetrics, ConsoleString, 1, 1, ())
+{
+    const GLNullMetrics& metrics = GLNull::getMetrics();
+
+    char* pBuffer = Con::getReturnBuffer( 128 );
+    dSprintf( pBuffer, 128, "%d %d %d %d %d %d %d %d %d",
+        metrics.mCalls,
+        metrics.mDrawCalls,
+        metrics.mVertices,
+        metrics.mStateChanges,
+        metrics.mTextureBinds,
+        metrics.mBufferBinds,
+        metrics.mTextureBytes,
+        metrics.mBufferBytes,
+        metrics.mIndexBytes );
+
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Dumps the metrics recorded by the null GL dispatch to the console.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( dumpGLNullMetrics, ConsoleVoid, 1, 1, ())
+{
+    const GLNullMetrics& metrics = GLNull::getMetrics();
+
+    Con::printf( "GL Null Metrics:" );
+    Con::printf( "  Enabled: %s", GLNull::isEnabled() ? "true" : "false" );
+    Con::printf( "  Calls: %d", metrics.mCalls );
+    Con::printf( "  DrawCalls: %d", metrics.mDrawCalls );
+    Con::printf( "  Vertices: %d", metrics.mVertices );
+    Con::printf( "  StateChanges: %d", metrics.mStateChanges );
+    Con::printf( "  TextureBinds: %d", metrics.mTextureBinds );
+    Con::printf( "  BufferBinds: %d", metrics.mBufferBinds );
+    Con::printf( "  TextureBytes: %d", metrics.mTextureBytes );
+    Con::printf( "  BufferBytes: %d", metrics.mBufferBytes );
+    Con::printf( "  IndexBytes: %d", metrics.mIndexBytes );
+}
+
+ConsoleFunctionGroupEnd(GLNull)
+
+/*! @} */ // group GLNullFunctions
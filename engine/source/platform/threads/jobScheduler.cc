@@ -0,0 +1,350 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/threads/jobScheduler.h"
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+// Script bindings.
+#include "jobScheduler_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+#ifdef TORQUE_OS_EMSCRIPTEN
+// Threads are not available so all work is executed inline.
+static const U32 JobSchedulerDefaultWorkerCount = 0;
+#else
+static const U32 JobSchedulerDefaultWorkerCount = 3;
+#endif
+
+static const U32 JobSchedulerMaxWorkerCount = 63;
+
+//-----------------------------------------------------------------------------
+
+JobScheduler* JobScheduler::Instance = NULL;
+
+//-----------------------------------------------------------------------------
+
+void JobScheduler::Init( void )
+{
+    // Create the job scheduler.
+    Instance = new JobScheduler();
+
+    // Start the default workers.
+    Instance->setWorkerCount( JobSchedulerDefaultWorkerCount );
+}
+
+//-----------------------------------------------------------------------------
+
+void JobScheduler::destroy( void )
+{
+    // Delete the job scheduler.
+    delete Instance;
+    Instance = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+JobScheduler::JobScheduler() :
+    mWorkSemaphore( 0 ),
+    mDoneSemaphore( 0 ),
+    mPendingJobs( 0 ),
+    mShutdown( false ),
+    mSubmitting( false )
+{
+    // The calling thread always owns a queue.
+    mQueues.push_back( new JobQueue() );
+}
+
+//-----------------------------------------------------------------------------
+
+JobScheduler::~JobScheduler()
+{
+    // Stop any workers.
+    stopWorkers();
+
+    // Delete the calling thread queue.
+    for ( S32 n = 0; n < mQueues.size(); ++n )
+        delete mQueues[n];
+
+    mQueues.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void JobScheduler::setWorkerCount( const U32 workerCount )
+{
+    // Sanity!
+    AssertFatal( !mSubmitting, "JobScheduler::setWorkerCount() - Cannot change workers whilst jobs are running." );
+
+    // Clamp the worker count.
+    U32 clampedWorkerCount = workerCount;
+
+#ifdef TORQUE_OS_EMSCRIPTEN
+    clampedWorkerCount = 0;
+#endif
+
+    if ( clampedWorkerCount > JobSchedulerMaxWorkerCount )
+    {
+        Con::warnf( "JobScheduler::setWorkerCount() - Worker count of %d is too high so clamping to %d.", workerCount, JobSchedulerMaxWorkerCount );
+        clampedWorkerCount = JobSchedulerMaxWorkerCount;
+    }
+
+    // Finish if no change.
+    if ( clampedWorkerCount == getWorkerCount() )
+        return;
+
+    // Restart the workers.
+    stopWorkers();
+    startWorkers( clampedWorkerCount );
+}
+
+//-----------------------------------------------------------------------------
+
+void JobScheduler::startWorkers( const U32 workerCount )
+{
+    // Create a queue per worker.
+    for ( U32 n = 0; n < workerCount; ++n )
+        mQueues.push_back( new JobQueue() );
+
+    // Create the workers.
+    // NOTE:- The workers are started only once constructed so that the virtual "run" is used.
+    for ( U32 n = 0; n < workerCount; ++n )
+    {
+        WorkerThread* pWorker = new WorkerThread( this, n + 1 );
+        mWorkers.push_back( pWorker );
+        pWorker->start();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void JobScheduler::stopWorkers( void )
+{
+    // Finish if no workers.
+    if ( mWorkers.size() == 0 )
+        return;
+
+    // Flag shutdown and wake all the workers.
+    mShutdown = true;
+    for ( S32 n = 0; n < mWorkers.size(); ++n )
+        mWorkSemaphore.release();
+
+    // Wait for the workers to finish.
+    for ( S32 n = 0; n < mWorkers.size(); ++n )
+    {
+        mWorkers[n]->join();
+        delete mWorkers[n];
+    }
+    mWorkers.clear();
+
+    // Delete the worker queues, leaving the calling thread queue.
+    for ( S32 n = 1; n < mQueues.size(); ++n )
+        delete mQueues[n];
+    mQueues.setSize( 1 );
+
+    mShutdown = false;
+}
+
+//-----------------------------------------------------------------------------
+
+void JobScheduler::parallelFor( const U32 count, const U32 grainSize, JobFunction function, void* pContext )
+{
+    // Sanity!
+    AssertFatal( function != NULL, "JobScheduler::parallelFor() - Invalid job function." );
+    AssertFatal( !mSubmitting, "JobScheduler::parallelFor() - Cannot submit jobs from within a job." );
+
+    // Finish if nothing to do.
+    if ( count == 0 )
+        return;
+
+    const U32 chunkSize = grainSize > 0 ? grainSize : 1;
+
+    // Execute inline if there are no workers or only a single chunk.
+    if ( mWorkers.size() == 0 || count <= chunkSize )
+    {
+        function( pContext, 0, count );
+        return;
+    }
+
+    mSubmitting = true;
+
+    // Calculate the chunk count.
+    const U32 chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    // Set the pending jobs before any job can complete.
+    mPendingLock.lock();
+    mPendingJobs = chunkCount;
+    mPendingLock.unlock();
+
+    // Deal the chunks out across the queues.
+    const U32 queueCount = (U32)mQueues.size();
+    for ( U32 chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex )
+    {
+        Job job;
+        job.mFunction = function;
+        job.mpContext = pContext;
+        job.mStartIndex = chunkIndex * chunkSize;
+        job.mEndIndex = getMin( job.mStartIndex + chunkSize, count );
+
+        JobQueue* pQueue = mQueues[chunkIndex % queueCount];
+        pQueue->mLock.lock();
+        pQueue->mJobs.push_back( job );
+        pQueue->mLock.unlock();
+    }
+
+    // Wake the workers.
+    const U32 wakeCount = getMin( chunkCount - 1, getWorkerCount() );
+    for ( U32 n = 0; n < wakeCount; ++n )
+        mWorkSemaphore.release();
+
+    // Participate until no more work can be found.
+    Job job;
+    while ( fetchJob( 0, job ) )
+        executeJob( job );
+
+    // Wait for any jobs still running on the workers.
+    mDoneSemaphore.acquire();
+
+    mSubmitting = false;
+}
+
+//-----------------------------------------------------------------------------
+
+bool JobScheduler::popJob( const U32 queueIndex, Job& job )
+{
+    JobQueue* pQueue = mQueues[queueIndex];
+
+    pQueue->mLock.lock();
+
+    // Finish if no jobs.
+    if ( (U32)pQueue->mJobs.size() == pQueue->mHead )
+    {
+        pQueue->mLock.unlock();
+        return false;
+    }
+
+    // The owner takes from the back.
+    job = pQueue->mJobs.last();
+    pQueue->mJobs.pop_back();
+
+    // Reset the queue when empty.
+    if ( (U32)pQueue->mJobs.size() == pQueue->mHead )
+    {
+        pQueue->mJobs.clear();
+        pQueue->mHead = 0;
+    }
+
+    pQueue->mLock.unlock();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool JobScheduler::stealJob( const U32 queueIndex, Job& job )
+{
+    const U32 queueCount = (U32)mQueues.size();
+
+    // Try the other queues in turn starting with our neighbour.
+    for ( U32 n = 1; n < queueCount; ++n )
+    {
+        JobQueue* pQueue = mQueues[(queueIndex + n) % queueCount];
+
+        pQueue->mLock.lock();
+
+        // Thieves take from the front.
+        if ( (U32)pQueue->mJobs.size() > pQueue->mHead )
+        {
+            job = pQueue->mJobs[pQueue->mHead++];
+
+            // Reset the queue when empty.
+            if ( (U32)pQueue->mJobs.size() == pQueue->mHead )
+            {
+                pQueue->mJobs.clear();
+                pQueue->mHead = 0;
+            }
+
+            pQueue->mLock.unlock();
+            return true;
+        }
+
+        pQueue->mLock.unlock();
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+bool JobScheduler::fetchJob( const U32 queueIndex, Job& job )
+{
+    // Use our own queue first.
+    if ( popJob( queueIndex, job ) )
+        return true;
+
+    // No, so steal from the other queues.
+    return stealJob( queueIndex, job );
+}
+
+//-----------------------------------------------------------------------------
+
+void JobScheduler::executeJob( const Job& job )
+{
+    // Execute the job.
+    job.mFunction( job.mpContext, job.mStartIndex, job.mEndIndex );
+
+    // Flag the job as complete.
+    mPendingLock.lock();
+    const bool finished = --mPendingJobs == 0;
+    mPendingLock.unlock();
+
+    // Signal the submitter if this was the last job.
+    if ( finished )
+        mDoneSemaphore.release();
+}
+
+//-----------------------------------------------------------------------------
+
+void JobScheduler::WorkerThread::run( void* arg )
+{
+    while ( true )
+    {
+        // Wait for work.
+        mpScheduler->mWorkSemaphore.acquire();
+
+        // Finish if shutting down.
+        if ( mpScheduler->mShutdown )
+            return;
+
+        // Process jobs until none remain.
+        Job job;
+        while ( mpScheduler->fetchJob( mQueueIndex, job ) )
+            mpScheduler->executeJob( job );
+    }
+}
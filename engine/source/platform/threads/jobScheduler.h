@@ -0,0 +1,130 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PLATFORM_THREADS_JOB_SCHEDULER_H_
+#define _PLATFORM_THREADS_JOB_SCHEDULER_H_
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A small work-stealing job scheduler used to spread data-parallel work across cores.
+///
+/// Work is submitted with parallelFor() which splits an index range into chunks and
+/// deals them out to one job queue per worker (the calling thread owns queue zero).
+/// Each thread pops jobs from the back of its own queue and, when that runs dry,
+/// steals from the front of the other queues.  The calling thread always participates
+/// and parallelFor() only returns once every chunk has been processed.
+///
+/// Only the main thread may submit work and job callbacks must not submit work themselves.
+/// With no worker threads all the work is simply executed inline on the calling thread.
+class JobScheduler
+{
+public:
+    /// Job callback.  Processes the indices [startIndex, endIndex).
+    typedef void (*JobFunction)( void* pContext, const U32 startIndex, const U32 endIndex );
+
+private:
+    struct Job
+    {
+        JobFunction mFunction;
+        void*       mpContext;
+        U32         mStartIndex;
+        U32         mEndIndex;
+    };
+
+    struct JobQueue
+    {
+        JobQueue() : mHead(0) {}
+
+        Mutex       mLock;
+        Vector<Job> mJobs;
+        U32         mHead;
+    };
+
+    class WorkerThread : public Thread
+    {
+    public:
+        WorkerThread( JobScheduler* pScheduler, const U32 queueIndex ) :
+            Thread( 0, 0, false, false ),
+            mpScheduler( pScheduler ),
+            mQueueIndex( queueIndex ) {}
+
+        virtual void run( void* arg = 0 );
+
+    private:
+        JobScheduler*   mpScheduler;
+        U32             mQueueIndex;
+    };
+
+    Vector<WorkerThread*>   mWorkers;
+    Vector<JobQueue*>       mQueues;
+
+    Semaphore               mWorkSemaphore;
+    Semaphore               mDoneSemaphore;
+
+    Mutex                   mPendingLock;
+    U32                     mPendingJobs;
+
+    volatile bool           mShutdown;
+    bool                    mSubmitting;
+
+public:
+    static void Init( void );
+    static void destroy( void );
+    static JobScheduler* Instance;
+
+    JobScheduler();
+    ~JobScheduler();
+
+    /// Worker threads (excluding the calling thread).
+    void setWorkerCount( const U32 workerCount );
+    inline U32 getWorkerCount( void ) const { return (U32)mWorkers.size(); }
+
+    /// Process the indices [0, count) in chunks of at most "grainSize" across all threads.
+    void parallelFor( const U32 count, const U32 grainSize, JobFunction function, void* pContext );
+
+private:
+    void startWorkers( const U32 workerCount );
+    void stopWorkers( void );
+
+    bool popJob( const U32 queueIndex, Job& job );
+    bool stealJob( const U32 queueIndex, Job& job );
+    bool fetchJob( const U32 queueIndex, Job& job );
+    void executeJob( const Job& job );
+};
+
+#endif // _PLATFORM_THREADS_JOB_SCHEDULER_H_
@@ -0,0 +1,56 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+/*! @addtogroup JobScheduler Job Scheduler
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Sets the number of worker threads used by the job scheduler.
+    The main thread always participates so zero executes all jobs on the main thread.
+    @param workerCount The number of worker threads.
+    @return No Return Value.
+*/
+ConsoleFunctionWithDocs( setJobWorkerCount, ConsoleVoid, 2, 2, (workerCount))
+{
+    const S32 workerCount = dAtoi(argv[1]);
+
+    if ( workerCount < 0 )
+    {
+        Con::warnf( "setJobWorkerCount() - Invalid worker count of %d.", workerCount );
+        return;
+    }
+
+    JobScheduler::Instance->setWorkerCount( (U32)workerCount );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of worker threads used by the job scheduler.
+    @return The number of worker threads.
+*/
+ConsoleFunctionWithDocs( getJobWorkerCount, ConsoleInt, 1, 1, ())
+{
+    return (S32)JobScheduler::Instance->getWorkerCount();
+}
+
+/*! @} */ // end group JobScheduler
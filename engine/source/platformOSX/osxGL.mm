@@ -219,11 +219,9 @@ void getGLCapabilities()
         if (dStrstr(pExtString, (const char*)"GL_EXT_texture_compression_s3tc") != NULL)
             gGLState.suppS3TC = true;
         
-        // EXT_vertex_buffer ========================================
-        // This extension is deprecated, and not supported by Apple. (10.4.3)
-        // Instead, the ARB Vertex Buffer extension is supported.
-        // The new extension has a different API, so TGE should be updated to use it.
-        if (dStrstr(pExtString, (const char*)"GL_EXT_vertex_buffer") != NULL)
+        // ARB_vertex_buffer_object ========================================
+        // NOTE: The deprecated EXT_vertex_buffer extension is not supported by Apple (10.4.3).
+        if (dStrstr(pExtString, (const char*)"GL_ARB_vertex_buffer_object") != NULL)
             gGLState.suppVertexBuffer = true;
         
         // Anisotropic filtering ========================================
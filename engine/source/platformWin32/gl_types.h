@@ -171,6 +171,13 @@ typedef float		GLfloat;	/* single precision float */
 typedef float		GLclampf;	/* single precision float in [0,1] */
 typedef double		GLdouble;	/* double precision float */
 typedef double		GLclampd;	/* double precision float in [0,1] */
+#ifdef _WIN64
+typedef __int64		GLintptrARB;	/* pointer-sized signed */
+typedef __int64		GLsizeiptrARB;	/* pointer-sized signed */
+#else
+typedef int		GLintptrARB;	/* pointer-sized signed */
+typedef int		GLsizeiptrARB;	/* pointer-sized signed */
+#endif
 
 
 
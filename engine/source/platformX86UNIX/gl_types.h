@@ -171,6 +171,8 @@ typedef float		GLfloat;	/* single precision float */
 typedef float		GLclampf;	/* single precision float in [0,1] */
 typedef double		GLdouble;	/* double precision float */
 typedef double		GLclampd;	/* double precision float in [0,1] */
+typedef long		GLintptrARB;	/* pointer-sized signed */
+typedef long		GLsizeiptrARB;	/* pointer-sized signed */
 
 
 
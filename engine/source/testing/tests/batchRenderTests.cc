@@ -0,0 +1,120 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _BATCH_RENDER_H_
+#include "2d/core/BatchRender.h"
+#endif
+
+#ifndef _PLATFORMGLNULL_H_
+#include "platform/platformGLNull.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define BATCHRENDER_UNITTEST_QUAD_COUNT     5
+
+//-----------------------------------------------------------------------------
+
+static void submitQuadRun( const bool strictOrder, Vector<F32>& drawnVertices )
+{
+    DebugStats debugStats;
+    BatchRender batchRender;
+    batchRender.setDebugStats( &debugStats );
+    batchRender.setRetainedMode( false );
+    batchRender.setStrictOrderMode( strictOrder );
+
+    // Build quads that each occupy their own unit square.
+    Vector2 vertexArray[BATCHRENDER_UNITTEST_QUAD_COUNT * 4];
+    Vector2 textureArray[BATCHRENDER_UNITTEST_QUAD_COUNT * 4];
+    for( U32 quadIndex = 0; quadIndex < BATCHRENDER_UNITTEST_QUAD_COUNT; ++quadIndex )
+    {
+        const F32 offset = (F32)quadIndex * 2.0f;
+        Vector2* pVertex = vertexArray + quadIndex * 4;
+        pVertex[0].Set( offset, 0.0f );
+        pVertex[1].Set( offset + 1.0f, 0.0f );
+        pVertex[2].Set( offset + 1.0f, 1.0f );
+        pVertex[3].Set( offset, 1.0f );
+
+        Vector2* pTexture = textureArray + quadIndex * 4;
+        pTexture[0].Set( 0.0f, 0.0f );
+        pTexture[1].Set( 1.0f, 0.0f );
+        pTexture[2].Set( 1.0f, 1.0f );
+        pTexture[3].Set( 0.0f, 1.0f );
+    }
+
+    // Submit the quads as a single run and capture what is drawn.
+    TextureHandle texture;
+    GLNull::clearCapturedVertices();
+    GLNull::setCaptureVertices( true );
+    batchRender.SubmitQuads( BATCHRENDER_UNITTEST_QUAD_COUNT, vertexArray, textureArray, NULL, texture );
+    batchRender.flush();
+    GLNull::setCaptureVertices( false );
+
+    drawnVertices = GLNull::getCapturedVertices();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BatchRenderTests, SortedQuadRunMatchesStrictTest )
+{
+    // Finish if the null GL dispatch is not available.
+    if ( !GLNull::isSupported() )
+        return;
+
+    const bool nullEnabled = GLNull::isEnabled();
+    GLNull::enable();
+
+    Vector<F32> strictVertices;
+    Vector<F32> sortedVertices;
+    submitQuadRun( true, strictVertices );
+    submitQuadRun( false, sortedVertices );
+
+    if ( !nullEnabled )
+        GLNull::disable();
+
+    // Check six vertices were drawn for every quad.
+    ASSERT_EQ( (U32)(BATCHRENDER_UNITTEST_QUAD_COUNT * 6 * 2), (U32)strictVertices.size() ) << "Strict quad count mismatch.";
+    ASSERT_EQ( (U32)strictVertices.size(), (U32)sortedVertices.size() ) << "Sorted quad count mismatch.";
+
+    // Check the sorted run draws the same vertices as the strict run.
+    for( U32 index = 0; index < (U32)strictVertices.size(); ++index )
+    {
+        ASSERT_EQ( strictVertices[index], sortedVertices[index] ) << "Sorted quad vertex mismatch.";
+    }
+
+    // Check every quad draws its own vertices.
+    for( U32 index = 0; index < (U32)sortedVertices.size(); index += 2 )
+    {
+        const U32 quadIndex = index / 12;
+        const F32 offset = (F32)quadIndex * 2.0f;
+        ASSERT_TRUE( sortedVertices[index] >= offset && sortedVertices[index] <= offset + 1.0f ) << "Quad drawn with another quads vertices.";
+    }
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,297 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PARTICLE_SYSTEM_H_
+#include "2d/core/ParticleSystem.h"
+#endif
+
+#ifndef _PARTICLE_PLAYER_H_
+#include "2d/sceneobject/ParticlePlayer.h"
+#endif
+
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define PARTICLE_UNITTEST_INTEGRATION_COUNT     37
+#define PARTICLE_UNITTEST_INTEGRATION_TOLERANCE 1.0e-4f
+
+//-----------------------------------------------------------------------------
+
+static void populateParticles( ParticleSystem::ParticleStore& particlesA, ParticleSystem::ParticleStore& particlesB, RandomLCG& random )
+{
+    for( U32 index = 0; index < PARTICLE_UNITTEST_INTEGRATION_COUNT; ++index )
+    {
+        const U32 particleIndex = particlesA.createParticle();
+        particlesB.createParticle();
+
+        particlesA.mParticleLifetime[particleIndex] = 1.0f;
+        particlesA.mParticleAge[particleIndex] = 0.0f;
+        particlesA.mPosition[particleIndex].Set( random.randRangeF( -100.0f, 100.0f ), random.randRangeF( -100.0f, 100.0f ) );
+        particlesA.mVelocity[particleIndex].Set( random.randRangeF( -10.0f, 10.0f ), random.randRangeF( -10.0f, 10.0f ) );
+        particlesA.mOrientationAngle[particleIndex] = 0.0f;
+        particlesA.mFrameProvider[particleIndex] = NULL;
+        particlesA.mRenderPosition[particleIndex].SetZero();
+        particlesA.mRenderRotation[particleIndex].SetIdentity();
+        particlesA.mRenderSize[particleIndex].SetZero();
+        particlesA.mColor[particleIndex].set( 0.0f, 0.0f, 0.0f, 0.0f );
+        particlesA.mSize[particleIndex].Set( random.randRangeF( 0.0f, 4.0f ), random.randRangeF( 0.0f, 4.0f ) );
+        particlesA.mSpeed[particleIndex] = random.randRangeF( 0.0f, 5.0f );
+        particlesA.mSpin[particleIndex] = random.randRangeF( -90.0f, 90.0f );
+        // Leave every third particle without a fixed force.
+        particlesA.mFixedForce[particleIndex] = (index % 3) == 0 ? 0.0f : random.randRangeF( -5.0f, 5.0f );
+        particlesA.mRandomMotion[particleIndex] = 0.0f;
+        particlesA.mPreTickPosition[particleIndex].SetZero();
+        particlesA.mPostTickPosition[particleIndex] = particlesA.mPosition[particleIndex];
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void copyParticles( const ParticleSystem::ParticleStore& source, ParticleSystem::ParticleStore& destination )
+{
+    for( U32 particleIndex = 0; particleIndex < source.getParticleCount(); ++particleIndex )
+    {
+        destination.mParticleLifetime[particleIndex] = source.mParticleLifetime[particleIndex];
+        destination.mParticleAge[particleIndex] = source.mParticleAge[particleIndex];
+        destination.mPosition[particleIndex] = source.mPosition[particleIndex];
+        destination.mVelocity[particleIndex] = source.mVelocity[particleIndex];
+        destination.mOrientationAngle[particleIndex] = source.mOrientationAngle[particleIndex];
+        destination.mFrameProvider[particleIndex] = source.mFrameProvider[particleIndex];
+        destination.mRenderPosition[particleIndex] = source.mRenderPosition[particleIndex];
+        destination.mRenderRotation[particleIndex] = source.mRenderRotation[particleIndex];
+        destination.mRenderSize[particleIndex] = source.mRenderSize[particleIndex];
+        destination.mColor[particleIndex] = source.mColor[particleIndex];
+        destination.mSize[particleIndex] = source.mSize[particleIndex];
+        destination.mSpeed[particleIndex] = source.mSpeed[particleIndex];
+        destination.mSpin[particleIndex] = source.mSpin[particleIndex];
+        destination.mFixedForce[particleIndex] = source.mFixedForce[particleIndex];
+        destination.mRandomMotion[particleIndex] = source.mRandomMotion[particleIndex];
+        destination.mPreTickPosition[particleIndex] = source.mPreTickPosition[particleIndex];
+        destination.mPostTickPosition[particleIndex] = source.mPostTickPosition[particleIndex];
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void integrateAndCompare( const bool fixedAspect, const U32 batchStart )
+{
+    RandomLCG random( 1234 );
+
+    ParticleSystem::ParticleStore vectorParticles;
+    ParticleSystem::ParticleStore scalarParticles;
+    populateParticles( vectorParticles, scalarParticles, random );
+    copyParticles( vectorParticles, scalarParticles );
+
+    // Sample some life-fields.
+    const U32 batchCount = PARTICLE_UNITTEST_INTEGRATION_COUNT - batchStart;
+    F32 sizeXLife[PARTICLE_UNITTEST_INTEGRATION_COUNT];
+    F32 sizeYLife[PARTICLE_UNITTEST_INTEGRATION_COUNT];
+    F32 speedLife[PARTICLE_UNITTEST_INTEGRATION_COUNT];
+    F32 fixedForceLife[PARTICLE_UNITTEST_INTEGRATION_COUNT];
+    F32 spinLife[PARTICLE_UNITTEST_INTEGRATION_COUNT];
+    ColorF colorLife[PARTICLE_UNITTEST_INTEGRATION_COUNT];
+    F32 vectorRenderSpin[PARTICLE_UNITTEST_INTEGRATION_COUNT];
+    F32 scalarRenderSpin[PARTICLE_UNITTEST_INTEGRATION_COUNT];
+    for( U32 index = 0; index < batchCount; ++index )
+    {
+        sizeXLife[index] = random.randRangeF( 0.0f, 2.0f );
+        sizeYLife[index] = random.randRangeF( 0.0f, 2.0f );
+        speedLife[index] = random.randRangeF( 0.0f, 2.0f );
+        fixedForceLife[index] = random.randRangeF( 0.0f, 2.0f );
+        spinLife[index] = random.randRangeF( 0.0f, 2.0f );
+        // Sample colors outside of the limits to ensure clamping.
+        colorLife[index].set( random.randRangeF( -0.5f, 1.5f ), random.randRangeF( -0.5f, 1.5f ), random.randRangeF( -0.5f, 1.5f ), random.randRangeF( -0.5f, 1.5f ) );
+        vectorRenderSpin[index] = scalarRenderSpin[index] = 0.0f;
+    }
+
+    // Configure the batch.
+    ParticleSystem::IntegrationBatch batch;
+    batch.mStart = batchStart;
+    batch.mCount = batchCount;
+    batch.mElapsedTime = 1.0f / 60.0f;
+    batch.mSizeXLife = sizeXLife;
+    batch.mSizeYLife = sizeYLife;
+    batch.mSpeedLife = speedLife;
+    batch.mFixedForceLife = fixedForceLife;
+    batch.mSpinLife = spinLife;
+    batch.mColorLife = colorLife;
+    batch.mSizeXLimits.Set( 0.5f, 3.0f );
+    batch.mSizeYLimits.Set( 0.25f, 2.0f );
+    batch.mSpeedLimits.Set( 0.0f, 6.0f );
+    batch.mFixedForceLimits.Set( -4.0f, 4.0f );
+    batch.mColorMinimum.set( 0.0f, 0.1f, 0.2f, 0.0f );
+    batch.mColorMaximum.set( 1.0f, 0.9f, 0.8f, 1.0f );
+    batch.mFixedAspect = fixedAspect;
+    batch.mFixedForceDirection.Set( 0.0f, -1.0f );
+    batch.mForceScale = 2.0f;
+
+    // Integrate both stores.
+    batch.mRenderSpin = vectorRenderSpin;
+    ParticleSystem::integrateParticles( vectorParticles, batch );
+    batch.mRenderSpin = scalarRenderSpin;
+    ParticleSystem::integrateParticlesScalar( scalarParticles, batch );
+
+    // Compare.
+    for( U32 particleIndex = 0; particleIndex < PARTICLE_UNITTEST_INTEGRATION_COUNT; ++particleIndex )
+    {
+        ASSERT_NEAR( scalarParticles.mPosition[particleIndex].x, vectorParticles.mPosition[particleIndex].x, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Position mismatch.";
+        ASSERT_NEAR( scalarParticles.mPosition[particleIndex].y, vectorParticles.mPosition[particleIndex].y, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Position mismatch.";
+        ASSERT_NEAR( scalarParticles.mVelocity[particleIndex].x, vectorParticles.mVelocity[particleIndex].x, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Velocity mismatch.";
+        ASSERT_NEAR( scalarParticles.mVelocity[particleIndex].y, vectorParticles.mVelocity[particleIndex].y, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Velocity mismatch.";
+        ASSERT_NEAR( scalarParticles.mRenderSize[particleIndex].x, vectorParticles.mRenderSize[particleIndex].x, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Render size mismatch.";
+        ASSERT_NEAR( scalarParticles.mRenderSize[particleIndex].y, vectorParticles.mRenderSize[particleIndex].y, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Render size mismatch.";
+        ASSERT_NEAR( scalarParticles.mRenderPosition[particleIndex].x, vectorParticles.mRenderPosition[particleIndex].x, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Render position mismatch.";
+        ASSERT_NEAR( scalarParticles.mRenderPosition[particleIndex].y, vectorParticles.mRenderPosition[particleIndex].y, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Render position mismatch.";
+        ASSERT_NEAR( scalarParticles.mPreTickPosition[particleIndex].x, vectorParticles.mPreTickPosition[particleIndex].x, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Pre-tick position mismatch.";
+        ASSERT_NEAR( scalarParticles.mPreTickPosition[particleIndex].y, vectorParticles.mPreTickPosition[particleIndex].y, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Pre-tick position mismatch.";
+        ASSERT_NEAR( scalarParticles.mPostTickPosition[particleIndex].x, vectorParticles.mPostTickPosition[particleIndex].x, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Post-tick position mismatch.";
+        ASSERT_NEAR( scalarParticles.mPostTickPosition[particleIndex].y, vectorParticles.mPostTickPosition[particleIndex].y, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Post-tick position mismatch.";
+        ASSERT_EQ( scalarParticles.mColor[particleIndex].red, vectorParticles.mColor[particleIndex].red ) << "Color mismatch.";
+        ASSERT_EQ( scalarParticles.mColor[particleIndex].green, vectorParticles.mColor[particleIndex].green ) << "Color mismatch.";
+        ASSERT_EQ( scalarParticles.mColor[particleIndex].blue, vectorParticles.mColor[particleIndex].blue ) << "Color mismatch.";
+        ASSERT_EQ( scalarParticles.mColor[particleIndex].alpha, vectorParticles.mColor[particleIndex].alpha ) << "Color mismatch.";
+    }
+
+    for( U32 index = 0; index < batchCount; ++index )
+    {
+        ASSERT_NEAR( scalarRenderSpin[index], vectorRenderSpin[index], PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Render spin mismatch.";
+    }
+
+    // Free the particles.
+    vectorParticles.setParticleCount( 0 );
+    scalarParticles.setParticleCount( 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleIntegrationTests, VectorMatchesScalarTest )
+{
+    integrateAndCompare( false, 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleIntegrationTests, VectorMatchesScalarFixedAspectTest )
+{
+    integrateAndCompare( true, 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleIntegrationTests, VectorMatchesScalarUnalignedBatchTest )
+{
+    // Start part-way into the store so the batch is neither aligned nor a multiple of four.
+    integrateAndCompare( false, 5 );
+}
+
+//-----------------------------------------------------------------------------
+
+static void integratePlayerAndCompare( const bool fixedAspect )
+{
+    RandomLCG random( 1234 );
+
+    ParticleSystem::ParticleStore batchedParticles;
+    ParticleSystem::ParticleStore singleParticles;
+    populateParticles( batchedParticles, singleParticles, random );
+
+    // Spread the particles over their lifetime.
+    for( U32 particleIndex = 0; particleIndex < PARTICLE_UNITTEST_INTEGRATION_COUNT; ++particleIndex )
+    {
+        batchedParticles.mParticleAge[particleIndex] = random.randRangeF( 0.0f, 1.0f );
+    }
+    copyParticles( batchedParticles, singleParticles );
+
+    // Configure an emitter with life-fields that vary over the particle lifetime.
+    ParticleAsset* pParticleAsset = new ParticleAsset();
+    ParticleAssetEmitter* pParticleAssetEmitter = new ParticleAssetEmitter();
+    pParticleAssetEmitter->setFixedAspect( fixedAspect );
+    pParticleAssetEmitter->setFixedForceAngle( 30.0f );
+    pParticleAssetEmitter->getSizeXLifeField().addDataKey( 1.0f, 0.25f );
+    pParticleAssetEmitter->getSizeYLifeField().addDataKey( 1.0f, 2.0f );
+    pParticleAssetEmitter->getSpeedLifeField().addDataKey( 1.0f, 3.0f );
+    pParticleAssetEmitter->getFixedForceLifeField().addDataKey( 1.0f, -2.0f );
+    pParticleAssetEmitter->getSpinLifeField().addDataKey( 1.0f, 4.0f );
+    pParticleAssetEmitter->getGreenChannelLifeField().addDataKey( 1.0f, 0.5f );
+    pParticleAssetEmitter->getAlphaChannelLifeField().addDataKey( 1.0f, 0.0f );
+
+    // Integrate both stores.
+    const F32 elapsedTime = 1.0f / 60.0f;
+    const F32 forceScale = 2.0f;
+    RandomLCG batchedRandom( 5678 );
+    RandomLCG singleRandom( 5678 );
+    ParticlePlayer::integrateParticles( pParticleAsset, pParticleAssetEmitter, batchedParticles, batchedRandom, forceScale, elapsedTime );
+    for( U32 particleIndex = 0; particleIndex < PARTICLE_UNITTEST_INTEGRATION_COUNT; ++particleIndex )
+    {
+        const F32 particleAge = singleParticles.mParticleAge[particleIndex] / singleParticles.mParticleLifetime[particleIndex];
+        ParticlePlayer::integrateParticle( pParticleAsset, pParticleAssetEmitter, singleParticles, singleRandom, forceScale, particleIndex, particleAge, elapsedTime );
+    }
+
+    // Compare.
+    for( U32 particleIndex = 0; particleIndex < PARTICLE_UNITTEST_INTEGRATION_COUNT; ++particleIndex )
+    {
+        ASSERT_NEAR( singleParticles.mPosition[particleIndex].x, batchedParticles.mPosition[particleIndex].x, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Position mismatch.";
+        ASSERT_NEAR( singleParticles.mPosition[particleIndex].y, batchedParticles.mPosition[particleIndex].y, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Position mismatch.";
+        ASSERT_NEAR( singleParticles.mVelocity[particleIndex].x, batchedParticles.mVelocity[particleIndex].x, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Velocity mismatch.";
+        ASSERT_NEAR( singleParticles.mVelocity[particleIndex].y, batchedParticles.mVelocity[particleIndex].y, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Velocity mismatch.";
+        ASSERT_NEAR( singleParticles.mRenderSize[particleIndex].x, batchedParticles.mRenderSize[particleIndex].x, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Render size mismatch.";
+        ASSERT_NEAR( singleParticles.mRenderSize[particleIndex].y, batchedParticles.mRenderSize[particleIndex].y, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Render size mismatch.";
+        ASSERT_NEAR( singleParticles.mRenderPosition[particleIndex].x, batchedParticles.mRenderPosition[particleIndex].x, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Render position mismatch.";
+        ASSERT_NEAR( singleParticles.mRenderPosition[particleIndex].y, batchedParticles.mRenderPosition[particleIndex].y, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Render position mismatch.";
+        ASSERT_NEAR( singleParticles.mOrientationAngle[particleIndex], batchedParticles.mOrientationAngle[particleIndex], PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Orientation mismatch.";
+        ASSERT_NEAR( singleParticles.mColor[particleIndex].red, batchedParticles.mColor[particleIndex].red, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Color mismatch.";
+        ASSERT_NEAR( singleParticles.mColor[particleIndex].green, batchedParticles.mColor[particleIndex].green, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Color mismatch.";
+        ASSERT_NEAR( singleParticles.mColor[particleIndex].blue, batchedParticles.mColor[particleIndex].blue, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Color mismatch.";
+        ASSERT_NEAR( singleParticles.mColor[particleIndex].alpha, batchedParticles.mColor[particleIndex].alpha, PARTICLE_UNITTEST_INTEGRATION_TOLERANCE ) << "Color mismatch.";
+    }
+
+    // Free the particles and the emitter.
+    batchedParticles.setParticleCount( 0 );
+    singleParticles.setParticleCount( 0 );
+    delete pParticleAssetEmitter;
+    delete pParticleAsset;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleIntegrationTests, VectorMatchesPerParticleTest )
+{
+    integratePlayerAndCompare( false );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleIntegrationTests, VectorMatchesPerParticleFixedAspectTest )
+{
+    integratePlayerAndCompare( true );
+}
+
+#endif // TORQUE_SHIPPING
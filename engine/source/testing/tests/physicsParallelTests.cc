@@ -0,0 +1,363 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef BOX2D_H
+#include "Box2D/Box2D.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_JOB_SCHEDULER_H_
+#include "platform/threads/jobScheduler.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define PHYSICS_UNITTEST_STACK_COUNT        10
+#define PHYSICS_UNITTEST_STACK_HEIGHT       8
+#define PHYSICS_UNITTEST_STACK_SPACING      8.0f
+#define PHYSICS_UNITTEST_STEP_COUNT         600
+#define PHYSICS_UNITTEST_STEP_TIME          (1.0f / 60.0f)
+#define PHYSICS_UNITTEST_WORKER_COUNT       3
+#define PHYSICS_UNITTEST_PUSHER_STEP        120
+#define PHYSICS_UNITTEST_FILTER_STEP        400
+
+//-----------------------------------------------------------------------------
+
+/// Spreads the physics tasks across a private job scheduler.
+class PhysicsTestTaskExecutor : public b2TaskExecutor
+{
+public:
+    PhysicsTestTaskExecutor( const U32 workerCount ) { mJobScheduler.setWorkerCount( workerCount ); }
+
+    virtual int32 GetThreadCount() const { return (int32)mJobScheduler.getWorkerCount() + 1; }
+
+    virtual void ParallelFor( int32 count, int32 grainSize, b2TaskFunction task, void* context )
+    {
+        PhysicsTask physicsTask;
+        physicsTask.mpTask = task;
+        physicsTask.mpContext = context;
+        mJobScheduler.parallelFor( (U32)count, (U32)getMax( grainSize, 1 ), &executePhysicsTaskJob, &physicsTask );
+    }
+
+private:
+    struct PhysicsTask
+    {
+        b2TaskFunction  mpTask;
+        void*           mpContext;
+    };
+
+    static void executePhysicsTaskJob( void* pContext, const U32 startIndex, const U32 endIndex )
+    {
+        const PhysicsTask* pPhysicsTask = static_cast<const PhysicsTask*>( pContext );
+        pPhysicsTask->mpTask( pPhysicsTask->mpContext, (int32)startIndex, (int32)endIndex );
+    }
+
+    JobScheduler mJobScheduler;
+};
+
+//-----------------------------------------------------------------------------
+
+static b2Body* createBody( b2World& world, Vector<b2Body*>& bodies, const b2BodyDef& bodyDef, const b2Shape& shape )
+{
+    b2Body* pBody = world.CreateBody( &bodyDef );
+    pBody->CreateFixture( &shape, 1.0f );
+    bodies.push_back( pBody );
+    return pBody;
+}
+
+//-----------------------------------------------------------------------------
+
+static void createStacks( b2World& world, Vector<b2Body*>& bodies, const bool upright )
+{
+    // Create a static ground shared by all the stacks.
+    b2BodyDef groundDef;
+    b2EdgeShape groundShape;
+    const F32 groundExtent = PHYSICS_UNITTEST_STACK_COUNT * PHYSICS_UNITTEST_STACK_SPACING;
+    groundShape.Set( b2Vec2( -groundExtent, 0.0f ), b2Vec2( groundExtent, 0.0f ) );
+    createBody( world, bodies, groundDef, groundShape );
+
+    // Create the stacks, unless upright with every other stack leaning so that it topples into its neighbour, merging their islands.
+    b2PolygonShape boxShape;
+    boxShape.SetAsBox( 0.5f, 0.5f );
+    for( U32 stackIndex = 0; stackIndex < PHYSICS_UNITTEST_STACK_COUNT; ++stackIndex )
+    {
+        const F32 stackX = ((F32)stackIndex - PHYSICS_UNITTEST_STACK_COUNT * 0.5f) * PHYSICS_UNITTEST_STACK_SPACING;
+        const F32 lean = upright || (stackIndex % 2) == 0 ? 0.0f : 0.2f;
+
+        for( U32 boxIndex = 0; boxIndex < PHYSICS_UNITTEST_STACK_HEIGHT; ++boxIndex )
+        {
+            b2BodyDef boxDef;
+            boxDef.type = b2_dynamicBody;
+            boxDef.position.Set( stackX + lean * (F32)boxIndex, 0.5f + (F32)boxIndex );
+            createBody( world, bodies, boxDef, boxShape );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+/// Records the PostSolve impulses in the order they are reported.
+class PostSolveRecorder : public b2ContactListener
+{
+public:
+    PostSolveRecorder( const Vector<b2Body*>& bodies ) : mBodyList( bodies ) {}
+
+    virtual void PostSolve( b2Contact* contact, const b2ContactImpulse* impulse )
+    {
+        mBodies.push_back( mBodyList.find_next( contact->GetFixtureA()->GetBody() ) );
+        mBodies.push_back( mBodyList.find_next( contact->GetFixtureB()->GetBody() ) );
+        for( S32 index = 0; index < impulse->count; ++index )
+        {
+            mImpulses.push_back( impulse->normalImpulses[index] );
+            mImpulses.push_back( impulse->tangentImpulses[index] );
+        }
+    }
+
+    const Vector<b2Body*>& mBodyList;
+    Vector<S32> mBodies;
+    Vector<F32> mImpulses;
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( PhysicsParallelTests, ParallelSolveMatchesSerialTest )
+{
+    PhysicsTestTaskExecutor taskExecutor( PHYSICS_UNITTEST_WORKER_COUNT );
+
+    // Create the same scene in both worlds.
+    b2World serialWorld( b2Vec2( 0.0f, -10.0f ) );
+    b2World parallelWorld( b2Vec2( 0.0f, -10.0f ) );
+    Vector<b2Body*> serialBodies;
+    Vector<b2Body*> parallelBodies;
+    createStacks( serialWorld, serialBodies, false );
+    createStacks( parallelWorld, parallelBodies, false );
+
+    PostSolveRecorder serialRecorder( serialBodies );
+    PostSolveRecorder parallelRecorder( parallelBodies );
+    serialWorld.SetContactListener( &serialRecorder );
+    parallelWorld.SetContactListener( &parallelRecorder );
+
+    // Solve the islands across threads in one world only.
+    parallelWorld.SetTaskExecutor( &taskExecutor );
+
+    S32 maximumSolveThreadCount = 0;
+    for( U32 step = 0; step < PHYSICS_UNITTEST_STEP_COUNT; ++step )
+    {
+        serialWorld.Step( PHYSICS_UNITTEST_STEP_TIME, 8, 3 );
+        parallelWorld.Step( PHYSICS_UNITTEST_STEP_TIME, 8, 3 );
+        maximumSolveThreadCount = getMax( maximumSolveThreadCount, (S32)parallelWorld.GetProfile().solveThreadCount );
+
+        // Compare the bodies.
+        for( S32 bodyIndex = 0; bodyIndex < serialBodies.size(); ++bodyIndex )
+        {
+            const b2Body* pSerialBody = serialBodies[bodyIndex];
+            const b2Body* pParallelBody = parallelBodies[bodyIndex];
+            ASSERT_EQ( pSerialBody->GetPosition().x, pParallelBody->GetPosition().x ) << "Body position mismatch.";
+            ASSERT_EQ( pSerialBody->GetPosition().y, pParallelBody->GetPosition().y ) << "Body position mismatch.";
+            ASSERT_EQ( pSerialBody->GetAngle(), pParallelBody->GetAngle() ) << "Body angle mismatch.";
+            ASSERT_EQ( pSerialBody->IsAwake(), pParallelBody->IsAwake() ) << "Body sleep state mismatch.";
+        }
+
+        // Compare the impulses.
+        ASSERT_EQ( serialRecorder.mBodies.size(), parallelRecorder.mBodies.size() ) << "PostSolve count mismatch.";
+        ASSERT_EQ( serialRecorder.mImpulses.size(), parallelRecorder.mImpulses.size() ) << "PostSolve impulse count mismatch.";
+        for( S32 index = 0; index < serialRecorder.mBodies.size(); ++index )
+        {
+            ASSERT_EQ( serialRecorder.mBodies[index], parallelRecorder.mBodies[index] ) << "PostSolve order mismatch.";
+        }
+        for( S32 index = 0; index < serialRecorder.mImpulses.size(); ++index )
+        {
+            ASSERT_EQ( serialRecorder.mImpulses[index], parallelRecorder.mImpulses[index] ) << "PostSolve impulse mismatch.";
+        }
+        serialRecorder.mBodies.clear();
+        serialRecorder.mImpulses.clear();
+        parallelRecorder.mBodies.clear();
+        parallelRecorder.mImpulses.clear();
+    }
+
+    // Check that the islands were actually solved across threads where threads are available.
+    if ( taskExecutor.GetThreadCount() > 1 )
+    {
+        ASSERT_GT( maximumSolveThreadCount, 1 ) << "Islands were not solved across threads.";
+    }
+
+    // Check that the scene settled.
+    for( S32 bodyIndex = 0; bodyIndex < serialBodies.size(); ++bodyIndex )
+    {
+        ASSERT_FALSE( serialBodies[bodyIndex]->IsAwake() ) << "Scene did not fall asleep.";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+/// Records the contact events in the order they are reported.
+class ContactEventRecorder : public b2ContactListener
+{
+public:
+    enum ContactEvent
+    {
+        BEGIN_CONTACT,
+        END_CONTACT,
+        PRE_SOLVE,
+    };
+
+    ContactEventRecorder( const Vector<b2Body*>& bodies ) : mBodyList( bodies ), mBeginCount( 0 ), mEndCount( 0 ) {}
+
+    virtual void BeginContact( b2Contact* contact ) { recordEvent( BEGIN_CONTACT, contact ); mBeginCount++; }
+    virtual void EndContact( b2Contact* contact ) { recordEvent( END_CONTACT, contact ); mEndCount++; }
+    virtual void PreSolve( b2Contact* contact, const b2Manifold* oldManifold ) { recordEvent( PRE_SOLVE, contact ); }
+
+    const Vector<b2Body*>& mBodyList;
+    Vector<S32> mEvents;
+    U32 mBeginCount;
+    U32 mEndCount;
+
+private:
+    void recordEvent( const ContactEvent contactEvent, b2Contact* contact )
+    {
+        mEvents.push_back( contactEvent );
+        mEvents.push_back( mBodyList.find_next( contact->GetFixtureA()->GetBody() ) );
+        mEvents.push_back( mBodyList.find_next( contact->GetFixtureB()->GetBody() ) );
+        mEvents.push_back( contact->GetManifold()->pointCount );
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+static void createPusher( b2World& world, Vector<b2Body*>& bodies )
+{
+    // Slowly push a box into the side of the first stack.  The stack box is woken when the pusher contact is created but
+    // falls asleep again before the pusher touches it.  The pusher contact then wakes it during the contact update and,
+    // being newer, is earlier in the contact list than the contacts between the sleeping boxes.
+    b2BodyDef pusherDef;
+    pusherDef.type = b2_kinematicBody;
+    pusherDef.position.Set( -PHYSICS_UNITTEST_STACK_COUNT * 0.5f * PHYSICS_UNITTEST_STACK_SPACING - 1.3f, 3.5f );
+    pusherDef.linearVelocity.Set( 0.1f, 0.0f );
+    b2PolygonShape pusherShape;
+    pusherShape.SetAsBox( 0.5f, 0.5f );
+    createBody( world, bodies, pusherDef, pusherShape );
+}
+
+//-----------------------------------------------------------------------------
+
+static void filterStack( Vector<b2Body*>& bodies, const U32 stackIndex, const bool wake )
+{
+    // Stop the stack boxes colliding with each other so their contacts are filtered and destroyed, even if asleep.
+    b2Filter filter;
+    filter.groupIndex = -1;
+    for( U32 boxIndex = 0; boxIndex < PHYSICS_UNITTEST_STACK_HEIGHT; ++boxIndex )
+    {
+        b2Body* pBody = bodies[1 + stackIndex * PHYSICS_UNITTEST_STACK_HEIGHT + boxIndex];
+        pBody->GetFixtureList()->SetFilterData( filter );
+        if ( wake )
+            pBody->SetAwake( true );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PhysicsParallelTests, ParallelCollideMatchesSerialTest )
+{
+    PhysicsTestTaskExecutor taskExecutor( PHYSICS_UNITTEST_WORKER_COUNT );
+
+    // Create the same scene in both worlds.
+    b2World serialWorld( b2Vec2( 0.0f, -10.0f ) );
+    b2World parallelWorld( b2Vec2( 0.0f, -10.0f ) );
+    Vector<b2Body*> serialBodies;
+    Vector<b2Body*> parallelBodies;
+    createStacks( serialWorld, serialBodies, true );
+    createStacks( parallelWorld, parallelBodies, true );
+
+    ContactEventRecorder serialRecorder( serialBodies );
+    ContactEventRecorder parallelRecorder( parallelBodies );
+    serialWorld.SetContactListener( &serialRecorder );
+    parallelWorld.SetContactListener( &parallelRecorder );
+
+    // Update the contacts across threads in one world only.
+    parallelWorld.SetCollideTaskExecutor( &taskExecutor );
+
+    for( U32 step = 0; step < PHYSICS_UNITTEST_STEP_COUNT; ++step )
+    {
+        // Start pushing once the stacks are asleep.
+        if ( step == PHYSICS_UNITTEST_PUSHER_STEP )
+        {
+            for( S32 bodyIndex = 0; bodyIndex < serialBodies.size(); ++bodyIndex )
+            {
+                ASSERT_FALSE( serialBodies[bodyIndex]->IsAwake() ) << "Stacks did not fall asleep.";
+            }
+
+            createPusher( serialWorld, serialBodies );
+            createPusher( parallelWorld, parallelBodies );
+        }
+
+        // Filter the pushed stack and a stack that is still asleep.
+        if ( step == PHYSICS_UNITTEST_FILTER_STEP )
+        {
+            ASSERT_TRUE( serialBodies[1]->IsAwake() ) << "Pusher did not wake the stack.";
+
+            filterStack( serialBodies, 0, true );
+            filterStack( serialBodies, 3, false );
+            filterStack( parallelBodies, 0, true );
+            filterStack( parallelBodies, 3, false );
+        }
+
+        serialWorld.Step( PHYSICS_UNITTEST_STEP_TIME, 8, 3 );
+        parallelWorld.Step( PHYSICS_UNITTEST_STEP_TIME, 8, 3 );
+
+        // Compare the events.
+        ASSERT_EQ( serialRecorder.mEvents.size(), parallelRecorder.mEvents.size() ) << "Contact event count mismatch.";
+        for( S32 index = 0; index < serialRecorder.mEvents.size(); ++index )
+        {
+            ASSERT_EQ( serialRecorder.mEvents[index], parallelRecorder.mEvents[index] ) << "Contact event mismatch.";
+        }
+        serialRecorder.mEvents.clear();
+        parallelRecorder.mEvents.clear();
+    }
+
+    // Check that contacts both began and ended.
+    ASSERT_GT( serialRecorder.mBeginCount, 0u ) << "No contacts began.";
+    ASSERT_GT( serialRecorder.mEndCount, 0u ) << "No contacts ended.";
+
+    // Compare the bodies.
+    for( S32 bodyIndex = 0; bodyIndex < serialBodies.size(); ++bodyIndex )
+    {
+        const b2Body* pSerialBody = serialBodies[bodyIndex];
+        const b2Body* pParallelBody = parallelBodies[bodyIndex];
+        ASSERT_EQ( pSerialBody->GetPosition().x, pParallelBody->GetPosition().x ) << "Body position mismatch.";
+        ASSERT_EQ( pSerialBody->GetPosition().y, pParallelBody->GetPosition().y ) << "Body position mismatch.";
+        ASSERT_EQ( pSerialBody->GetAngle(), pParallelBody->GetAngle() ) << "Body angle mismatch.";
+        ASSERT_EQ( pSerialBody->IsAwake(), pParallelBody->IsAwake() ) << "Body sleep state mismatch.";
+    }
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,252 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_ANIMATION_CLOCK_H_
+#include "2d/scene/SceneAnimationClock.h"
+#endif
+
+#ifndef _IMAGE_FRAME_PROVIDER_H
+#include "2d/core/ImageFrameProvider.h"
+#endif
+
+#ifndef _ANIMATION_ASSET_H_
+#include "2d/assets/AnimationAsset.h"
+#endif
+
+#ifndef _ASSET_MANAGER_H_
+#include "assets/assetManager.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define ANIMATION_CLOCK_UNITTEST_PROVIDER_COUNT     12
+#define ANIMATION_CLOCK_UNITTEST_TICK_COUNT         150
+#define ANIMATION_CLOCK_UNITTEST_TICK_TIME          (1.0f / 60.0f)
+#define ANIMATION_CLOCK_UNITTEST_FRAME_COUNT        8
+#define ANIMATION_CLOCK_UNITTEST_ANIMATION_TIME     1.0f
+#define ANIMATION_CLOCK_UNITTEST_TOLERANCE          1.0e-4f
+
+//-----------------------------------------------------------------------------
+
+enum AnimationClockScenario
+{
+    ANIMATION_CLOCK_PLAY,
+    ANIMATION_CLOCK_PAUSE,
+    ANIMATION_CLOCK_TIME_SCALE,
+    ANIMATION_CLOCK_DISABLE,
+};
+
+//-----------------------------------------------------------------------------
+
+class AnimationClockTestProvider : public ImageFrameProvider
+{
+public:
+    AnimationClockTestProvider() : mAnimationEndCount( 0 ) {}
+
+    void startAnimation( const char* pAnimationAssetId, const F32 startTime, const F32 timeScale )
+    {
+        // Configure the animation directly as the test animation has no image to validate frames against.
+        mAnimationAsset = pAnimationAssetId;
+        mStaticProvider = false;
+        mMaxFrameIndex = ANIMATION_CLOCK_UNITTEST_FRAME_COUNT-1;
+        mTotalIntegrationTime = ANIMATION_CLOCK_UNITTEST_ANIMATION_TIME;
+        mFrameIntegrationTime = mTotalIntegrationTime / ANIMATION_CLOCK_UNITTEST_FRAME_COUNT;
+        mAnimationTimeScale = timeScale;
+        mCurrentTime = startTime;
+        mCurrentModTime = mFmod( mCurrentTime, mTotalIntegrationTime );
+        mCurrentFrameIndex = (S32)(mCurrentModTime / mFrameIntegrationTime);
+        mLastFrameIndex = mCurrentFrameIndex;
+        mAnimationPaused = false;
+        mAnimationFinished = false;
+
+        // Let the animation clock update the animation if possible.
+        refreshAnimationClock( true );
+    }
+
+    void tickPerObject( const F32 elapsedTime )
+    {
+        // Integrate as "ImageFrameProviderCore::update()" does when ticked per-object.
+        if ( mAnimationFinished || mAnimationPaused )
+            return;
+
+        mCurrentTime += elapsedTime * mAnimationTimeScale;
+
+        if ( !(*mpAnimationAsset)->getAnimationCycle() && mGreaterThanOrEqual(mCurrentTime, mTotalIntegrationTime) )
+        {
+            mAnimationFinished = true;
+            mCurrentTime = mTotalIntegrationTime - (mFrameIntegrationTime * 0.5f);
+        }
+
+        mCurrentModTime = mFmod( mCurrentTime, mTotalIntegrationTime );
+        mCurrentFrameIndex = (S32)(mCurrentModTime / mFrameIntegrationTime);
+        mLastFrameIndex = mCurrentFrameIndex;
+
+        if ( mAnimationFinished )
+            onAnimationEnd();
+    }
+
+    inline U32 getAnimationEndCount( void ) const { return mAnimationEndCount; }
+
+protected:
+    virtual void onAnimationEnd( void ) { mAnimationEndCount++; }
+
+private:
+    U32 mAnimationEndCount;
+};
+
+//-----------------------------------------------------------------------------
+
+static StringTableEntry createAnimationAsset( const bool animationCycle )
+{
+    AnimationAsset* pAnimationAsset = new AnimationAsset();
+    pAnimationAsset->setAnimationTime( ANIMATION_CLOCK_UNITTEST_ANIMATION_TIME );
+    pAnimationAsset->setAnimationCycle( animationCycle );
+    return AssetDatabase.addPrivateAsset( pAnimationAsset );
+}
+
+//-----------------------------------------------------------------------------
+
+static void integrateAndCompare( const AnimationClockScenario scenario )
+{
+    // Hold the animations for the duration of the test.
+    AssetPtr<AnimationAsset> cycleAnimation( createAnimationAsset( true ) );
+    AssetPtr<AnimationAsset> onceAnimation( createAnimationAsset( false ) );
+
+    const F32 timeScales[] = { 1.0f, 0.5f, 2.0f };
+    const F32 startTimes[] = { 0.0f, 0.3f };
+
+    // Start the same animations on clocked providers and on providers ticked per-object.
+    SceneAnimationClock animationClock;
+    AnimationClockTestProvider clockedProviders[ANIMATION_CLOCK_UNITTEST_PROVIDER_COUNT];
+    AnimationClockTestProvider tickedProviders[ANIMATION_CLOCK_UNITTEST_PROVIDER_COUNT];
+    bool tickedEnabled[ANIMATION_CLOCK_UNITTEST_PROVIDER_COUNT];
+    for( U32 index = 0; index < ANIMATION_CLOCK_UNITTEST_PROVIDER_COUNT; ++index )
+    {
+        const char* pAnimationAssetId = (index % 2) == 0 ? cycleAnimation.getAssetId() : onceAnimation.getAssetId();
+        const F32 startTime = startTimes[(index / 2) % 2];
+        const F32 timeScale = timeScales[(index / 4) % 3];
+
+        clockedProviders[index].setAnimationClock( &animationClock );
+        clockedProviders[index].startAnimation( pAnimationAssetId, startTime, timeScale );
+        tickedProviders[index].startAnimation( pAnimationAssetId, startTime, timeScale );
+        tickedEnabled[index] = true;
+    }
+
+    ASSERT_EQ( (U32)ANIMATION_CLOCK_UNITTEST_PROVIDER_COUNT, animationClock.getProviderCount() ) << "Providers were not clocked.";
+
+    for( U32 tick = 0; tick < ANIMATION_CLOCK_UNITTEST_TICK_COUNT; ++tick )
+    {
+        // Apply the scenario to every other pair of providers so that both animations are covered.
+        for( U32 index = 0; index < ANIMATION_CLOCK_UNITTEST_PROVIDER_COUNT; ++index )
+        {
+            if ( ((index / 2) % 2) == 0 )
+                continue;
+
+            AnimationClockTestProvider& clockedProvider = clockedProviders[index];
+            AnimationClockTestProvider& tickedProvider = tickedProviders[index];
+
+            if ( scenario == ANIMATION_CLOCK_PAUSE && (tick == 20 || tick == 50) )
+            {
+                clockedProvider.pauseAnimation( tick == 20 );
+                tickedProvider.pauseAnimation( tick == 20 );
+            }
+            else if ( scenario == ANIMATION_CLOCK_TIME_SCALE && tick == 30 )
+            {
+                clockedProvider.setAnimationTimeScale( 1.5f );
+                tickedProvider.setAnimationTimeScale( 1.5f );
+            }
+            else if ( scenario == ANIMATION_CLOCK_DISABLE && (tick == 10 || tick == 70) )
+            {
+                // Leave the clock whilst disabled as a disabled sprite does and, as it's no longer ticked, stop ticking it.
+                clockedProvider.setAnimationClock( tick == 10 ? NULL : &animationClock );
+                tickedEnabled[index] = tick != 10;
+            }
+        }
+
+        // Integrate.
+        animationClock.integrate( ANIMATION_CLOCK_UNITTEST_TICK_TIME, NULL );
+        for( U32 index = 0; index < ANIMATION_CLOCK_UNITTEST_PROVIDER_COUNT; ++index )
+        {
+            if ( tickedEnabled[index] )
+                tickedProviders[index].tickPerObject( ANIMATION_CLOCK_UNITTEST_TICK_TIME );
+        }
+
+        // Compare.
+        for( U32 index = 0; index < ANIMATION_CLOCK_UNITTEST_PROVIDER_COUNT; ++index )
+        {
+            const AnimationClockTestProvider& clockedProvider = clockedProviders[index];
+            const AnimationClockTestProvider& tickedProvider = tickedProviders[index];
+
+            ASSERT_EQ( tickedProvider.getAnimationFrame(), clockedProvider.getAnimationFrame() ) << "Frame mismatch.";
+            ASSERT_NEAR( tickedProvider.getCurrentAnimationTime(), clockedProvider.getCurrentAnimationTime(), ANIMATION_CLOCK_UNITTEST_TOLERANCE ) << "Time mismatch.";
+            ASSERT_EQ( tickedProvider.isAnimationFinished(), clockedProvider.isAnimationFinished() ) << "Finished mismatch.";
+            ASSERT_EQ( tickedProvider.getAnimationEndCount(), clockedProvider.getAnimationEndCount() ) << "Animation end mismatch.";
+        }
+
+        // Check that disabled providers left the clock.
+        if ( scenario == ANIMATION_CLOCK_DISABLE && tick >= 10 && tick < 70 )
+        {
+            for( U32 index = 0; index < ANIMATION_CLOCK_UNITTEST_PROVIDER_COUNT; ++index )
+            {
+                if ( !tickedEnabled[index] )
+                    ASSERT_FALSE( clockedProviders[index].isAnimationClocked() ) << "Disabled provider is still clocked.";
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneAnimationClockTests, ClockedMatchesPerObjectTest )
+{
+    integrateAndCompare( ANIMATION_CLOCK_PLAY );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneAnimationClockTests, ClockedMatchesPerObjectPauseTest )
+{
+    integrateAndCompare( ANIMATION_CLOCK_PAUSE );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneAnimationClockTests, ClockedMatchesPerObjectTimeScaleTest )
+{
+    integrateAndCompare( ANIMATION_CLOCK_TIME_SCALE );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneAnimationClockTests, ClockedMatchesPerObjectDisableTest )
+{
+    integrateAndCompare( ANIMATION_CLOCK_DISABLE );
+}
+
+#endif // TORQUE_SHIPPING
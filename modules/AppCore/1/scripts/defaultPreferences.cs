@@ -51,9 +51,11 @@ $pref::T2D::ParticlePlayerEmissionRateScale = 1.0;
 $pref::T2D::ParticlePlayerSizeScale = 1.0;
 $pref::T2D::ParticlePlayerForceScale = 1.0;
 $pref::T2D::ParticlePlayerTimeScale = 1.0;
+$pref::T2D::ParticleAssetFieldBakeResolution = 0;
 $pref::T2D::warnFileDeprecated = 1;
 $pref::T2D::warnSceneOccupancy = 1;
 $pref::T2D::imageAssetGlobalFilterMode = Bilinear;
+$pref::T2D::batchRenderBufferSize = 65535;
 $pref::T2D::TAMLSchema="";
 $pref::T2D::JSONStrict = 1;
 
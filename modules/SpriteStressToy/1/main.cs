@@ -36,6 +36,7 @@ function SpriteStressToy::create( %this )
     
     // Configure the toy.
     SpriteStressToy.SpriteSceneLayer = 10;
+    SpriteStressToy.SpriteLayers = 1;
     SpriteStressToy.MaxSprite = 100;
     SpriteStressToy.SpriteCreateRate = 50;
     SpriteStressToy.SpriteCreatePeriod = 100;
@@ -43,6 +44,8 @@ function SpriteStressToy::create( %this )
     SpriteStressToy.RandomAngle = false;
     SpriteStressToy.RenderMode = "Static";
     SpriteStressToy.RenderSortMode = "off";
+    SpriteStressToy.ParallelRenderCompile = false;
+    SpriteStressToy.BenchmarkPeriod = 3000;
     
     // Add the configuration options.
     addNumericOption("Sprite Maximum", 1, 100000, 100, "setSpriteMaximum", SpriteStressToy.MaxSprite, true, "Sets the maximum number of sprites to create." );
@@ -51,6 +54,9 @@ function SpriteStressToy::create( %this )
     addNumericOption("Sprite Create Period (ms)", 10, 1000, 10, "setSpriteCreatePeriod", SpriteStressToy.SpriteCreatePeriod, true, "Sets the time interval for creating bursts of sprites.  Bigger values create the maximum sprites quicker." );
     addSelectionOption( "Static,Static (Composite),Animated,Animated (Composite)", "Render Mode", 4, "setRenderMode", true, "Sets the type of object used in the stress test." );
     addSelectionOption( "Off,New,Old,X,Y,Z,-X,-Y,-Z", "Render Sort Mode", 9, "setRenderSortMode", false, "Sets the render sorting mode controlling the order of rendering." );
+    addNumericOption("Sprite Layers", 1, 20, 1, "setSpriteLayers", SpriteStressToy.SpriteLayers, true, "Sets the number of scene layers the sprites are spread across." );
+    addFlagOption("Parallel Render Compile", "setParallelRenderCompile", SpriteStressToy.ParallelRenderCompile, false, "Whether the render requests for each layer are compiled across multiple threads or not." );
+    addButtonOption("Benchmark", "startBenchmark", false, "Measures the average frame time with the layers compiled serially and then in parallel." );
     
     // Reset the toy.
     SpriteStressToy.reset();
@@ -79,6 +85,9 @@ function SpriteStressToy::reset( %this )
     // Clear the scene.
     SandboxScene.clear();
 
+    // Set the parallel render compilation.
+    SandboxScene.setParallelRenderCompile( SpriteStressToy.ParallelRenderCompile );
+
     // Update the render sort mode.
     %this.updateRenderSortMode();
                   
@@ -215,8 +224,9 @@ function SpriteStressToy::updateSpriteCountOverlay( %this )
 
 function SpriteStressToy::updateRenderSortMode( %this )
 {
-    // Set the sprite layer sort mode.
-    SandboxScene.setLayerSortMode( SpriteStressToy.SpriteSceneLayer, SpriteStressToy.RenderSortMode );  
+    // Set the sprite layer sort modes.
+    for( %layer = 0; %layer < SpriteStressToy.SpriteLayers; %layer++ )
+        SandboxScene.setLayerSortMode( SpriteStressToy.SpriteSceneLayer + %layer, SpriteStressToy.RenderSortMode );  
     
     // Finish if no composite-sprite object.
     if ( !isObject(SpriteStressToy.CompositeSpriteObject) )
@@ -253,8 +263,8 @@ function SpriteStressToy::createStaticSprites( %this )
         // Set the position.
         %object.Position = getRandom(SpriteStressToy.MinX, SpriteStressToy.MaxX) SPC getRandom(SpriteStressToy.MinY, SpriteStressToy.MaxY);
 
-        // Set to just in-front of the background layer.
-        %object.SceneLayer = SpriteStressToy.SpriteSceneLayer;
+        // Set to just in-front of the background layer, spread across the sprite layers.
+        %object.SceneLayer = SpriteStressToy.SpriteSceneLayer + (SpriteStressToy.SpriteCount % SpriteStressToy.SpriteLayers);
         
         // Set a random scene-layer depth.
         %object.SceneLayerDepth = getRandom(-100,100);
@@ -322,8 +332,8 @@ function SpriteStressToy::createAnimatedSprites( %this )
         // Set the position.
         %object.Position = getRandom(SpriteStressToy.MinX, SpriteStressToy.MaxX) SPC getRandom(SpriteStressToy.MinY, SpriteStressToy.MaxY);
             
-        // Set to just in-front of the background layer.
-        %object.SceneLayer = SpriteStressToy.SpriteSceneLayer;
+        // Set to just in-front of the background layer, spread across the sprite layers.
+        %object.SceneLayer = SpriteStressToy.SpriteSceneLayer + (SpriteStressToy.SpriteCount % SpriteStressToy.SpriteLayers);
             
         // Set a random scene-layer depth.
         %object.SceneLayerDepth = getRandom(-100,100);
@@ -579,3 +589,77 @@ function SpriteStressToy::setRenderSortMode( %this, %value )
     // Update the render sort mode.
     %this.updateRenderSortMode();    
 }
+
+//-----------------------------------------------------------------------------
+
+function SpriteStressToy::setSpriteLayers( %this, %value )
+{
+    SpriteStressToy.SpriteLayers = %value;
+}
+
+//-----------------------------------------------------------------------------
+
+function SpriteStressToy::setParallelRenderCompile( %this, %value )
+{
+    SpriteStressToy.ParallelRenderCompile = %value;
+
+    // Set the parallel render compilation.
+    SandboxScene.setParallelRenderCompile( %value );
+}
+
+//-----------------------------------------------------------------------------
+
+function SpriteStressToy::startBenchmark( %this )
+{
+    // Finish if a benchmark is already running.
+    if ( SpriteStressToy.BenchmarkRunning )
+        return;
+
+    SpriteStressToy.BenchmarkRunning = true;
+
+    // Start with the layers compiled serially.
+    %this.startBenchmarkPass( false );
+}
+
+//-----------------------------------------------------------------------------
+
+function SpriteStressToy::startBenchmarkPass( %this, %parallel )
+{
+    // Set the parallel render compilation.
+    SandboxScene.setParallelRenderCompile( %parallel );
+
+    // Note the start of the pass.
+    SpriteStressToy.BenchmarkStartTime = getRealTime();
+    SpriteStressToy.BenchmarkStartFrame = $fps::frameCount;
+
+    // Schedule the end of the pass.
+    %this.schedule( SpriteStressToy.BenchmarkPeriod, "endBenchmarkPass", %parallel );
+}
+
+//-----------------------------------------------------------------------------
+
+function SpriteStressToy::endBenchmarkPass( %this, %parallel )
+{
+    // Calculate the average frame time.
+    %elapsedTime = getRealTime() - SpriteStressToy.BenchmarkStartTime;
+    %elapsedFrames = $fps::frameCount - SpriteStressToy.BenchmarkStartFrame;
+    %frameTime = %elapsedFrames > 0 ? %elapsedTime / %elapsedFrames : 0;
+
+    // Finish the serial pass and start the parallel pass.
+    if ( !%parallel )
+    {
+        SpriteStressToy.BenchmarkSerialFrameTime = %frameTime;
+        %this.startBenchmarkPass( true );
+        return;
+    }
+
+    // Report the results.
+    echo( "SpriteStressToy Benchmark - Sprites:" SPC SpriteStressToy.SpriteCount SPC "Layers:" SPC SpriteStressToy.SpriteLayers );
+    echo( "  Serial render compile:" SPC SpriteStressToy.BenchmarkSerialFrameTime SPC "ms/frame." );
+    echo( "  Parallel render compile:" SPC %frameTime SPC "ms/frame." );
+
+    // Restore the parallel render compilation.
+    SandboxScene.setParallelRenderCompile( SpriteStressToy.ParallelRenderCompile );
+
+    SpriteStressToy.BenchmarkRunning = false;
+}